@@ -22,6 +22,7 @@
  * of multiple low-level initializers with the same \a priority, the execution order within that group is unspecified.
  *
  * Values of \a priority used internally by distortos:
+ * - 0 - TLSF heap low-level initialization,
  * - 10 - main() thread and scheduler low-level initialization,
  * - 20 - idle thread low-level initialization,
  * - 30 - architecture low-level initialization,
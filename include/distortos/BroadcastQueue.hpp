@@ -0,0 +1,395 @@
+/**
+ * \file
+ * \brief BroadcastQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_BROADCASTQUEUE_HPP_
+#define INCLUDE_DISTORTOS_BROADCASTQUEUE_HPP_
+
+#include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
+
+#include "distortos/Semaphore.hpp"
+
+#include "estd/IntrusiveList.hpp"
+
+#include <memory>
+
+namespace distortos
+{
+
+/**
+ * \brief BroadcastQueue class is a ring of fixed-size elements, which are written once by the producer and received by
+ * any number of subscribers.
+ *
+ * Each BroadcastQueue::Subscriber has its own read position and its own semaphore on which it waits for new elements,
+ * so one stream of data (for example sensor samples) may be distributed to many threads without pushing a copy of each
+ * element to a separate queue for each of them. push() never blocks - it overwrites the oldest element in the ring.
+ * Subscriber which falls behind by more than the capacity of the ring is moved forward to the oldest element still
+ * available and the number of elements it missed is added to its lag count.
+ *
+ * Subscriber receives only elements pushed after it was constructed. All subscribers must be destroyed before the
+ * queue. The data is copied with memcpy(), so the elements should be trivially copyable. Time spent with masked
+ * interrupts in push() grows linearly with the number of subscribers.
+ *
+ * \ingroup queues
+ */
+
+class BroadcastQueue
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/// Subscriber class is a receiving end of BroadcastQueue
+	class Subscriber
+	{
+		friend class BroadcastQueue;
+
+	public:
+
+		/**
+		 * \brief Subscriber's constructor
+		 *
+		 * Subscriber is added to the list of subscribers of \a broadcastQueue and will receive elements pushed from now
+		 * on.
+		 *
+		 * \param [in] broadcastQueue is a reference to BroadcastQueue to which this object will subscribe
+		 */
+
+		explicit Subscriber(BroadcastQueue& broadcastQueue);
+
+		/**
+		 * \brief Subscriber's destructor
+		 *
+		 * Subscriber is removed from the list of subscribers.
+		 *
+		 * \warning There must be no thread waiting in any "pop" function of this object.
+		 */
+
+		~Subscriber();
+
+		/**
+		 * \return total number of elements which were overwritten before this subscriber received them
+		 */
+
+		size_t getLagCount() const;
+
+		/**
+		 * \return number of elements which can be received by this subscriber without waiting
+		 */
+
+		size_t getPendingCount() const;
+
+		/**
+		 * \brief Pops the oldest element not yet received by this subscriber.
+		 *
+		 * \warning This function must not be called from interrupt context!
+		 *
+		 * \param [out] buffer is a pointer to buffer for popped element
+		 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+		 * BroadcastQueue
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::wait();
+		 */
+
+		int pop(void* buffer, size_t size);
+
+		/**
+		 * \brief Pops the oldest element not yet received by this subscriber.
+		 *
+		 * \warning This function must not be called from interrupt context!
+		 *
+		 * \tparam T is the type of data popped from the queue
+		 *
+		 * \param [out] buffer is a reference to object that will be used to return popped value
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::wait();
+		 */
+
+		template<typename T>
+		int pop(T& buffer)
+		{
+			return pop(&buffer, sizeof(buffer));
+		}
+
+		/**
+		 * \brief Tries to pop the oldest element not yet received by this subscriber.
+		 *
+		 * \param [out] buffer is a pointer to buffer for popped element
+		 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+		 * BroadcastQueue
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::tryWait();
+		 */
+
+		int tryPop(void* buffer, size_t size);
+
+		/**
+		 * \brief Tries to pop the oldest element not yet received by this subscriber.
+		 *
+		 * \tparam T is the type of data popped from the queue
+		 *
+		 * \param [out] buffer is a reference to object that will be used to return popped value
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::tryWait();
+		 */
+
+		template<typename T>
+		int tryPop(T& buffer)
+		{
+			return tryPop(&buffer, sizeof(buffer));
+		}
+
+		/**
+		 * \brief Tries to pop the oldest element not yet received by this subscriber for a given duration of time.
+		 *
+		 * \warning This function must not be called from interrupt context!
+		 *
+		 * \param [in] duration is the duration after which the call will be terminated without popping the element
+		 * \param [out] buffer is a pointer to buffer for popped element
+		 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+		 * BroadcastQueue
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::tryWaitUntil();
+		 */
+
+		int tryPopFor(TickClock::duration duration, void* buffer, size_t size);
+
+		/**
+		 * \brief Tries to pop the oldest element not yet received by this subscriber for a given duration of time.
+		 *
+		 * Template variant of tryPopFor(TickClock::duration, void*, size_t).
+		 *
+		 * \warning This function must not be called from interrupt context!
+		 *
+		 * \tparam Rep is type of tick counter
+		 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+		 *
+		 * \param [in] duration is the duration after which the call will be terminated without popping the element
+		 * \param [out] buffer is a pointer to buffer for popped element
+		 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+		 * BroadcastQueue
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::tryWaitUntil();
+		 */
+
+		template<typename Rep, typename Period>
+		int tryPopFor(const std::chrono::duration<Rep, Period> duration, void* const buffer, const size_t size)
+		{
+			return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+		}
+
+		/**
+		 * \brief Tries to pop the oldest element not yet received by this subscriber until a given time point.
+		 *
+		 * \warning This function must not be called from interrupt context!
+		 *
+		 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+		 * \param [out] buffer is a pointer to buffer for popped element
+		 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+		 * BroadcastQueue
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::tryWaitUntil();
+		 */
+
+		int tryPopUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+
+		/**
+		 * \brief Tries to pop the oldest element not yet received by this subscriber until a given time point.
+		 *
+		 * Template variant of tryPopUntil(TickClock::time_point, void*, size_t).
+		 *
+		 * \warning This function must not be called from interrupt context!
+		 *
+		 * \tparam Duration is a std::chrono::duration type used to measure duration
+		 *
+		 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+		 * \param [out] buffer is a pointer to buffer for popped element
+		 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+		 * BroadcastQueue
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by Semaphore::tryWaitUntil();
+		 */
+
+		template<typename Duration>
+		int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void* const buffer,
+				const size_t size)
+		{
+			return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+		}
+
+		Subscriber(const Subscriber&) = delete;
+		Subscriber(Subscriber&&) = delete;
+		const Subscriber& operator=(const Subscriber&) = delete;
+		Subscriber& operator=(Subscriber&&) = delete;
+
+	private:
+
+		/**
+		 * \brief Pops the oldest element not yet received by this subscriber.
+		 *
+		 * Internal version - \a waitSemaphoreFunctor is executed with \a semaphore_ each time there is no element to
+		 * receive, so it must not use relative timeout.
+		 *
+		 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a semaphore_
+		 * \param [out] buffer is a pointer to buffer for popped element
+		 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+		 * BroadcastQueue
+		 *
+		 * \return 0 if element was popped successfully, error code otherwise:
+		 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+		 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+		 */
+
+		int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size);
+
+		/**
+		 * \brief Updates read position of this subscriber, skipping the elements which were already overwritten.
+		 *
+		 * \warning This function must be called with masked interrupts.
+		 *
+		 * \return number of elements which can be received by this subscriber without waiting
+		 */
+
+		size_t updatePendingCount();
+
+		/// node for intrusive list of subscribers
+		estd::IntrusiveListNode node_;
+
+		/// reference to BroadcastQueue to which this object is subscribed
+		BroadcastQueue& broadcastQueue_;
+
+		/// binary semaphore posted by BroadcastQueue::push(), used to wake thread waiting in "pop" functions
+		Semaphore semaphore_;
+
+		/// total number of elements which were overwritten before this subscriber received them
+		size_t lagCount_;
+
+		/// number of elements pushed to BroadcastQueue which were already received or skipped by this subscriber
+		size_t readSequence_;
+	};
+
+	/**
+	 * \brief BroadcastQueue's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for queue elements
+	 * (sufficiently large for \a maxElements elements, each \a elementSize bytes long) and appropriate deleter
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] maxElements is the number of elements in storage, each subscriber can lag behind the producer by at
+	 * most that many elements
+	 */
+
+	BroadcastQueue(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements);
+
+	/**
+	 * \return maximum number of elements in queue
+	 */
+
+	size_t getCapacity() const
+	{
+		return maxElements_;
+	}
+
+	/**
+	 * \return size of single queue element, bytes
+	 */
+
+	size_t getElementSize() const
+	{
+		return elementSize_;
+	}
+
+	/**
+	 * \brief Pushes the element to the queue.
+	 *
+	 * The element is written once - overwriting the oldest one - and becomes available to all current subscribers,
+	 * threads waiting in their "pop" functions are woken. This function never blocks.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to BroadcastQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of BroadcastQueue
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of BroadcastQueue;
+	 */
+
+	int push(const void* data, size_t size);
+
+	/**
+	 * \brief Pushes the element to the queue.
+	 *
+	 * The element is written once - overwriting the oldest one - and becomes available to all current subscribers,
+	 * threads waiting in their "pop" functions are woken. This function never blocks.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a reference to data that will be pushed to BroadcastQueue
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of BroadcastQueue;
+	 */
+
+	template<typename T>
+	int push(const T& data)
+	{
+		return push(&data, sizeof(data));
+	}
+
+	BroadcastQueue(const BroadcastQueue&) = delete;
+	BroadcastQueue(BroadcastQueue&&) = delete;
+	const BroadcastQueue& operator=(const BroadcastQueue&) = delete;
+	BroadcastQueue& operator=(BroadcastQueue&&) = delete;
+
+private:
+
+	/// type of intrusive list of subscribers
+	using SubscriberList = estd::IntrusiveList<Subscriber, &Subscriber::node_>;
+
+	/// storage for queue elements
+	const StorageUniquePointer storageUniquePointer_;
+
+	/// list of subscribers
+	SubscriberList subscribers_;
+
+	/// size of single queue element, bytes
+	const size_t elementSize_;
+
+	/// maximum number of elements in queue
+	const size_t maxElements_;
+
+	/// index of element which will be written by next push()
+	size_t writeIndex_;
+
+	/// number of elements pushed since the queue was constructed
+	size_t writeSequence_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_BROADCASTQUEUE_HPP_
@@ -0,0 +1,373 @@
+/**
+ * \file
+ * \brief BufferLoanQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_BUFFERLOANQUEUE_HPP_
+#define INCLUDE_DISTORTOS_BUFFERLOANQUEUE_HPP_
+
+#include "distortos/internal/synchronization/FifoQueueBase.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief BufferLoanQueue class is a zero-copy channel which transfers buffers from a fixed pool.
+ *
+ * Instead of copying elements into the queue and back out, the producer acquires a free buffer from the pool, fills it
+ * in place and sends it. The consumer receives the same buffer, uses it in place and releases it back to the pool. Only
+ * the pointer to the buffer is transferred, so the cost of the operation doesn't depend on the size of buffers.
+ *
+ * Both the pool of free buffers and the queue of sent buffers are FIFO queues of pointers, so all variants of blocking
+ * (blocking, non-blocking, with timeout) known from FifoQueue are available for acquire() and receive(). send() and
+ * release() never block, as there is always enough space for all buffers of the pool - both can be used from interrupt
+ * context, just like tryAcquire() and tryReceive().
+ *
+ * \warning Each acquired buffer must be passed to exactly one send() or release() and each received buffer - to exactly
+ * one release(). The buffer must not be accessed after it is passed to these functions.
+ *
+ * \ingroup queues
+ */
+
+class BufferLoanQueue
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = internal::FifoQueueBase::StorageUniquePointer;
+
+	/**
+	 * \brief BufferLoanQueue's constructor
+	 *
+	 * \param [in] buffersStorageUniquePointer is a rvalue reference to StorageUniquePointer with storage for buffers
+	 * (sufficiently large for \a buffersCount, each \a bufferSize bytes long) and appropriate deleter
+	 * \param [in] handlesStorageUniquePointer is a rvalue reference to StorageUniquePointer with storage for pointers to
+	 * buffers (sufficiently large for 2 * \a buffersCount elements of type void*) and appropriate deleter
+	 * \param [in] bufferSize is the size of single buffer, bytes
+	 * \param [in] buffersCount is the number of buffers in the pool
+	 */
+
+	BufferLoanQueue(StorageUniquePointer&& buffersStorageUniquePointer,
+			StorageUniquePointer&& handlesStorageUniquePointer, size_t bufferSize, size_t buffersCount);
+
+	/**
+	 * \brief Acquires a free buffer from the pool.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a reference to variable in which pointer to acquired buffer will be returned
+	 *
+	 * \return 0 if buffer was acquired successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int acquire(void*& buffer);
+
+	/**
+	 * \return size of single buffer, bytes
+	 */
+
+	size_t getBufferSize() const
+	{
+		return bufferSize_;
+	}
+
+	/**
+	 * \return number of buffers in the pool
+	 */
+
+	size_t getCapacity() const
+	{
+		return freeQueue_.getCapacity();
+	}
+
+	/**
+	 * \brief Receives the oldest (first) buffer sent to the queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a reference to variable in which pointer to received buffer will be returned
+	 *
+	 * \return 0 if buffer was received successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int receive(void*& buffer);
+
+	/**
+	 * \brief Releases the buffer back to the pool.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] buffer is a pointer to buffer previously returned by one of acquire() or receive() functions
+	 *
+	 * \return 0 if buffer was released successfully, error code otherwise:
+	 * - EINVAL - \a buffer is not a buffer from this pool;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release(void* buffer);
+
+	/**
+	 * \brief Sends the buffer to the queue.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] buffer is a pointer to buffer previously returned by one of acquire() functions
+	 *
+	 * \return 0 if buffer was sent successfully, error code otherwise:
+	 * - EINVAL - \a buffer is not a buffer from this pool;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int send(void* buffer);
+
+	/**
+	 * \brief Tries to acquire a free buffer from the pool.
+	 *
+	 * \param [out] buffer is a reference to variable in which pointer to acquired buffer will be returned
+	 *
+	 * \return 0 if buffer was acquired successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryAcquire(void*& buffer);
+
+	/**
+	 * \brief Tries to acquire a free buffer from the pool for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without acquiring the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to acquired buffer will be returned
+	 *
+	 * \return 0 if buffer was acquired successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryAcquireFor(TickClock::duration duration, void*& buffer);
+
+	/**
+	 * \brief Tries to acquire a free buffer from the pool for a given duration of time.
+	 *
+	 * Template variant of tryAcquireFor(TickClock::duration, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without acquiring the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to acquired buffer will be returned
+	 *
+	 * \return 0 if buffer was acquired successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryAcquireFor(const std::chrono::duration<Rep, Period> duration, void*& buffer)
+	{
+		return tryAcquireFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer);
+	}
+
+	/**
+	 * \brief Tries to acquire a free buffer from the pool until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without acquiring the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to acquired buffer will be returned
+	 *
+	 * \return 0 if buffer was acquired successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryAcquireUntil(TickClock::time_point timePoint, void*& buffer);
+
+	/**
+	 * \brief Tries to acquire a free buffer from the pool until a given time point.
+	 *
+	 * Template variant of tryAcquireUntil(TickClock::time_point, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without acquiring the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to acquired buffer will be returned
+	 *
+	 * \return 0 if buffer was acquired successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryAcquireUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& buffer)
+	{
+		return tryAcquireUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer);
+	}
+
+	/**
+	 * \brief Tries to receive the oldest (first) buffer sent to the queue.
+	 *
+	 * \param [out] buffer is a reference to variable in which pointer to received buffer will be returned
+	 *
+	 * \return 0 if buffer was received successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryReceive(void*& buffer);
+
+	/**
+	 * \brief Tries to receive the oldest (first) buffer sent to the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without receiving the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to received buffer will be returned
+	 *
+	 * \return 0 if buffer was received successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryReceiveFor(TickClock::duration duration, void*& buffer);
+
+	/**
+	 * \brief Tries to receive the oldest (first) buffer sent to the queue for a given duration of time.
+	 *
+	 * Template variant of tryReceiveFor(TickClock::duration, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without receiving the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to received buffer will be returned
+	 *
+	 * \return 0 if buffer was received successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryReceiveFor(const std::chrono::duration<Rep, Period> duration, void*& buffer)
+	{
+		return tryReceiveFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer);
+	}
+
+	/**
+	 * \brief Tries to receive the oldest (first) buffer sent to the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without receiving the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to received buffer will be returned
+	 *
+	 * \return 0 if buffer was received successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryReceiveUntil(TickClock::time_point timePoint, void*& buffer);
+
+	/**
+	 * \brief Tries to receive the oldest (first) buffer sent to the queue until a given time point.
+	 *
+	 * Template variant of tryReceiveUntil(TickClock::time_point, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without receiving the buffer
+	 * \param [out] buffer is a reference to variable in which pointer to received buffer will be returned
+	 *
+	 * \return 0 if buffer was received successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryReceiveUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& buffer)
+	{
+		return tryReceiveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer);
+	}
+
+	BufferLoanQueue(const BufferLoanQueue&) = delete;
+	BufferLoanQueue(BufferLoanQueue&&) = delete;
+	const BufferLoanQueue& operator=(const BufferLoanQueue&) = delete;
+	BufferLoanQueue& operator=(BufferLoanQueue&&) = delete;
+
+private:
+
+	/**
+	 * \param [in] buffer is a pointer to buffer which will be checked
+	 *
+	 * \return true if \a buffer is a buffer from this pool, false otherwise
+	 */
+
+	bool isValidBuffer(const void* buffer) const;
+
+	/**
+	 * \brief Pops pointer to buffer from one of internal queues.
+	 *
+	 * \param [in] fifoQueueBase is a reference to internal queue from which the pointer will be popped
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * of \a fifoQueueBase
+	 * \param [out] buffer is a reference to variable in which popped pointer to buffer will be returned
+	 *
+	 * \return 0 if pointer to buffer was popped successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	static int popInternal(internal::FifoQueueBase& fifoQueueBase,
+			const internal::SemaphoreFunctor& waitSemaphoreFunctor, void*& buffer);
+
+	/**
+	 * \brief Pushes pointer to buffer to one of internal queues.
+	 *
+	 * \param [in] fifoQueueBase is a reference to internal queue to which the pointer will be pushed
+	 * \param [in] buffer is a pointer to buffer which will be pushed
+	 *
+	 * \return 0 if pointer to buffer was pushed successfully, error code otherwise:
+	 * - EINVAL - \a buffer is not a buffer from this pool;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushInternal(internal::FifoQueueBase& fifoQueueBase, void* buffer);
+
+	/// storage for buffers
+	const StorageUniquePointer buffersStorageUniquePointer_;
+
+	/// queue with pointers to sent buffers, uses second half of storage for pointers to buffers
+	internal::FifoQueueBase sentQueue_;
+
+	/// queue with pointers to free buffers, owns storage for pointers to buffers
+	internal::FifoQueueBase freeQueue_;
+
+	/// size of single buffer, bytes
+	const size_t bufferSize_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_BUFFERLOANQUEUE_HPP_
@@ -12,7 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_C_API_CONDITIONVARIABLE_H_
 #define INCLUDE_DISTORTOS_C_API_CONDITIONVARIABLE_H_
 
-#include "estd/C-API/IntrusiveList.h"
+#include "distortos/C-API/ThreadWaitQueue.h"
 
 #include <stdint.h>
 
@@ -44,7 +44,7 @@ struct distortos_Mutex;
 struct distortos_ConditionVariable
 {
 	/** ThreadControlBlock objects blocked on this condition variable */
-	struct estd_IntrusiveList blockedList;
+	struct distortos_ThreadWaitQueue blockedList;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -59,7 +59,7 @@ struct distortos_ConditionVariable
  * \param [in] self is an equivalent of `this` hidden argument
  */
 
-#define DISTORTOS_CONDITIONVARIABLE_INITIALIZER(self)	{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList)}
+#define DISTORTOS_CONDITIONVARIABLE_INITIALIZER(self)	{DISTORTOS_THREADWAITQUEUE_INITIALIZER((self).blockedList)}
 
 /**
  * \brief C-API equivalent of distortos::ConditionVariable's constructor
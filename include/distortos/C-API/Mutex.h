@@ -2,7 +2,7 @@
  * \file
  * \brief Header of C-API for distortos::Mutex
  *
- * \author Copyright (C) 2017-2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,13 @@
 #ifndef INCLUDE_DISTORTOS_C_API_MUTEX_H_
 #define INCLUDE_DISTORTOS_C_API_MUTEX_H_
 
-#include "estd/C-API/IntrusiveList.h"
+#include "distortos/distortosConfiguration.h"
 
+#include "distortos/C-API/ThreadWaitQueue.h"
+
+#include "estd/C-API/IntrusiveListNode.h"
+
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -45,8 +50,50 @@ struct distortos_Mutex
 	/** node for intrusive list */
 	struct estd_IntrusiveListNode node;
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	/** node for intrusive list of profiled mutexes */
+	struct estd_IntrusiveListNode profiledMutexNode;
+
+	/** counters and durations of acquisitions, waits and holds of the mutex */
+	struct
+	{
+		/** time point of last acquisition of the mutex */
+		int64_t lockTimePoint;
+
+		/** accumulated statistics */
+		struct
+		{
+			/** number of acquisitions of the mutex */
+			size_t acquisitions;
+
+			/** number of acquisitions of the mutex which required blocking of the calling thread */
+			size_t contendedAcquisitions;
+
+			/** max duration for which the mutex was held */
+			int64_t maxHoldTime;
+
+			/** max duration of single wait for the mutex */
+			int64_t maxWaitTime;
+
+			/** address of the mutex */
+			const void* mutex;
+
+			/** number of threads which boosted priority of owner of the mutex when blocking on it */
+			size_t priorityInheritanceBoosts;
+
+			/** sum of durations for which the mutex was held */
+			int64_t totalHoldTime;
+
+			/** sum of durations of all waits for the mutex */
+			int64_t totalWaitTime;
+		} statistics;
+	} profile;
+
+#endif	/* DISTORTOS_MUTEX_PROFILING_ENABLE == 1 */
+
 	/** ThreadControlBlock objects blocked on mutex */
-	struct estd_IntrusiveList blockedList;
+	struct distortos_ThreadWaitQueue blockedList;
 
 	/** owner of the mutex */
 	void* owner;
@@ -101,6 +148,21 @@ enum
 | global defines
 +---------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * \brief Initializer for fields of distortos_Mutex used by mutex profiling
+ *
+ * Expands to nothing when mutex profiling is disabled.
+ *
+ * \param [in] self is an equivalent of `this` hidden argument
+ */
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+#define DISTORTOS_MUTEX_PROFILING_INITIALIZER(self)	\
+		ESTD_INTRUSIVELISTNODE_INITIALIZER((self).profiledMutexNode), {0, {0, 0, 0, 0, NULL, 0, 0, 0}},
+#else	/* DISTORTOS_MUTEX_PROFILING_ENABLE != 1 */
+#define DISTORTOS_MUTEX_PROFILING_INITIALIZER(self)
+#endif	/* DISTORTOS_MUTEX_PROFILING_ENABLE != 1 */
+
 /**
  * \brief Initializer for distortos_Mutex
  *
@@ -116,8 +178,8 @@ enum
  */
 
 #define DISTORTOS_MUTEX_INITIALIZER(self, type, protocol, priorityCeiling) \
-		{ESTD_INTRUSIVELISTNODE_INITIALIZER((self).node), ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), \
-		NULL, 0, (priorityCeiling), \
+		{ESTD_INTRUSIVELISTNODE_INITIALIZER((self).node), DISTORTOS_MUTEX_PROFILING_INITIALIZER(self) \
+		DISTORTOS_THREADWAITQUEUE_INITIALIZER((self).blockedList), NULL, 0, (priorityCeiling), \
 		(uint8_t)(((type) == distortos_Mutex_Type_normal || (type) == distortos_Mutex_Type_errorChecking || \
 				(type) == distortos_Mutex_Type_recursive ? \
 				(uint8_t)(type) : (uint8_t)distortos_Mutex_Type_normal) << distortos_Mutex_typeShift | \
@@ -12,7 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_C_API_SEMAPHORE_H_
 #define INCLUDE_DISTORTOS_C_API_SEMAPHORE_H_
 
-#include "estd/C-API/IntrusiveList.h"
+#include "distortos/C-API/ThreadWaitQueue.h"
 
 #include <limits.h>
 #include <stdint.h>
@@ -42,7 +42,7 @@ extern "C"
 struct distortos_Semaphore
 {
 	/** ThreadControlBlock objects blocked on this semaphore */
-	struct estd_IntrusiveList blockedList;
+	struct distortos_ThreadWaitQueue blockedList;
 
 	/** internal value of the semaphore */
 	unsigned int value;
@@ -67,7 +67,7 @@ struct distortos_Semaphore
  */
 
 #define DISTORTOS_SEMAPHORE_INITIALIZER(self, value, maxValue) \
-		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue)}
+		{DISTORTOS_THREADWAITQUEUE_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue)}
 
 /**
  * \brief C-API equivalent of distortos::Semaphore's constructor
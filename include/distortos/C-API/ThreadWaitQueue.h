@@ -0,0 +1,86 @@
+/**
+ * \file
+ * \brief C-API for distortos::internal::ThreadWaitQueue
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_C_API_THREADWAITQUEUE_H_
+#define INCLUDE_DISTORTOS_C_API_THREADWAITQUEUE_H_
+
+#include "distortos/distortosConfiguration.h"
+
+#include "estd/C-API/IntrusiveList.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif	/* def __cplusplus */
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+/**
+ * \brief C-API equivalent of distortos::internal::ThreadWaitQueue (distortos::internal::ThreadPriorityQueue)
+ *
+ * \sa distortos::internal::ThreadPriorityQueue
+ */
+
+struct distortos_ThreadWaitQueue
+{
+	/** storage for buckets, constructed lazily */
+	struct estd_IntrusiveList buckets[DISTORTOS_WAIT_QUEUE_PRIORITY_BUCKETS];
+
+	/** bitmap of buckets which may be non-empty */
+	uint32_t bitmap[(DISTORTOS_WAIT_QUEUE_PRIORITY_BUCKETS + 31) / 32];
+};
+
+#else	/* DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE != 1 */
+
+/**
+ * \brief C-API equivalent of distortos::internal::ThreadWaitQueue (distortos::internal::ThreadList)
+ *
+ * \sa distortos::internal::ThreadList
+ */
+
+struct distortos_ThreadWaitQueue
+{
+	/** intrusive list of threads */
+	struct estd_IntrusiveList list;
+};
+
+#endif	/* DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE != 1 */
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global defines
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Initializer for distortos_ThreadWaitQueue
+ *
+ * \sa distortos::internal::ThreadList::ThreadList()
+ * \sa distortos::internal::ThreadPriorityQueue::ThreadPriorityQueue()
+ *
+ * \param [in] self is an equivalent of `this` hidden argument
+ */
+
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+#define DISTORTOS_THREADWAITQUEUE_INITIALIZER(self)	{{{{0, 0}}}, {0}}
+#else	/* DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE != 1 */
+#define DISTORTOS_THREADWAITQUEUE_INITIALIZER(self)	{ESTD_INTRUSIVELIST_INITIALIZER((self).list)}
+#endif	/* DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE != 1 */
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif	/* def __cplusplus */
+
+#endif	/* INCLUDE_DISTORTOS_C_API_THREADWAITQUEUE_H_ */
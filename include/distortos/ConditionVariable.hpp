@@ -12,7 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_CONDITIONVARIABLE_HPP_
 #define INCLUDE_DISTORTOS_CONDITIONVARIABLE_HPP_
 
-#include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/internal/scheduler/ThreadWaitQueue.hpp"
 
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
@@ -303,7 +303,7 @@ public:
 private:
 
 	/// ThreadControlBlock objects blocked on this condition variable
-	internal::ThreadList blockedList_;
+	internal::ThreadWaitQueue blockedList_;
 };
 
 template<typename Predicate>
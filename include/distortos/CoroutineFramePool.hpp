@@ -0,0 +1,117 @@
+/**
+ * \file
+ * \brief CoroutineFramePool class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_COROUTINEFRAMEPOOL_HPP_
+#define INCLUDE_DISTORTOS_COROUTINEFRAMEPOOL_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+/**
+ * \brief CoroutineFramePool class is a pool of fixed-size memory blocks for frames of coroutines.
+ *
+ * Allocation and deallocation are O(1) and never touch the heap. All blocks have the same size, so the pool should be
+ * sized for the largest coroutine frame that will be allocated from it.
+ *
+ * Allocation and deallocation are safe to use from any thread and from interrupt context.
+ *
+ * \ingroup threads
+ */
+
+class CoroutineFramePool
+{
+public:
+
+	/**
+	 * \brief CoroutineFramePool's constructor
+	 *
+	 * \param [in] storage is a pointer to storage for blocks, must be aligned to alignof(std::max_align_t)
+	 * \param [in] storageSize is the size of \a storage, bytes
+	 * \param [in] blockSize is the size of single block, bytes, rounded up to a multiple of
+	 * alignof(std::max_align_t)
+	 */
+
+	CoroutineFramePool(void* storage, size_t storageSize, size_t blockSize);
+
+	/**
+	 * \brief Allocates one block from the pool.
+	 *
+	 * \param [in] size is the requested size, bytes
+	 *
+	 * \return pointer to allocated block, nullptr if \a size is larger than size of block or if the pool is exhausted
+	 */
+
+	void* allocate(size_t size);
+
+	/**
+	 * \brief Returns block to the pool.
+	 *
+	 * \param [in] block is a pointer to block previously allocated from this pool, nullptr is ignored
+	 */
+
+	void deallocate(void* block);
+
+	/**
+	 * \return size of single block, bytes
+	 */
+
+	size_t getBlockSize() const
+	{
+		return blockSize_;
+	}
+
+	/**
+	 * \return total number of blocks in the pool
+	 */
+
+	size_t getCapacity() const
+	{
+		return capacity_;
+	}
+
+	/**
+	 * \return number of blocks that are currently not allocated
+	 */
+
+	size_t getFreeBlocks() const;
+
+	CoroutineFramePool(const CoroutineFramePool&) = delete;
+	CoroutineFramePool(CoroutineFramePool&&) = delete;
+	const CoroutineFramePool& operator=(const CoroutineFramePool&) = delete;
+	CoroutineFramePool& operator=(CoroutineFramePool&&) = delete;
+
+private:
+
+	/// free block, used to link free blocks into singly-linked list
+	struct FreeBlock
+	{
+		/// pointer to next free block, nullptr if this is the last one
+		FreeBlock* next;
+	};
+
+	/// pointer to first free block, nullptr if the pool is exhausted
+	FreeBlock* freeList_;
+
+	/// size of single block, bytes
+	size_t blockSize_;
+
+	/// total number of blocks in the pool
+	size_t capacity_;
+
+	/// number of blocks that are currently not allocated
+	size_t freeBlocks_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_COROUTINEFRAMEPOOL_HPP_
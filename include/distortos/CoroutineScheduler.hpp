@@ -0,0 +1,267 @@
+/**
+ * \file
+ * \brief CoroutineScheduler class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_COROUTINESCHEDULER_HPP_
+#define INCLUDE_DISTORTOS_COROUTINESCHEDULER_HPP_
+
+#include "distortos/internal/coroutines/CoroutineAwaiter.hpp"
+
+#include "distortos/Semaphore.hpp"
+
+#include <algorithm>
+#include <cerrno>
+
+namespace distortos
+{
+
+/**
+ * \brief CoroutineScheduler class runs many coroutine tasks on a single thread.
+ *
+ * Coroutine tasks are resumed in FIFO order from the thread that calls run(). Tasks suspended in awaitables from
+ * coroutineAwaitables.hpp are polled each time the scheduler wakes up. When no task is ready, the thread blocks until
+ * the nearest deadline of suspended awaitables, but no longer than "poll period" if any of them waits for a kernel
+ * object. notify() can be used (also from interrupt context) to wake the scheduler earlier, e.g. after posting a
+ * semaphore on which a coroutine task is waiting.
+ *
+ * Kernel objects don't resume coroutine tasks by themselves - each wake-up of the scheduler calls poll() of every
+ * suspended awaitable, so its cost is O(number of suspended awaitables). With the default poll period of 1 tick this
+ * cost is paid in each tick as long as any awaitable waits for a kernel object, and the latency between a change of
+ * the kernel object and the resumption of the coroutine task is up to one poll period. With hundreds of suspended
+ * coroutine tasks it is better to use longer poll period (or disable periodic polling with
+ * TickClock::duration::max()) and call notify() wherever the awaited kernel objects are changed - then the latency
+ * is determined by notify() and the polling cost is paid only when something actually happened.
+ *
+ * All coroutine tasks share the thread of the scheduler, so they must never call blocking functions directly - only
+ * via `co_await`. A mutex locked by one coroutine task is owned by the thread of the scheduler, so only mutexes of
+ * normal type can be used with asyncLock() - other types are rejected with EINVAL.
+ *
+ * \note Requires C++20.
+ *
+ * \ingroup threads
+ */
+
+class CoroutineScheduler
+{
+public:
+
+	/**
+	 * \brief CoroutineScheduler's constructor
+	 *
+	 * \param [in] pollPeriod is the maximum duration between consecutive polls of awaitables waiting for kernel
+	 * objects - each poll costs O(number of suspended awaitables) and it is also the worst-case latency of resumption
+	 * when notify() is not used, TickClock::duration::max() disables periodic polling, default - 1 tick
+	 */
+
+	constexpr explicit CoroutineScheduler(const TickClock::duration pollPeriod = TickClock::duration{1}) :
+			readyList_{},
+			waitingList_{},
+			wakeSemaphore_{0, 1},
+			pollPeriod_{pollPeriod},
+			tasksCount_{}
+	{
+
+	}
+
+	/**
+	 * \brief CoroutineScheduler's destructor
+	 *
+	 * Destroys all coroutine tasks which were not finished.
+	 */
+
+	~CoroutineScheduler()
+	{
+		while (waitingList_.empty() == false)
+		{
+			auto& awaiter = waitingList_.front();
+			waitingList_.pop_front();
+			readyList_.push_back(awaiter.getPromise());
+		}
+		while (readyList_.empty() == false)
+		{
+			auto& promise = readyList_.front();
+			readyList_.pop_front();
+			CoroutineTask::Handle::from_promise(promise).destroy();
+		}
+	}
+
+	/**
+	 * \brief Adds coroutine task to the scheduler.
+	 *
+	 * The task will be started during next iteration of run().
+	 *
+	 * \warning This function must be called from the thread executing run() (for example from a coroutine task) or
+	 * before run() is called!
+	 *
+	 * \param [in] task is a rvalue reference to CoroutineTask which will be transferred to the scheduler
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - ENOMEM - \a task is invalid, most likely because allocation of its frame failed;
+	 */
+
+	int add(CoroutineTask&& task)
+	{
+		const auto handle = task.release();
+		if (!handle)
+			return ENOMEM;
+
+		auto& promise = handle.promise();
+		promise.setScheduler(*this);
+		readyList_.push_back(promise);
+		++tasksCount_;
+		return 0;
+	}
+
+	/**
+	 * \return number of coroutine tasks which were added to the scheduler and are not finished yet
+	 */
+
+	size_t getTasksCount() const
+	{
+		return tasksCount_;
+	}
+
+	/**
+	 * \brief Wakes the scheduler, so that all suspended awaitables are polled as soon as possible.
+	 *
+	 * \note This function can be used from interrupt context.
+	 */
+
+	void notify()
+	{
+		wakeSemaphore_.post();
+	}
+
+	/**
+	 * \brief Executes coroutine tasks until all of them are finished.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 when all coroutine tasks are finished, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 */
+
+	int run()
+	{
+		while (tasksCount_ != 0)
+		{
+			while (readyList_.empty() == false)
+			{
+				auto& promise = readyList_.front();
+				readyList_.pop_front();
+				const auto handle = CoroutineTask::Handle::from_promise(promise);
+				handle.resume();
+				if (handle.done() == true)
+				{
+					handle.destroy();
+					--tasksCount_;
+				}
+			}
+
+			const auto now = TickClock::now();
+			auto wakeUpTimePoint = TickClock::time_point::max();
+			for (auto iterator = waitingList_.begin(); iterator != waitingList_.end();)
+			{
+				auto& awaiter = *iterator;
+				const auto completed = awaiter.poll() == true;
+				if (completed == false && awaiter.getDeadline() > now)
+				{
+					// deadline is compared with duration, so that "now + pollPeriod_" cannot overflow
+					wakeUpTimePoint = std::min(wakeUpTimePoint, awaiter.isPollable() == true &&
+							awaiter.getDeadline() - now > pollPeriod_ ? now + pollPeriod_ : awaiter.getDeadline());
+					++iterator;
+					continue;
+				}
+
+				if (completed == false)
+					awaiter.expire();
+				iterator = waitingList_.erase(iterator);
+				readyList_.push_back(awaiter.getPromise());
+			}
+
+			if (readyList_.empty() == false || tasksCount_ == 0)
+				continue;
+
+			const auto ret = wakeUpTimePoint != TickClock::time_point::max() ?
+					wakeSemaphore_.tryWaitUntil(wakeUpTimePoint) : wakeSemaphore_.wait();
+			if (ret == EINTR)
+				return ret;
+		}
+
+		return 0;
+	}
+
+	/**
+	 * \brief Suspends coroutine task waiting for completion of awaiter.
+	 *
+	 * \attention This function should be called only by internal::CoroutineAwaiter::await_suspend().
+	 *
+	 * \param [in] awaiter is a reference to awaiter which suspends coroutine task
+	 */
+
+	void suspend(internal::CoroutineAwaiter& awaiter)
+	{
+		waitingList_.push_back(awaiter);
+	}
+
+	/**
+	 * \brief Suspends coroutine task, moving it to the end of the list of ready tasks.
+	 *
+	 * \attention This function should be called only by awaitable returned by asyncYield().
+	 *
+	 * \param [in] promise is a reference to promise of coroutine task
+	 */
+
+	void yield(CoroutineTask::promise_type& promise)
+	{
+		readyList_.push_back(promise);
+	}
+
+	CoroutineScheduler(const CoroutineScheduler&) = delete;
+	CoroutineScheduler(CoroutineScheduler&&) = delete;
+	const CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+	CoroutineScheduler& operator=(CoroutineScheduler&&) = delete;
+
+private:
+
+	/// list of coroutine tasks which are ready to be resumed
+	estd::IntrusiveList<CoroutineTask::promise_type, &CoroutineTask::promise_type::node> readyList_;
+
+	/// list of awaiters of suspended coroutine tasks
+	estd::IntrusiveList<internal::CoroutineAwaiter, &internal::CoroutineAwaiter::node> waitingList_;
+
+	/// semaphore used to block the thread of the scheduler when no coroutine task is ready
+	Semaphore wakeSemaphore_;
+
+	/// maximum duration between consecutive polls of awaitables waiting for kernel objects
+	TickClock::duration pollPeriod_;
+
+	/// number of coroutine tasks which were added to the scheduler and are not finished yet
+	size_t tasksCount_;
+};
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+inline void CoroutineAwaiter::await_suspend(const CoroutineTask::Handle handle)
+{
+	promise_ = &handle.promise();
+	promise_->getScheduler()->suspend(*this);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_COROUTINESCHEDULER_HPP_
@@ -0,0 +1,301 @@
+/**
+ * \file
+ * \brief CoroutineTask class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_COROUTINETASK_HPP_
+#define INCLUDE_DISTORTOS_COROUTINETASK_HPP_
+
+#if !defined(__cpp_impl_coroutine)
+#error "Coroutine tasks require C++20 coroutines (-std=c++20 or newer)"
+#endif	// !defined(__cpp_impl_coroutine)
+
+#include "distortos/CoroutineFramePool.hpp"
+
+#include "distortos/FATAL_ERROR.h"
+
+#include "estd/IntrusiveList.hpp"
+
+#include <coroutine>
+#include <cstdint>
+#include <new>
+
+namespace distortos
+{
+
+class CoroutineScheduler;
+
+/**
+ * \brief CoroutineTask class is a handle to stackless coroutine which can be executed by CoroutineScheduler.
+ *
+ * Any function returning CoroutineTask and using `co_await` or `co_return` is a coroutine task. Its frame is allocated
+ * with `::operator new(std::nothrow)` or - if the first argument of the coroutine is a reference to
+ * CoroutineFramePool - from this pool. If the allocation fails, returned CoroutineTask is invalid and
+ * CoroutineScheduler::add() will reject it.
+ *
+ * Coroutine task is created suspended and it starts executing only after it is added to CoroutineScheduler. When the
+ * task finishes, its frame is destroyed by the scheduler.
+ *
+ * \note Requires C++20.
+ *
+ * \ingroup threads
+ */
+
+class CoroutineTask
+{
+public:
+
+	/// promise of coroutine task
+	class promise_type
+	{
+	public:
+
+		/**
+		 * \brief promise_type's constructor
+		 */
+
+		constexpr promise_type() :
+				node{},
+				scheduler_{}
+		{
+
+		}
+
+		/**
+		 * \return CoroutineTask associated with this promise
+		 */
+
+		CoroutineTask get_return_object()
+		{
+			return CoroutineTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+		}
+
+		/**
+		 * \return invalid CoroutineTask, used when allocation of coroutine frame fails
+		 */
+
+		static CoroutineTask get_return_object_on_allocation_failure()
+		{
+			return CoroutineTask{};
+		}
+
+		/**
+		 * \return pointer to CoroutineScheduler executing this coroutine task, nullptr if the task was not added to
+		 * any scheduler
+		 */
+
+		CoroutineScheduler* getScheduler() const
+		{
+			return scheduler_;
+		}
+
+		/**
+		 * \return coroutine task is created suspended
+		 */
+
+		std::suspend_always initial_suspend() const
+		{
+			return {};
+		}
+
+		/**
+		 * \return finished coroutine task stays suspended until it is destroyed by scheduler
+		 */
+
+		std::suspend_always final_suspend() const noexcept
+		{
+			return {};
+		}
+
+		/**
+		 * \brief Handles `co_return;` of coroutine task.
+		 */
+
+		void return_void() const
+		{
+
+		}
+
+		/**
+		 * \brief Sets CoroutineScheduler which executes this coroutine task.
+		 *
+		 * \param [in] scheduler is a reference to CoroutineScheduler which executes this coroutine task
+		 */
+
+		void setScheduler(CoroutineScheduler& scheduler)
+		{
+			scheduler_ = &scheduler;
+		}
+
+		/**
+		 * \brief Handles exception escaping from coroutine task.
+		 *
+		 * Exceptions are not supported, so FATAL_ERROR() is called.
+		 */
+
+		void unhandled_exception() const
+		{
+			FATAL_ERROR("Unhandled exception in coroutine task!");
+		}
+
+		/**
+		 * \brief Allocates frame of coroutine task with `::operator new(std::nothrow)`.
+		 *
+		 * \param [in] size is the size of coroutine frame, bytes
+		 *
+		 * \return pointer to allocated frame, nullptr on failure
+		 */
+
+		static void* operator new(const size_t size) noexcept
+		{
+			return allocateFrame(nullptr, size);
+		}
+
+		/**
+		 * \brief Allocates frame of coroutine task from CoroutineFramePool.
+		 *
+		 * This overload is selected for coroutines which take reference to CoroutineFramePool as the first argument.
+		 *
+		 * \tparam Args are types of remaining arguments of coroutine
+		 *
+		 * \param [in] size is the size of coroutine frame, bytes
+		 * \param [in] pool is a reference to CoroutineFramePool from which the frame will be allocated
+		 *
+		 * \return pointer to allocated frame, nullptr on failure
+		 */
+
+		template<typename... Args>
+		static void* operator new(const size_t size, CoroutineFramePool& pool, Args&...) noexcept
+		{
+			return allocateFrame(&pool, size);
+		}
+
+		/**
+		 * \brief Deallocates frame of coroutine task.
+		 *
+		 * \param [in] frame is a pointer to frame of coroutine task
+		 */
+
+		static void operator delete(void* const frame)
+		{
+			const auto block = static_cast<uint8_t*>(frame) - frameHeaderSize;
+			const auto pool = *reinterpret_cast<CoroutineFramePool**>(block);
+			if (pool != nullptr)
+				pool->deallocate(block);
+			else
+				::operator delete(block);
+		}
+
+		/// node for intrusive lists of CoroutineScheduler
+		estd::IntrusiveListNode node;
+
+	private:
+
+		/// size of header preceding each coroutine frame, which holds pointer to pool used for the allocation
+		constexpr static size_t frameHeaderSize {alignof(std::max_align_t)};
+
+		/**
+		 * \brief Allocates frame of coroutine task.
+		 *
+		 * \param [in] pool is a pointer to CoroutineFramePool from which the frame will be allocated, nullptr to use
+		 * `::operator new(std::nothrow)`
+		 * \param [in] size is the size of coroutine frame, bytes
+		 *
+		 * \return pointer to allocated frame, nullptr on failure
+		 */
+
+		static void* allocateFrame(CoroutineFramePool* const pool, const size_t size)
+		{
+			const auto totalSize = size + frameHeaderSize;
+			const auto block = pool != nullptr ? pool->allocate(totalSize) : ::operator new(totalSize, std::nothrow);
+			if (block == nullptr)
+				return {};
+
+			*static_cast<CoroutineFramePool**>(block) = pool;
+			return static_cast<uint8_t*>(block) + frameHeaderSize;
+		}
+
+		/// pointer to CoroutineScheduler executing this coroutine task
+		CoroutineScheduler* scheduler_;
+	};
+
+	/// handle of coroutine task
+	using Handle = std::coroutine_handle<promise_type>;
+
+	/**
+	 * \brief CoroutineTask's constructor
+	 *
+	 * \param [in] handle is the handle of coroutine task, default - invalid handle
+	 */
+
+	constexpr explicit CoroutineTask(const Handle handle = {}) :
+			handle_{handle}
+	{
+
+	}
+
+	/**
+	 * \brief CoroutineTask's move constructor
+	 *
+	 * \param [in] other is a reference to CoroutineTask object used as source of move construction
+	 */
+
+	CoroutineTask(CoroutineTask&& other) :
+			handle_{other.release()}
+	{
+
+	}
+
+	/**
+	 * \brief CoroutineTask's destructor
+	 *
+	 * Destroys the coroutine frame if the task was not transferred to CoroutineScheduler.
+	 */
+
+	~CoroutineTask()
+	{
+		if (handle_)
+			handle_.destroy();
+	}
+
+	/**
+	 * \return true if this object holds valid coroutine task, false otherwise
+	 */
+
+	bool isValid() const
+	{
+		return static_cast<bool>(handle_);
+	}
+
+	/**
+	 * \brief Releases ownership of coroutine task.
+	 *
+	 * \return handle of coroutine task, invalid handle if this object doesn't hold any
+	 */
+
+	Handle release()
+	{
+		const auto handle = handle_;
+		handle_ = {};
+		return handle;
+	}
+
+	CoroutineTask(const CoroutineTask&) = delete;
+	const CoroutineTask& operator=(const CoroutineTask&) = delete;
+	CoroutineTask& operator=(CoroutineTask&&) = delete;
+
+private:
+
+	/// handle of coroutine task
+	Handle handle_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_COROUTINETASK_HPP_
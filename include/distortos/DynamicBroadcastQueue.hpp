@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief DynamicBroadcastQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICBROADCASTQUEUE_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICBROADCASTQUEUE_HPP_
+
+#include "BroadcastQueue.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicBroadcastQueue class is a variant of BroadcastQueue that has dynamic storage for queue's contents.
+ *
+ * \ingroup queues
+ */
+
+class DynamicBroadcastQueue : public BroadcastQueue
+{
+public:
+
+	/**
+	 * \brief DynamicBroadcastQueue's constructor
+	 *
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	DynamicBroadcastQueue(size_t elementSize, size_t queueSize);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICBROADCASTQUEUE_HPP_
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief DynamicBufferLoanQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICBUFFERLOANQUEUE_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICBUFFERLOANQUEUE_HPP_
+
+#include "BufferLoanQueue.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicBufferLoanQueue class is a variant of BufferLoanQueue that has dynamic storage for buffers.
+ *
+ * \ingroup queues
+ */
+
+class DynamicBufferLoanQueue : public BufferLoanQueue
+{
+public:
+
+	/**
+	 * \brief DynamicBufferLoanQueue's constructor
+	 *
+	 * \param [in] bufferSize is the size of single buffer, bytes
+	 * \param [in] buffersCount is the number of buffers in the pool
+	 */
+
+	DynamicBufferLoanQueue(size_t bufferSize, size_t buffersCount);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICBUFFERLOANQUEUE_HPP_
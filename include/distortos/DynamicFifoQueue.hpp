@@ -16,6 +16,14 @@
 
 #include "distortos/internal/memory/storageDeleter.hpp"
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/internal/memory/allocateFromMemoryRegions.hpp"
+
+#include "distortos/memoryRegions.hpp"
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 namespace distortos
 {
 
@@ -42,6 +50,21 @@ public:
 	 */
 
 	explicit DynamicFifoQueue(size_t queueSize);
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+	/**
+	 * \brief DynamicFifoQueue's constructor
+	 *
+	 * Storage for queue's contents is allocated from memory region with requested capabilities.
+	 *
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 * \param [in] capabilities are the required capabilities of memory region used for queue's contents
+	 */
+
+	DynamicFifoQueue(size_t queueSize, MemoryCapabilities capabilities);
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
 };
 
 template<typename T>
@@ -51,6 +74,18 @@ DynamicFifoQueue<T>::DynamicFifoQueue(const size_t queueSize) :
 
 }
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+template<typename T>
+DynamicFifoQueue<T>::DynamicFifoQueue(const size_t queueSize, const MemoryCapabilities capabilities) :
+		FifoQueue<T>{{static_cast<Storage*>(internal::allocateFromMemoryRegions(capabilities,
+				sizeof(Storage) * queueSize, alignof(Storage))), memoryRegions::deallocate}, queueSize}
+{
+
+}
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_DYNAMICFIFOQUEUE_HPP_
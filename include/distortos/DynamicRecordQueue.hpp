@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief DynamicRecordQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICRECORDQUEUE_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICRECORDQUEUE_HPP_
+
+#include "RecordQueue.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicRecordQueue class is a variant of RecordQueue that has dynamic storage for records.
+ *
+ * \ingroup queues
+ */
+
+class DynamicRecordQueue : public RecordQueue
+{
+public:
+
+	/**
+	 * \brief DynamicRecordQueue's constructor
+	 *
+	 * \param [in] storageSize is the size of storage for records, bytes
+	 */
+
+	explicit DynamicRecordQueue(size_t storageSize);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICRECORDQUEUE_HPP_
@@ -42,6 +42,23 @@ public:
 
 	DynamicSignalsReceiver(size_t queuedSignals, size_t signalActions);
 
+	/**
+	 * \brief DynamicSignalsReceiver's constructor
+	 *
+	 * Storage is provided by the caller - usually as a part of a larger block of dynamic memory - and it is not
+	 * deallocated by this object.
+	 *
+	 * \param [in] queuedSignalsStorage is a pointer to storage for queued signals, nullptr if \a queuedSignals is 0
+	 * \param [in] queuedSignals is the max number of queued signals, 0 to disable queuing of signals for this receiver
+	 * \param [in] signalActionsStorage is a pointer to storage for SignalAction associations, nullptr if
+	 * \a signalActions is 0
+	 * \param [in] signalActions is the max number of different SignalAction objects, 0 to disable catching of signals
+	 * for this receiver
+	 */
+
+	DynamicSignalsReceiver(SignalInformationQueueWrapper::Storage* queuedSignalsStorage, size_t queuedSignals,
+			SignalsCatcher::Storage* signalActionsStorage, size_t signalActions);
+
 private:
 
 	/// internal SignalInformationQueueWrapper object
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicSoftwareTimer class header
  *
- * \author Copyright (C) 2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -44,6 +44,19 @@ public:
 	template<typename Function, typename... Args>
 	DynamicSoftwareTimer(Function&& function, Args&&... args);
 
+	/**
+	 * \brief DynamicSoftwareTimer's destructor
+	 *
+	 * Stops the timer before bound function object is destroyed.
+	 */
+
+	~DynamicSoftwareTimer() override
+	{
+		stop();
+	}
+
+	DynamicSoftwareTimer(DynamicSoftwareTimer&&) = default;
+
 private:
 
 	/**
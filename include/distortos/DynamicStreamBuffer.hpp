@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief DynamicStreamBuffer class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICSTREAMBUFFER_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICSTREAMBUFFER_HPP_
+
+#include "StreamBuffer.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicStreamBuffer class is a variant of StreamBuffer that has dynamic storage for data.
+ *
+ * \ingroup queues
+ */
+
+class DynamicStreamBuffer : public StreamBuffer
+{
+public:
+
+	/**
+	 * \brief DynamicStreamBuffer's constructor
+	 *
+	 * \param [in] storageSize is the size of storage for data, bytes
+	 * \param [in] triggerLevel is the number of bytes which must be available to wake the reader, 1 - \a storageSize,
+	 * default - 1
+	 */
+
+	explicit DynamicStreamBuffer(size_t storageSize, size_t triggerLevel = 1);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICSTREAMBUFFER_HPP_
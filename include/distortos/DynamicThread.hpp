@@ -69,9 +69,10 @@ public:
 
 	template<typename Function, typename... Args>
 	DynamicThread(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
-			DynamicThread{parameters.stackSize, parameters.canReceiveSignals, parameters.queuedSignals,
-					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
-					std::forward<Function>(function), std::forward<Args>(args)...}
+			detachableThread_{internal::DynamicThreadBase::make(parameters.stackSize, parameters.canReceiveSignals,
+					parameters.queuedSignals, parameters.signalActions, parameters.priority,
+					parameters.schedulingPolicy, parameters.memoryCapabilities, *this,
+					std::forward<Function>(function), std::forward<Args>(args)...)}
 	{
 
 	}
@@ -389,6 +390,20 @@ DynamicThread makeAndStartDynamicThread(const DynamicThreadParameters parameters
 	return thread;
 }
 
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+
+/**
+ * \brief Deallocates all blocks of memory of deleted dynamic threads which are retained for reuse.
+ *
+ * This function can be used when the memory is needed for something else than dynamic threads.
+ *
+ * \return number of deallocated blocks
+ */
+
+size_t trimThreadRecyclingCache();
+
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
 /// \}
 
 #ifdef DISTORTOS_THREAD_DETACH_ENABLE
@@ -397,8 +412,9 @@ template<typename Function, typename... Args>
 DynamicThread::DynamicThread(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
 		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
 		Function&& function, Args&&... args) :
-		detachableThread_{new internal::DynamicThreadBase{stackSize, canReceiveSignals, queuedSignals, signalActions,
-				priority, schedulingPolicy, *this, std::forward<Function>(function), std::forward<Args>(args)...}}
+		detachableThread_{internal::DynamicThreadBase::make(stackSize, canReceiveSignals, queuedSignals, signalActions,
+				priority, schedulingPolicy, MemoryCapabilities::none, *this, std::forward<Function>(function),
+				std::forward<Args>(args)...)}
 {
 
 }
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_DYNAMICTHREADPARAMETERS_HPP_
 #define INCLUDE_DISTORTOS_DYNAMICTHREADPARAMETERS_HPP_
 
+#include "distortos/MemoryCapabilities.hpp"
 #include "distortos/SchedulingPolicy.hpp"
 
 #include <cstddef>
@@ -43,15 +44,19 @@ struct DynamicThreadParameters
 	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] memoryCapabilitiess are the required capabilities of memory region used for thread's stack, relevant
+	 * only if memory regions are enabled, default - MemoryCapabilities::none
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const bool canReceiveSignalss,
 			const size_t queuedSignalss, const size_t signalActionss, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const MemoryCapabilities memoryCapabilitiess = MemoryCapabilities::none) :
 					queuedSignals{queuedSignalss},
 					signalActions{signalActionss},
 					stackSize{stackSizee},
 					canReceiveSignals{canReceiveSignalss},
+					memoryCapabilities{memoryCapabilitiess},
 					priority{priorityy},
 					schedulingPolicy{schedulingPolicyy}
 	{
@@ -64,11 +69,14 @@ struct DynamicThreadParameters
 	 * \param [in] stackSizee is the size of stack, bytes
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] memoryCapabilitiess are the required capabilities of memory region used for thread's stack, relevant
+	 * only if memory regions are enabled, default - MemoryCapabilities::none
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
-					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy}
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const MemoryCapabilities memoryCapabilitiess = MemoryCapabilities::none) :
+					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy, memoryCapabilitiess}
 	{
 
 	}
@@ -87,6 +95,10 @@ struct DynamicThreadParameters
 	/// selects whether reception of signals is enabled (true) or disabled (false) for this thread
 	bool canReceiveSignals;
 
+	/// required capabilities of memory region used for thread's stack, relevant only if memory regions are enabled,
+	/// MemoryCapabilities::none to use any region
+	MemoryCapabilities memoryCapabilities;
+
 	/// thread's priority, 0 - lowest, UINT8_MAX - highest
 	uint8_t priority;
 
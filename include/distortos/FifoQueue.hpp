@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
 #define INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
 #include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
 #include "distortos/internal/synchronization/CopyConstructQueueFunctor.hpp"
@@ -109,6 +111,15 @@ public:
 		return fifoQueueBase_.getCapacity();
 	}
 
+	/**
+	 * \return number of elements dropped by pushOverwrite() since the queue was constructed
+	 */
+
+	size_t getOverrunCount() const
+	{
+		return fifoQueueBase_.getOverrunCount();
+	}
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -165,6 +176,47 @@ public:
 		return pushInternal(semaphoreWaitFunctor, std::move(value));
 	}
 
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * Dropping of the oldest element (which is destructed) and pushing of the new one are done in one critical
+	 * section. Each dropped element increments the value returned by getOverrunCount(). This function never blocks.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - error codes returned by internal::FifoQueueBase::pushOverwrite();
+	 */
+
+	int pushOverwrite(const T& value)
+	{
+		const internal::CopyConstructQueueFunctor<T> copyConstructQueueFunctor {value};
+		return pushOverwriteInternal(copyConstructQueueFunctor);
+	}
+
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * Dropping of the oldest element (which is destructed) and pushing of the new one are done in one critical
+	 * section. Each dropped element increments the value returned by getOverrunCount(). This function never blocks.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - error codes returned by internal::FifoQueueBase::pushOverwrite();
+	 */
+
+	int pushOverwrite(T&& value)
+	{
+		const internal::MoveConstructQueueFunctor<T> moveConstructQueueFunctor {std::move(value)};
+		return pushOverwriteInternal(moveConstructQueueFunctor);
+	}
+
 	/**
 	 * \brief Tries to emplace the element in the queue.
 	 *
@@ -610,9 +662,11 @@ private:
 	 *
 	 * \note This function requires GCC 4.9.
 	 *
+	 * \tparam WaitSemaphoreFunctor is the type of functor derived from SemaphoreFunctor
 	 * \tparam Args are types of arguments for constructor of T
 	 *
-	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] waitSemaphoreFunctor is a reference to WaitSemaphoreFunctor which will be executed with
+	 * \a pushSemaphore_
 	 * \param [in] args are arguments for constructor of T
 	 *
 	 * \return 0 if element was emplaced successfully, error code otherwise:
@@ -620,15 +674,18 @@ private:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	template<typename... Args>
-	int emplaceInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, Args&&... args);
+	template<typename WaitSemaphoreFunctor, typename... Args>
+	int emplaceInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, Args&&... args);
 
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
 	 * Internal version - builds the Functor object.
 	 *
-	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \tparam WaitSemaphoreFunctor is the type of functor derived from SemaphoreFunctor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to WaitSemaphoreFunctor which will be executed with
+	 * \a popSemaphore_
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
 	 *
@@ -637,14 +694,31 @@ private:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value);
+	template<typename WaitSemaphoreFunctor>
+	int popInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, T& value);
+
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * Internal version - builds the Functor object which destructs the dropped element.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will construct the element in the queue's storage
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - error codes returned by internal::FifoQueueBase::pushOverwrite();
+	 */
+
+	int pushOverwriteInternal(const internal::QueueFunctor& functor);
 
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
 	 * Internal version - builds the Functor object.
 	 *
-	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \tparam WaitSemaphoreFunctor is the type of functor derived from SemaphoreFunctor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to WaitSemaphoreFunctor which will be executed with
+	 * \a pushSemaphore_
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
 	 *
 	 * \return 0 if element was pushed successfully, error code otherwise:
@@ -652,14 +726,18 @@ private:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value);
+	template<typename WaitSemaphoreFunctor>
+	int pushInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, const T& value);
 
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
 	 * Internal version - builds the Functor object.
 	 *
-	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \tparam WaitSemaphoreFunctor is the type of functor derived from SemaphoreFunctor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to WaitSemaphoreFunctor which will be executed with
+	 * \a pushSemaphore_
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
 	 *
@@ -668,7 +746,8 @@ private:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
+	template<typename WaitSemaphoreFunctor>
+	int pushInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, T&& value);
 
 	/// contained internal::FifoQueueBase object which implements whole functionality
 	internal::FifoQueueBase fifoQueueBase_;
@@ -682,36 +761,66 @@ FifoQueue<T>::~FifoQueue()
 }
 
 template<typename T>
-template<typename... Args>
-int FifoQueue<T>::emplaceInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, Args&&... args)
+template<typename WaitSemaphoreFunctor, typename... Args>
+int FifoQueue<T>::emplaceInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, Args&&... args)
 {
 	const auto emplaceFunctor = internal::makeBoundQueueFunctor(
 			[&args...](void* const storage)
 			{
 				new (storage) T{std::forward<Args>(args)...};
 			});
+#if DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE == 1
+	return fifoQueueBase_.pushInlined(waitSemaphoreFunctor, emplaceFunctor);
+#else	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
 	return fifoQueueBase_.push(waitSemaphoreFunctor, emplaceFunctor);
+#endif	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
 }
 
 template<typename T>
-int FifoQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value)
+template<typename WaitSemaphoreFunctor>
+int FifoQueue<T>::popInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, T& value)
 {
 	const internal::SwapPopQueueFunctor<T> swapPopQueueFunctor {value};
+#if DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE == 1
+	return fifoQueueBase_.popInlined(waitSemaphoreFunctor, swapPopQueueFunctor);
+#else	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, swapPopQueueFunctor);
+#endif	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
+}
+
+template<typename T>
+int FifoQueue<T>::pushOverwriteInternal(const internal::QueueFunctor& functor)
+{
+	const auto dropFunctor = internal::makeBoundQueueFunctor(
+			[](void* const storage)
+			{
+				reinterpret_cast<T*>(storage)->~T();
+			});
+	return fifoQueueBase_.pushOverwrite(functor, dropFunctor);
 }
 
 template<typename T>
-int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value)
+template<typename WaitSemaphoreFunctor>
+int FifoQueue<T>::pushInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, const T& value)
 {
 	const internal::CopyConstructQueueFunctor<T> copyConstructQueueFunctor {value};
+#if DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE == 1
+	return fifoQueueBase_.pushInlined(waitSemaphoreFunctor, copyConstructQueueFunctor);
+#else	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
 	return fifoQueueBase_.push(waitSemaphoreFunctor, copyConstructQueueFunctor);
+#endif	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
 }
 
 template<typename T>
-int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value)
+template<typename WaitSemaphoreFunctor>
+int FifoQueue<T>::pushInternal(const WaitSemaphoreFunctor& waitSemaphoreFunctor, T&& value)
 {
 	const internal::MoveConstructQueueFunctor<T> moveConstructQueueFunctor {std::move(value)};
+#if DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE == 1
+	return fifoQueueBase_.pushInlined(waitSemaphoreFunctor, moveConstructQueueFunctor);
+#else	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
 	return fifoQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
+#endif	// DISTORTOS_FIFO_QUEUE_INLINED_OPERATIONS_ENABLE != 1
 }
 
 }	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief HeapProfilerCallSite struct header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HEAPPROFILERCALLSITE_HPP_
+#define INCLUDE_DISTORTOS_HEAPPROFILERCALLSITE_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+/// \addtogroup statistics
+/// \{
+
+/**
+ * \brief HeapProfilerCallSite struct holds counters of allocations made from single call site
+ *
+ * On 32-bit targets the struct occupies 20 bytes, with fields placed at offsets 0 (caller), 4 (allocations), 8
+ * (liveBlocks), 12 (liveSize) and 16 (peakLiveSize) - this layout is expected by scripts/decodeHeapProfile.py.
+ */
+
+struct HeapProfilerCallSite
+{
+	/// return address of the function which called allocation function
+	const void* caller;
+
+	/// total number of allocations made from this call site
+	size_t allocations;
+
+	/// number of blocks allocated from this call site which were not deallocated yet
+	size_t liveBlocks;
+
+	/// total usable size of blocks allocated from this call site which were not deallocated yet, bytes
+	size_t liveSize;
+
+	/// max value of \a liveSize, bytes
+	size_t peakLiveSize;
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HEAPPROFILERCALLSITE_HPP_
@@ -0,0 +1,66 @@
+/**
+ * \file
+ * \brief HeapProfilerEvent struct header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HEAPPROFILEREVENT_HPP_
+#define INCLUDE_DISTORTOS_HEAPPROFILEREVENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+/// \addtogroup statistics
+/// \{
+
+/**
+ * \brief HeapProfilerEvent struct describes single allocation or deallocation recorded by heap profiler
+ *
+ * On 32-bit targets the struct occupies 32 bytes, with fields placed at offsets 0 (timestamp), 8 (caller), 12
+ * (memory), 16 (thread), 20 (size) and 24 (type) - this layout is expected by scripts/decodeHeapProfile.py.
+ */
+
+struct HeapProfilerEvent
+{
+	/// type of event
+	enum class Type : uint8_t
+	{
+		/// block of memory was allocated
+		allocation,
+		/// block of memory was deallocated
+		deallocation,
+	};
+
+	/// tick count at the moment of event
+	uint64_t timestamp;
+
+	/// return address of the function which called allocation or deallocation function
+	const void* caller;
+
+	/// pointer to block of memory
+	const void* memory;
+
+	/// pointer to thread which executed the operation, nullptr if it was executed from interrupt or before start of
+	/// scheduler
+	const void* thread;
+
+	/// usable size of block of memory, bytes
+	size_t size;
+
+	/// type of event
+	Type type;
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HEAPPROFILEREVENT_HPP_
@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief HeapProfilerSnapshot struct header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HEAPPROFILERSNAPSHOT_HPP_
+#define INCLUDE_DISTORTOS_HEAPPROFILERSNAPSHOT_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+/// \addtogroup statistics
+/// \{
+
+/// HeapProfilerSnapshot struct describes contents of snapshot of heap profiler
+struct HeapProfilerSnapshot
+{
+	/// number of call sites copied to snapshot
+	size_t callSites;
+
+	/// number of events copied to snapshot
+	size_t events;
+
+	/// number of events which were overwritten in ring buffer (since last clearing of events) before snapshot was
+	/// taken
+	size_t lostEvents;
+
+	/// number of allocations which were not attributed to any call site, because table of call sites or table of
+	/// tracked blocks was full
+	size_t untrackedAllocations;
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HEAPPROFILERSNAPSHOT_HPP_
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief HeapStatistics struct header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HEAPSTATISTICS_HPP_
+#define INCLUDE_DISTORTOS_HEAPSTATISTICS_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+/// \addtogroup statistics
+/// \{
+
+/// HeapStatistics struct holds snapshot of usage of heap
+struct HeapStatistics
+{
+	/// number of free blocks
+	size_t freeBlocks;
+
+	/// total size of free blocks, bytes
+	size_t freeSize;
+
+	/// size of the largest free block, bytes
+	size_t largestFreeBlockSize;
+
+	/// total size of the heap, including overhead of all blocks, bytes
+	size_t totalSize;
+
+	/// number of used (allocated) blocks
+	size_t usedBlocks;
+
+	/// total size of used (allocated) blocks, bytes
+	size_t usedSize;
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HEAPSTATISTICS_HPP_
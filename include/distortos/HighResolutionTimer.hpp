@@ -0,0 +1,161 @@
+/**
+ * \file
+ * \brief HighResolutionTimer class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HIGHRESOLUTIONTIMER_HPP_
+#define INCLUDE_DISTORTOS_HIGHRESOLUTIONTIMER_HPP_
+
+#include "distortos/internal/scheduler/HighResolutionTimerListNode.hpp"
+
+#include "estd/durationCastCeil.hpp"
+
+namespace distortos
+{
+
+class HighResolutionTimerSupervisor;
+
+/**
+ * \brief HighResolutionTimer class is an abstract interface for one-shot timer with resolution of hardware timer
+ *
+ * Unlike SoftwareTimer, expiration of this timer is not quantised to the tick period - HighResolutionTimerSupervisor
+ * programs compare channel of free-running hardware timer for the earliest deadline of all started timers. Function of
+ * the timer is executed from the interrupt of this hardware timer, with interrupts masked. Timer may be restarted from
+ * its own function, so periodic operation without any drift is possible with
+ * `start(getTimePoint() + period)`.
+ *
+ * \ingroup softwareTimers
+ */
+
+class HighResolutionTimer : public internal::HighResolutionTimerListNode
+{
+	friend class HighResolutionTimerSupervisor;
+
+public:
+
+	/// basic duration type of timer
+	using duration = std::chrono::duration<int64_t, std::nano>;
+
+	/// basic time_point type of timer, its epoch is the moment when counter of hardware timer was 0
+	using time_point = std::chrono::time_point<HighResolutionTimerSupervisor, duration>;
+
+	/**
+	 * \brief HighResolutionTimer's constructor
+	 *
+	 * \param [in] supervisor is a reference to HighResolutionTimerSupervisor which will manage this timer
+	 */
+
+	constexpr explicit HighResolutionTimer(HighResolutionTimerSupervisor& supervisor) :
+			HighResolutionTimerListNode{},
+			supervisor_{supervisor}
+	{
+
+	}
+
+	/**
+	 * \brief HighResolutionTimer's destructor
+	 *
+	 * If the timer is running it is stopped.
+	 */
+
+	virtual ~HighResolutionTimer();
+
+	/**
+	 * \attention Value is valid only if the timer was started at least once.
+	 *
+	 * \return time point at which the timer expires (or expired)
+	 */
+
+	time_point getTimePoint() const;
+
+	/**
+	 * \return true if the timer is running, false otherwise
+	 */
+
+	bool isRunning() const
+	{
+		asm("" ::: "memory");	// required for LTO
+		return node.isLinked();
+	}
+
+	/**
+	 * \brief Starts the timer.
+	 *
+	 * \note The duration will never be shorter, so it is rounded up to the period of hardware timer's counter.
+	 *
+	 * \param [in] delay is the duration after which the function will be executed
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - associated HighResolutionTimerSupervisor is not started;
+	 */
+
+	int start(duration delay);
+
+	/**
+	 * \brief Starts the timer.
+	 *
+	 * \note The duration will never be shorter, so it is rounded up to the period of hardware timer's counter.
+	 *
+	 * \tparam Rep is type of tick counter used in \a delay
+	 * \tparam Period is std::ratio type representing the tick period of the clock used in \a delay, seconds
+	 *
+	 * \param [in] delay is the duration after which the function will be executed
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - associated HighResolutionTimerSupervisor is not started;
+	 */
+
+	template<typename Rep, typename Period>
+	int start(const std::chrono::duration<Rep, Period> delay)
+	{
+		return start(estd::durationCastCeil<duration>(delay));
+	}
+
+	/**
+	 * \brief Starts the timer.
+	 *
+	 * \param [in] timePoint is the time point at which the function will be executed, it is rounded up to the period of
+	 * hardware timer's counter
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - associated HighResolutionTimerSupervisor is not started;
+	 */
+
+	int start(time_point timePoint);
+
+	/**
+	 * \brief Stops the timer.
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int stop();
+
+	HighResolutionTimer(const HighResolutionTimer&) = delete;
+	HighResolutionTimer(HighResolutionTimer&&) = default;
+	const HighResolutionTimer& operator=(const HighResolutionTimer&) = delete;
+	HighResolutionTimer& operator=(HighResolutionTimer&&) = delete;
+
+private:
+
+	/**
+	 * \brief "Run" function of timer
+	 *
+	 * This should be overridden by derived classes.
+	 */
+
+	virtual void run() = 0;
+
+	/// reference to HighResolutionTimerSupervisor which manages this timer
+	HighResolutionTimerSupervisor& supervisor_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HIGHRESOLUTIONTIMER_HPP_
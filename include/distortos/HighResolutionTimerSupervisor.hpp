@@ -0,0 +1,203 @@
+/**
+ * \file
+ * \brief HighResolutionTimerSupervisor class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HIGHRESOLUTIONTIMERSUPERVISOR_HPP_
+#define INCLUDE_DISTORTOS_HIGHRESOLUTIONTIMERSUPERVISOR_HPP_
+
+#include "distortos/devices/timers/CompareTimerBase.hpp"
+
+#include "distortos/internal/scheduler/HighResolutionTimerList.hpp"
+
+#include "distortos/HighResolutionTimer.hpp"
+
+namespace distortos
+{
+
+namespace devices
+{
+
+class CompareTimerLowLevel;
+
+}	// namespace devices
+
+/**
+ * \brief HighResolutionTimerSupervisor class is a supervisor of high-resolution timers driven by one free-running
+ * hardware timer with compare channel.
+ *
+ * Started timers are kept in a list sorted by deadline. Compare channel of the hardware timer is always programmed for
+ * the earliest deadline, and all expired timers are executed from its interrupt. The 32-bit counter of hardware timer
+ * is extended to 64 bits in software - to detect all wrap-arounds, compare channel is programmed at least every 2^31
+ * ticks of counter, also when no timer is running.
+ *
+ * This class can also be used as a clock - now() returns current time point of the hardware timer.
+ *
+ * \ingroup softwareTimers
+ */
+
+class HighResolutionTimerSupervisor : private devices::CompareTimerBase
+{
+	friend class HighResolutionTimer;
+
+public:
+
+	/// type of counter
+	using rep = HighResolutionTimer::duration::rep;
+
+	/// std::ratio type representing the period of the clock, seconds
+	using period = HighResolutionTimer::duration::period;
+
+	/// basic duration type of clock
+	using duration = HighResolutionTimer::duration;
+
+	/// basic time_point type of clock
+	using time_point = HighResolutionTimer::time_point;
+
+	/**
+	 * \brief HighResolutionTimerSupervisor's constructor
+	 *
+	 * \param [in] compareTimerLowLevel is a reference to low-level driver of hardware timer with compare channel
+	 */
+
+	constexpr explicit HighResolutionTimerSupervisor(devices::CompareTimerLowLevel& compareTimerLowLevel) :
+			timersList_{},
+			counter_{},
+			compareTimerLowLevel_{compareTimerLowLevel},
+			frequency_{}
+	{
+
+	}
+
+	/**
+	 * \brief HighResolutionTimerSupervisor's destructor
+	 *
+	 * \attention All timers managed by this supervisor must be stopped.
+	 */
+
+	~HighResolutionTimerSupervisor() override;
+
+	/**
+	 * \return frequency of counter of hardware timer, Hz, 0 if the supervisor is not started
+	 */
+
+	uint32_t getFrequency() const
+	{
+		return frequency_;
+	}
+
+	/**
+	 * \attention The supervisor must be started.
+	 *
+	 * \return time_point representing the current value of the counter of hardware timer
+	 */
+
+	time_point now() const;
+
+	/**
+	 * \brief Starts the supervisor and low-level driver of hardware timer.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - the supervisor is already started;
+	 * - error codes returned by devices::CompareTimerLowLevel::start();
+	 */
+
+	int start();
+
+	/**
+	 * \brief Stops the supervisor and low-level driver of hardware timer.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - the supervisor is not started;
+	 * - EBUSY - at least one timer is running;
+	 * - error codes returned by devices::CompareTimerLowLevel::stop();
+	 */
+
+	int stop();
+
+	HighResolutionTimerSupervisor(const HighResolutionTimerSupervisor&) = delete;
+	HighResolutionTimerSupervisor(HighResolutionTimerSupervisor&&) = delete;
+	const HighResolutionTimerSupervisor& operator=(const HighResolutionTimerSupervisor&) = delete;
+	HighResolutionTimerSupervisor& operator=(HighResolutionTimerSupervisor&&) = delete;
+
+private:
+
+	/**
+	 * \brief Adds timer to the supervisor, effectively starting it.
+	 *
+	 * \warning This function must be called with interrupts masked.
+	 *
+	 * \param [in] timer is a reference to timer which will be added, its deadline must be set
+	 */
+
+	void add(HighResolutionTimer& timer);
+
+	/**
+	 * \brief "Compare match" event
+	 *
+	 * Executes all expired timers and programs compare channel for the next deadline.
+	 */
+
+	void compareMatchEvent() override;
+
+	/**
+	 * \brief Converts duration to ticks of counter of hardware timer, rounding up.
+	 *
+	 * \param [in] value is the duration which will be converted, negative values are treated as 0
+	 *
+	 * \return \a value converted to ticks of counter of hardware timer
+	 */
+
+	uint64_t durationToTicks(duration value) const;
+
+	/**
+	 * \warning This function must be called with interrupts masked.
+	 *
+	 * \return current value of counter of hardware timer, extended to 64 bits
+	 */
+
+	uint64_t getCounter() const;
+
+	/**
+	 * \brief Programs compare channel for the earliest deadline, but no later than 2^31 ticks from now.
+	 *
+	 * If this value was passed before the compare channel could be programmed, "compare match" event is generated by
+	 * software.
+	 *
+	 * \warning This function must be called with interrupts masked.
+	 */
+
+	void programCompare();
+
+	/**
+	 * \brief Converts ticks of counter of hardware timer to duration, rounding down.
+	 *
+	 * \param [in] ticks is the number of ticks of counter of hardware timer
+	 *
+	 * \return \a ticks converted to duration
+	 */
+
+	duration ticksToDuration(uint64_t ticks) const;
+
+	/// list of running timers, sorted by deadline
+	internal::HighResolutionTimerList timersList_;
+
+	/// counter of hardware timer extended to 64 bits, updated with each read of the counter
+	mutable uint64_t counter_;
+
+	/// reference to low-level driver of hardware timer with compare channel
+	devices::CompareTimerLowLevel& compareTimerLowLevel_;
+
+	/// frequency of counter of hardware timer, Hz, 0 if the supervisor is not started
+	uint32_t frequency_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HIGHRESOLUTIONTIMERSUPERVISOR_HPP_
@@ -0,0 +1,138 @@
+/**
+ * \file
+ * \brief LatestValueMailbox class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_LATESTVALUEMAILBOX_HPP_
+#define INCLUDE_DISTORTOS_LATESTVALUEMAILBOX_HPP_
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+/**
+ * \brief LatestValueMailbox class is a single-slot mailbox which always holds the most recently written value.
+ *
+ * This is intended for "state" data (for example the last sensor sample or current setpoint), for which only the newest
+ * value is interesting and older values may be overwritten without being read. Writer never blocks and readers never
+ * block nor mask interrupts - the value is protected with "latch" variant of sequence lock: there are two copies of
+ * the value and while one of them is modified, readers use the other one. Reader retries the copy only if it was
+ * preempted by a write, so read() is wait-free for the writer and lock-free for readers.
+ *
+ * Writes are serialized by masking interrupts for the duration of two copies of the value, so \a T should be small.
+ *
+ * \tparam T is the type of value held in the mailbox, must be trivially copyable
+ *
+ * \ingroup queues
+ */
+
+template<typename T>
+class LatestValueMailbox
+{
+	static_assert(std::is_trivially_copyable<T>::value == true, "LatestValueMailbox requires trivially copyable type!");
+
+public:
+
+	/**
+	 * \brief LatestValueMailbox's constructor
+	 *
+	 * \param [in] value is the initial value held in the mailbox, default - value-initialized \a T
+	 */
+
+	constexpr explicit LatestValueMailbox(const T& value = T{}) :
+			values_{value, value},
+			sequence_{}
+	{
+
+	}
+
+	/**
+	 * \return number of writes done to the mailbox since it was constructed (modulo 2^31)
+	 *
+	 * \note This function can be used from interrupt context.
+	 */
+
+	uint32_t getWriteCount() const
+	{
+		return sequence_ / 2;
+	}
+
+	/**
+	 * \brief Reads the most recently written value.
+	 *
+	 * This function never blocks and doesn't mask interrupts.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [out] value is a reference to object that will be used to return the value
+	 *
+	 * \return number of writes done to the mailbox before \a value was written (modulo 2^31), it may be compared with
+	 * the value returned by previous call to detect whether the value was updated in the meantime
+	 */
+
+	uint32_t read(T& value) const
+	{
+		uint32_t sequence;
+		do
+		{
+			sequence = sequence_;
+			std::atomic_signal_fence(std::memory_order_seq_cst);
+			value = values_[sequence % 2];
+			std::atomic_signal_fence(std::memory_order_seq_cst);
+		} while (sequence != sequence_);	// retry only if a write preempted the read
+
+		return sequence / 2;
+	}
+
+	/**
+	 * \brief Writes new value, overwriting the previous one.
+	 *
+	 * This function never blocks.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] value is a reference to object that will be written
+	 */
+
+	void write(const T& value)
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		++sequence_;	// odd - readers use values_[1]
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		values_[0] = value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		++sequence_;	// even - readers use values_[0]
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		values_[1] = value;
+	}
+
+	LatestValueMailbox(const LatestValueMailbox&) = delete;
+	LatestValueMailbox(LatestValueMailbox&&) = delete;
+	const LatestValueMailbox& operator=(const LatestValueMailbox&) = delete;
+	LatestValueMailbox& operator=(LatestValueMailbox&&) = delete;
+
+private:
+
+	/// two copies of the value, readers use the one selected by the lowest bit of sequence_
+	T values_[2];
+
+	/// sequence counter of writes, incremented twice per write
+	uint32_t sequence_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_LATESTVALUEMAILBOX_HPP_
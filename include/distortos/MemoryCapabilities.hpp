@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief MemoryCapabilities enum class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_MEMORYCAPABILITIES_HPP_
+#define INCLUDE_DISTORTOS_MEMORYCAPABILITIES_HPP_
+
+#include "estd/EnumClassFlags.hpp"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+/// capabilities of memory region, used to select region for allocation
+enum class MemoryCapabilities : uint8_t
+{
+	/// no special capabilities, any region
+	none = 0,
+	/// memory is accessible by DMA
+	dma = 1 << 0,
+	/// memory is fast (e.g. tightly-coupled or core-coupled memory)
+	fast = 1 << 1,
+	/// memory is cacheable
+	cacheable = 1 << 2,
+};
+
+}	// namespace distortos
+
+namespace estd
+{
+
+/// \brief Enable bitwise operators for distortos::MemoryCapabilities
+template<>
+struct isEnumClassFlags<distortos::MemoryCapabilities> : std::true_type
+{
+
+};
+
+}	// namespace estd
+
+#endif	// INCLUDE_DISTORTOS_MEMORYCAPABILITIES_HPP_
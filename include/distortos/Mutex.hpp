@@ -2,7 +2,7 @@
  * \file
  * \brief Mutex class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -105,6 +105,32 @@ public:
 
 	~Mutex() = default;
 
+	/**
+	 * \return type of mutex
+	 */
+
+	Type getType() const
+	{
+		return MutexControlBlock::getType();
+	}
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	/**
+	 * \brief Gets statistics of the mutex.
+	 *
+	 * Statistics are collected since the first lock of the mutex.
+	 *
+	 * \return snapshot of contention and hold times of the mutex
+	 */
+
+	MutexStatistics getStatistics() const
+	{
+		return MutexControlBlock::getStatistics();
+	}
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 	/**
 	 * \brief Locks the mutex.
 	 *
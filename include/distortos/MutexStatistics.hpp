@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \brief MutexStatistics struct header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_MUTEXSTATISTICS_HPP_
+#define INCLUDE_DISTORTOS_MUTEXSTATISTICS_HPP_
+
+#include "distortos/HighResolutionClock.hpp"
+
+namespace distortos
+{
+
+/// \addtogroup statistics
+/// \{
+
+/// MutexStatistics struct holds snapshot of contention and hold times of mutex
+struct MutexStatistics
+{
+	/// number of acquisitions of the mutex, recursive locks of already owned mutex are not counted
+	size_t acquisitions;
+
+	/// number of acquisitions of the mutex which required blocking of the calling thread
+	size_t contendedAcquisitions;
+
+	/// max duration for which the mutex was held
+	HighResolutionClock::duration maxHoldTime;
+
+	/// max duration of single wait for the mutex
+	HighResolutionClock::duration maxWaitTime;
+
+	/// address of the mutex
+	const void* mutex;
+
+	/// number of threads which boosted priority of owner of the mutex when blocking on it (priorityInheritance
+	/// protocol only)
+	size_t priorityInheritanceBoosts;
+
+	/// sum of durations for which the mutex was held, divided by \a acquisitions it gives mean hold time
+	HighResolutionClock::duration totalHoldTime;
+
+	/// sum of durations of all waits for the mutex, including the ones which timed out or were interrupted
+	HighResolutionClock::duration totalWaitTime;
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_MUTEXSTATISTICS_HPP_
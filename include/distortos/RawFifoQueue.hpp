@@ -63,6 +63,15 @@ public:
 		return fifoQueueBase_.getElementSize();
 	}
 
+	/**
+	 * \return number of elements dropped by pushOverwrite() since the queue was constructed
+	 */
+
+	size_t getOverrunCount() const
+	{
+		return fifoQueueBase_.getOverrunCount();
+	}
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -137,6 +146,47 @@ public:
 		return push(&data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * Dropping of the oldest element and pushing of the new one are done in one critical section. Each dropped element
+	 * increments the value returned by getOverrunCount(). This function never blocks.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by internal::FifoQueueBase::pushOverwrite();
+	 */
+
+	int pushOverwrite(const void* data, size_t size);
+
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * Dropping of the oldest element and pushing of the new one are done in one critical section. Each dropped element
+	 * increments the value returned by getOverrunCount(). This function never blocks.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a reference to data that will be pushed to RawFifoQueue
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by internal::FifoQueueBase::pushOverwrite();
+	 */
+
+	template<typename T>
+	int pushOverwrite(const T& data)
+	{
+		return pushOverwrite(&data, sizeof(data));
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue.
 	 *
@@ -0,0 +1,445 @@
+/**
+ * \file
+ * \brief ReadWriteMutex class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_READWRITEMUTEX_HPP_
+#define INCLUDE_DISTORTOS_READWRITEMUTEX_HPP_
+
+#include "distortos/internal/synchronization/ReadWriteMutexControlBlock.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief ReadWriteMutex is a synchronization primitive which can be locked exclusively by one thread (writer) or in
+ * shared mode by many threads (readers) at the same time
+ *
+ * Similar to std::shared_timed_mutex - https://en.cppreference.com/w/cpp/thread/shared_timed_mutex
+ * Similar to POSIX pthread_rwlock_t -
+ * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_rdlock.html
+ *
+ * Writers are preferred - if any writer waits for the read-write mutex, new readers are blocked, so that continuous
+ * stream of readers cannot starve writers. Shared lock by the thread which already owns the read-write mutex in shared
+ * mode always succeeds, as otherwise it would deadlock with a waiting writer. Blocked writers and blocked readers are
+ * kept in priority order. All owners of the read-write mutex - the writer or all readers - inherit effective priority
+ * of the highest priority thread blocked on it.
+ *
+ * Max number of threads which own the read-write mutex in shared mode at the same time is limited by the size of
+ * storage for readers passed to the constructor - see StaticReadWriteMutex.
+ *
+ * \ingroup synchronization
+ */
+
+class ReadWriteMutex : private internal::ReadWriteMutexControlBlock
+{
+public:
+
+	/// type of storage for single reader
+	using ReaderStorage = internal::ReadWriteMutexOwnership;
+
+	/**
+	 * \brief ReadWriteMutex's constructor
+	 *
+	 * \param [in] readersStorage is a pointer to array of ReaderStorage objects, one for each thread which may own the
+	 * read-write mutex in shared mode at the same time
+	 * \param [in] maxReaders is the number of elements in \a readersStorage array
+	 */
+
+	constexpr ReadWriteMutex(ReaderStorage* const readersStorage, const size_t maxReaders) :
+			ReadWriteMutexControlBlock{readersStorage, maxReaders}
+	{
+
+	}
+
+	/**
+	 * \brief ReadWriteMutex's destructor
+	 *
+	 * Similar to pthread_rwlock_destroy() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_destroy.html
+	 *
+	 * It shall be safe to destroy an initialized read-write mutex that is unlocked. Attempting to destroy a locked
+	 * read-write mutex or a read-write mutex that another thread is attempting to lock results in undefined behavior.
+	 */
+
+	~ReadWriteMutex() = default;
+
+	/**
+	 * \brief Locks the read-write mutex exclusively.
+	 *
+	 * Similar to std::shared_timed_mutex::lock() - https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/lock
+	 * Similar to pthread_rwlock_wrlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_wrlock.html
+	 *
+	 * If the read-write mutex is already locked (exclusively or in shared mode) by another thread, the calling thread
+	 * shall block until the read-write mutex becomes available.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the read-write mutex (exclusively or in shared mode);
+	 */
+
+	int lock();
+
+	/**
+	 * \brief Locks the read-write mutex in shared mode.
+	 *
+	 * Similar to std::shared_timed_mutex::lock_shared() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/lock_shared
+	 * Similar to pthread_rwlock_rdlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_rdlock.html
+	 *
+	 * If the read-write mutex is locked exclusively by another thread or any writer waits for it, the calling thread
+	 * shall block until the read-write mutex becomes available.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EAGAIN - the read-write mutex could not be acquired because the maximum number of readers or recursive shared
+	 * locks has been exceeded;
+	 * - EDEADLK - the current thread already owns the read-write mutex exclusively;
+	 */
+
+	int lockShared();
+
+	/**
+	 * \brief Tries to lock the read-write mutex exclusively.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock
+	 * Similar to pthread_rwlock_trywrlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_trywrlock.html
+	 *
+	 * This function shall be equivalent to lock(), except that if the read-write mutex is currently locked (by any
+	 * thread, including the current thread), the call shall return immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EBUSY - the read-write mutex could not be acquired because it was already locked;
+	 */
+
+	int tryLock();
+
+	/**
+	 * \brief Tries to lock the read-write mutex exclusively for given duration of time.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_for() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_for
+	 *
+	 * If the read-write mutex is already locked, the calling thread shall block until the read-write mutex becomes
+	 * available as in lock() function. This wait shall be terminated when the specified timeout expires.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the read-write mutex (exclusively or in shared mode);
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the read-write mutex exclusively for given duration of time.
+	 *
+	 * Template variant of tryLockFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the read-write mutex (exclusively or in shared mode);
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the read-write mutex in shared mode.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared
+	 * Similar to pthread_rwlock_tryrdlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_tryrdlock.html
+	 *
+	 * This function shall be equivalent to lockShared(), except that if the read-write mutex is currently locked
+	 * exclusively or any writer waits for it, the call shall return immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EAGAIN - the read-write mutex could not be acquired because the maximum number of readers or recursive shared
+	 * locks has been exceeded;
+	 * - EBUSY - the read-write mutex could not be acquired because it was locked exclusively or some writer is waiting
+	 * for it;
+	 */
+
+	int tryLockShared();
+
+	/**
+	 * \brief Tries to lock the read-write mutex in shared mode for given duration of time.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared_for() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared_for
+	 *
+	 * If the read-write mutex is locked exclusively or any writer waits for it, the calling thread shall block until
+	 * the read-write mutex becomes available as in lockShared() function. This wait shall be terminated when the
+	 * specified timeout expires.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EAGAIN - the read-write mutex could not be acquired because the maximum number of readers or recursive shared
+	 * locks has been exceeded;
+	 * - EDEADLK - the current thread already owns the read-write mutex exclusively;
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockSharedFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the read-write mutex in shared mode for given duration of time.
+	 *
+	 * Template variant of tryLockSharedFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EAGAIN - the read-write mutex could not be acquired because the maximum number of readers or recursive shared
+	 * locks has been exceeded;
+	 * - EDEADLK - the current thread already owns the read-write mutex exclusively;
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockSharedFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockSharedFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the read-write mutex in shared mode until given time point.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared_until() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared_until
+	 * Similar to pthread_rwlock_timedrdlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedrdlock.html
+	 *
+	 * If the read-write mutex is locked exclusively or any writer waits for it, the calling thread shall block until
+	 * the read-write mutex becomes available as in lockShared() function. This wait shall be terminated when the
+	 * specified timeout expires.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EAGAIN - the read-write mutex could not be acquired because the maximum number of readers or recursive shared
+	 * locks has been exceeded;
+	 * - EDEADLK - the current thread already owns the read-write mutex exclusively;
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockSharedUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the read-write mutex in shared mode until given time point.
+	 *
+	 * Template variant of tryLockSharedUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EAGAIN - the read-write mutex could not be acquired because the maximum number of readers or recursive shared
+	 * locks has been exceeded;
+	 * - EDEADLK - the current thread already owns the read-write mutex exclusively;
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryLockSharedUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockSharedUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Tries to lock the read-write mutex exclusively until given time point.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_until() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_until
+	 * Similar to pthread_rwlock_timedwrlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedwrlock.html
+	 *
+	 * If the read-write mutex is already locked, the calling thread shall block until the read-write mutex becomes
+	 * available as in lock() function. This wait shall be terminated when the specified timeout expires.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the read-write mutex (exclusively or in shared mode);
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the read-write mutex exclusively until given time point.
+	 *
+	 * Template variant of tryLockUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the read-write mutex
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the read-write mutex (exclusively or in shared mode);
+	 * - ETIMEDOUT - the read-write mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryLockUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Locks the read-write mutex in shared mode.
+	 *
+	 * Wrapper for lockShared() which implements
+	 * [std::shared_timed_mutex::lock_shared()](https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/lock_shared)
+	 * API, so that the read-write mutex can be used with std::shared_lock.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	void lock_shared()
+	{
+		lockShared();
+	}
+
+	/**
+	 * \brief Tries to lock the read-write mutex exclusively.
+	 *
+	 * Wrapper for tryLock() which implements
+	 * [std::shared_timed_mutex::try_lock()](https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock) API.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return true if the caller successfully locked the read-write mutex, false otherwise
+	 */
+
+	bool try_lock()
+	{
+		return tryLock() == 0;
+	}
+
+	/**
+	 * \brief Tries to lock the read-write mutex in shared mode.
+	 *
+	 * Wrapper for tryLockShared() which implements
+	 * [std::shared_timed_mutex::try_lock_shared()](https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared)
+	 * API.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return true if the caller successfully locked the read-write mutex, false otherwise
+	 */
+
+	bool try_lock_shared()
+	{
+		return tryLockShared() == 0;
+	}
+
+	/**
+	 * \brief Unlocks the read-write mutex locked exclusively.
+	 *
+	 * Similar to std::shared_timed_mutex::unlock() - https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/unlock
+	 * Similar to pthread_rwlock_unlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_unlock.html
+	 *
+	 * If any writer is blocked on this read-write mutex, the highest priority one becomes the new owner. Otherwise all
+	 * blocked readers are unblocked.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully unlocked the read-write mutex, error code otherwise:
+	 * - EPERM - the current thread does not own the read-write mutex exclusively;
+	 */
+
+	int unlock();
+
+	/**
+	 * \brief Unlocks the read-write mutex locked in shared mode.
+	 *
+	 * Similar to std::shared_timed_mutex::unlock_shared() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/unlock_shared
+	 * Similar to pthread_rwlock_unlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_unlock.html
+	 *
+	 * When the last reader releases its last shared lock and any writer is blocked on this read-write mutex, the
+	 * highest priority one becomes the new owner.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully unlocked the read-write mutex, error code otherwise:
+	 * - EPERM - the current thread does not own the read-write mutex in shared mode;
+	 */
+
+	int unlockShared();
+
+	/**
+	 * \brief Unlocks the read-write mutex locked in shared mode.
+	 *
+	 * Wrapper for unlockShared() which implements
+	 * [std::shared_timed_mutex::unlock_shared()](https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/unlock_shared)
+	 * API, so that the read-write mutex can be used with std::shared_lock.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	void unlock_shared()
+	{
+		unlockShared();
+	}
+
+	ReadWriteMutex(const ReadWriteMutex&) = delete;
+	ReadWriteMutex(ReadWriteMutex&&) = delete;
+	const ReadWriteMutex& operator=(const ReadWriteMutex&) = delete;
+	ReadWriteMutex& operator=(ReadWriteMutex&&) = delete;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_READWRITEMUTEX_HPP_
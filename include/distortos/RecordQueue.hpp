@@ -0,0 +1,381 @@
+/**
+ * \file
+ * \brief RecordQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_RECORDQUEUE_HPP_
+#define INCLUDE_DISTORTOS_RECORDQUEUE_HPP_
+
+#include "distortos/internal/synchronization/RecordBuffer.hpp"
+#include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
+
+#include "distortos/Semaphore.hpp"
+
+#include <memory>
+
+namespace distortos
+{
+
+/**
+ * \brief RecordQueue class is a FIFO queue of variable-length records (binary messages).
+ *
+ * Unlike RawFifoQueue, which reserves a slot of fixed size for each element, RecordQueue stores each record in a
+ * contiguous area of shared storage, preceded by a header with its length, so the space is accounted in bytes. This
+ * allows efficient transfer of mixed-size messages (for example log entries or packets) without sizing each slot for
+ * the largest one. Each record occupies its size rounded up to a multiple of `sizeof(size_t)`, plus `sizeof(size_t)`
+ * bytes of header. The data is copied with memcpy(), so the records should be binary serializable.
+ *
+ * Records are received in the same order in which they were pushed. Threads waiting for free space are served in
+ * order of their priority - thread waiting for a large record may delay threads with lower priority, even if their
+ * records would already fit.
+ *
+ * \ingroup queues
+ */
+
+class RecordQueue
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief RecordQueue's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for records (should
+	 * be aligned to `sizeof(size_t)`) and appropriate deleter
+	 * \param [in] storageSize is the size of storage, bytes
+	 */
+
+	RecordQueue(StorageUniquePointer&& storageUniquePointer, size_t storageSize);
+
+	/**
+	 * \return total capacity of the queue, bytes
+	 */
+
+	size_t getCapacity() const
+	{
+		return recordBuffer_.getCapacity();
+	}
+
+	/**
+	 * \return maximum size of single record, bytes
+	 */
+
+	size_t getMaxRecordSize() const
+	{
+		return recordBuffer_.getMaxRecordSize();
+	}
+
+	/**
+	 * \brief Pops the oldest (first) record from the queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped record
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [out] recordSize is a reference to variable in which size of the record will be returned, bytes
+	 *
+	 * \return 0 if record was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is smaller than the size of the first record, which is left in the queue, \a recordSize is
+	 * valid;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pop(void* buffer, size_t size, size_t& recordSize);
+
+	/**
+	 * \brief Pushes the record to the queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return 0 if record was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than getMaxRecordSize();
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int push(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) record from the queue.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped record
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [out] recordSize is a reference to variable in which size of the record will be returned, bytes
+	 *
+	 * \return 0 if record was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is smaller than the size of the first record, which is left in the queue, \a recordSize is
+	 * valid;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPop(void* buffer, size_t size, size_t& recordSize);
+
+	/**
+	 * \brief Tries to pop the oldest (first) record from the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the record
+	 * \param [out] buffer is a pointer to buffer for popped record
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [out] recordSize is a reference to variable in which size of the record will be returned, bytes
+	 *
+	 * \return 0 if record was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is smaller than the size of the first record, which is left in the queue, \a recordSize is
+	 * valid;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopFor(TickClock::duration duration, void* buffer, size_t size, size_t& recordSize);
+
+	/**
+	 * \brief Tries to pop the oldest (first) record from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopFor(TickClock::duration, void*, size_t, size_t&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the record
+	 * \param [out] buffer is a pointer to buffer for popped record
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [out] recordSize is a reference to variable in which size of the record will be returned, bytes
+	 *
+	 * \return 0 if record was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is smaller than the size of the first record, which is left in the queue, \a recordSize is
+	 * valid;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, void* const buffer, const size_t size,
+			size_t& recordSize)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size, recordSize);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) record from the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the record
+	 * \param [out] buffer is a pointer to buffer for popped record
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [out] recordSize is a reference to variable in which size of the record will be returned, bytes
+	 *
+	 * \return 0 if record was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is smaller than the size of the first record, which is left in the queue, \a recordSize is
+	 * valid;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopUntil(TickClock::time_point timePoint, void* buffer, size_t size, size_t& recordSize);
+
+	/**
+	 * \brief Tries to pop the oldest (first) record from the queue until a given time point.
+	 *
+	 * Template variant of tryPopUntil(TickClock::time_point, void*, size_t, size_t&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the record
+	 * \param [out] buffer is a pointer to buffer for popped record
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [out] recordSize is a reference to variable in which size of the record will be returned, bytes
+	 *
+	 * \return 0 if record was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is smaller than the size of the first record, which is left in the queue, \a recordSize is
+	 * valid;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void* const buffer,
+			const size_t size, size_t& recordSize)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size, recordSize);
+	}
+
+	/**
+	 * \brief Tries to push the record to the queue.
+	 *
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return 0 if record was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than getMaxRecordSize();
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPush(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the record to the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without pushing the record
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return 0 if record was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than getMaxRecordSize();
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushFor(TickClock::duration duration, const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the record to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushFor(TickClock::duration, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without pushing the record
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return 0 if record was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than getMaxRecordSize();
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const void* const data, const size_t size)
+	{
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size);
+	}
+
+	/**
+	 * \brief Tries to push the record to the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the record
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return 0 if record was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than getMaxRecordSize();
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushUntil(TickClock::time_point timePoint, const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the record to the queue until a given time point.
+	 *
+	 * Template variant of tryPushUntil(TickClock::time_point, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the record
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return 0 if record was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than getMaxRecordSize();
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const void* const data,
+			const size_t size)
+	{
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size);
+	}
+
+	RecordQueue(const RecordQueue&) = delete;
+	RecordQueue(RecordQueue&&) = delete;
+	const RecordQueue& operator=(const RecordQueue&) = delete;
+	RecordQueue& operator=(RecordQueue&&) = delete;
+
+private:
+
+	/**
+	 * \brief Pops the oldest (first) record from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] buffer is a pointer to buffer for popped record
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [out] recordSize is a reference to variable in which size of the record will be returned, bytes
+	 *
+	 * \return 0 if record was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is smaller than the size of the first record, which is left in the queue, \a recordSize is
+	 * valid;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size,
+			size_t& recordSize);
+
+	/**
+	 * \brief Pushes the record to the queue.
+	 *
+	 * Internal version - \a waitSemaphoreFunctor is executed with \a pushSemaphore_ each time there is not enough free
+	 * space for the record, so it must not use relative timeout.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return 0 if record was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than getMaxRecordSize();
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data, size_t size);
+
+	/// storage for records
+	const StorageUniquePointer storageUniquePointer_;
+
+	/// buffer of records
+	internal::RecordBuffer recordBuffer_;
+
+	/// semaphore guarding access to "pop" functions - its value is equal to the number of records in the queue
+	Semaphore popSemaphore_;
+
+	/// binary semaphore posted each time free space is increased, used to wake threads waiting in "push" functions
+	Semaphore pushSemaphore_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RECORDQUEUE_HPP_
@@ -12,7 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_SEMAPHORE_HPP_
 #define INCLUDE_DISTORTOS_SEMAPHORE_HPP_
 
-#include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/internal/scheduler/ThreadWaitQueue.hpp"
 
 #include "distortos/TickClock.hpp"
 
@@ -247,7 +247,7 @@ private:
 	int tryWaitInternal();
 
 	/// ThreadControlBlock objects blocked on this semaphore
-	internal::ThreadList blockedList_;
+	internal::ThreadWaitQueue blockedList_;
 
 	/// internal value of the semaphore
 	Value value_;
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_SOFTWARETIMER_HPP_
 #define INCLUDE_DISTORTOS_SOFTWARETIMER_HPP_
 
+#include "distortos/distortosConfiguration.h"
 #include "distortos/TickClock.hpp"
 
 namespace distortos
@@ -33,12 +34,63 @@ public:
 
 	virtual ~SoftwareTimer() = default;
 
+	/**
+	 * \return slack of the timer
+	 */
+
+	virtual TickClock::duration getSlack() const = 0;
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \return true if function of the timer is executed by daemon thread of software timers, false if it is executed
+	 * from "tick" interrupt handler
+	 */
+
+	virtual bool isDeferred() const = 0;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 	/**
 	 * \return true if the timer is running, false otherwise
 	 */
 
 	virtual bool isRunning() const = 0;
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \brief Selects where function of the timer is executed.
+	 *
+	 * By default function of software timer is executed from "tick" interrupt handler, with interrupts masked, so it
+	 * must be short and it must not block. Function of timer with deferred execution is executed by high-priority
+	 * daemon thread of software timers, with interrupts unmasked - it may take longer and it may use blocking
+	 * functions, at the cost of queueing delay between expiration of the timer and execution of its function. Such
+	 * function should not block for long, as it delays functions of all other timers with deferred execution. New
+	 * value is used when the timer expires for the next time.
+	 *
+	 * \param [in] deferred selects whether function of the timer is executed by daemon thread of software timers
+	 * (true) or from "tick" interrupt handler (false)
+	 */
+
+	virtual void setDeferred(bool deferred) = 0;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \brief Sets slack of the timer.
+	 *
+	 * Function of the timer may be executed up to \a slack later than requested, if this allows to execute it in the
+	 * same tick as functions of other software timers, reducing the number of ticks in which any software timer
+	 * expires. It is never executed earlier than requested. Periodic timers don't accumulate the delay - next
+	 * expiration is always calculated from the requested time point. New value is used when the timer is started (or
+	 * restarted) for the next time.
+	 *
+	 * \param [in] slack is the new slack of the timer, negative values are treated as 0
+	 */
+
+	virtual void setSlack(TickClock::duration slack) = 0;
+
 	/**
 	 * \brief Starts the timer.
 	 *
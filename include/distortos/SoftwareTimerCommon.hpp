@@ -45,12 +45,50 @@ public:
 
 	~SoftwareTimerCommon() override;
 
+	/**
+	 * \return slack of the timer
+	 */
+
+	TickClock::duration getSlack() const override;
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \return true if function of the timer is executed by daemon thread of software timers, false if it is executed
+	 * from "tick" interrupt handler
+	 */
+
+	bool isDeferred() const override;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 	/**
 	 * \return true if the timer is running, false otherwise
 	 */
 
 	bool isRunning() const override;
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \brief Selects where function of the timer is executed.
+	 *
+	 * \param [in] deferred selects whether function of the timer is executed by daemon thread of software timers
+	 * (true) or from "tick" interrupt handler (false)
+	 */
+
+	void setDeferred(bool deferred) override;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \brief Sets slack of the timer.
+	 *
+	 * \param [in] slack is the new slack of the timer, negative values are treated as 0
+	 */
+
+	void setSlack(TickClock::duration slack) override;
+
 	/**
 	 * \brief Starts the timer.
 	 *
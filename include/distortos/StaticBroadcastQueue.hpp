@@ -0,0 +1,74 @@
+/**
+ * \file
+ * \brief StaticBroadcastQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICBROADCASTQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICBROADCASTQUEUE_HPP_
+
+#include "BroadcastQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticBroadcastQueue class is a variant of BroadcastQueue that has automatic storage for queue's contents.
+ *
+ * \tparam ElementSize is the size of single queue element, bytes
+ * \tparam QueueSize is the maximum number of elements in queue
+ *
+ * \ingroup queues
+ */
+
+template<size_t ElementSize, size_t QueueSize>
+class StaticBroadcastQueue : public BroadcastQueue
+{
+public:
+
+	/**
+	 * \brief StaticBroadcastQueue's constructor
+	 */
+
+	explicit StaticBroadcastQueue() :
+			BroadcastQueue{{storage_.data(), internal::dummyDeleter<uint8_t>}, ElementSize, QueueSize}
+	{
+
+	}
+
+	/**
+	 * \return maximum number of elements in queue
+	 */
+
+	constexpr static size_t getCapacity()
+	{
+		return QueueSize;
+	}
+
+	/**
+	 * \return size of single queue element, bytes
+	 */
+
+	constexpr static size_t getElementSize()
+	{
+		return ElementSize;
+	}
+
+private:
+
+	/// storage for queue's contents
+	std::array<uint8_t, ElementSize * QueueSize> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICBROADCASTQUEUE_HPP_
@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \brief StaticBufferLoanQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICBUFFERLOANQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICBUFFERLOANQUEUE_HPP_
+
+#include "BufferLoanQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticBufferLoanQueue class is a variant of BufferLoanQueue that has automatic storage for buffers.
+ *
+ * \tparam BufferSize is the size of single buffer, bytes
+ * \tparam BuffersCount is the number of buffers in the pool
+ *
+ * \ingroup queues
+ */
+
+template<size_t BufferSize, size_t BuffersCount>
+class StaticBufferLoanQueue : public BufferLoanQueue
+{
+public:
+
+	/**
+	 * \brief StaticBufferLoanQueue's constructor
+	 */
+
+	explicit StaticBufferLoanQueue() :
+			BufferLoanQueue{{buffersStorage_.data(), internal::dummyDeleter<uint8_t>},
+					{handlesStorage_.data(), internal::dummyDeleter<void*>}, BufferSize, BuffersCount}
+	{
+
+	}
+
+	/**
+	 * \return size of single buffer, bytes
+	 */
+
+	constexpr static size_t getBufferSize()
+	{
+		return BufferSize;
+	}
+
+	/**
+	 * \return number of buffers in the pool
+	 */
+
+	constexpr static size_t getCapacity()
+	{
+		return BuffersCount;
+	}
+
+private:
+
+	/// storage for buffers
+	alignas(alignof(std::max_align_t)) std::array<uint8_t, BufferSize * BuffersCount> buffersStorage_;
+
+	/// storage for pointers to buffers
+	std::array<void*, 2 * BuffersCount> handlesStorage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICBUFFERLOANQUEUE_HPP_
@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief StaticCoroutineFramePool class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICCOROUTINEFRAMEPOOL_HPP_
+#define INCLUDE_DISTORTOS_STATICCOROUTINEFRAMEPOOL_HPP_
+
+#include "distortos/CoroutineFramePool.hpp"
+
+#include <array>
+#include <type_traits>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticCoroutineFramePool class is a variant of CoroutineFramePool that has automatic storage for blocks.
+ *
+ * \tparam BlockSize is the size of single block, bytes
+ * \tparam Blocks is the number of blocks in the pool
+ *
+ * \ingroup threads
+ */
+
+template<size_t BlockSize, size_t Blocks>
+class StaticCoroutineFramePool : public CoroutineFramePool
+{
+public:
+
+	/**
+	 * \brief StaticCoroutineFramePool's constructor
+	 */
+
+	StaticCoroutineFramePool() :
+			CoroutineFramePool{storage_.data(), sizeof(storage_), sizeof(Block)}
+	{
+
+	}
+
+private:
+
+	/// type of uninitialized storage for single block
+	using Block = typename std::aligned_storage<BlockSize, alignof(std::max_align_t)>::type;
+
+	/// storage for blocks
+	std::array<Block, Blocks> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICCOROUTINEFRAMEPOOL_HPP_
@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \brief StaticHighResolutionTimer class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICHIGHRESOLUTIONTIMER_HPP_
+#define INCLUDE_DISTORTOS_STATICHIGHRESOLUTIONTIMER_HPP_
+
+#include "distortos/HighResolutionTimer.hpp"
+
+#include <functional>
+
+namespace distortos
+{
+
+/// \addtogroup softwareTimers
+/// \{
+
+/**
+ * \brief StaticHighResolutionTimer class is a templated interface for high-resolution timer
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for function
+ */
+
+template<typename Function, typename... Args>
+class StaticHighResolutionTimer : public HighResolutionTimer
+{
+public:
+
+	/**
+	 * \brief StaticHighResolutionTimer's constructor
+	 *
+	 * \param [in] supervisor is a reference to HighResolutionTimerSupervisor which will manage this timer
+	 * \param [in] function is a function that will be executed from interrupt context at a later time
+	 * \param [in] args are arguments for function
+	 */
+
+	StaticHighResolutionTimer(HighResolutionTimerSupervisor& supervisor, Function&& function, Args&&... args) :
+			HighResolutionTimer{supervisor},
+			boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief "Run" function of timer
+	 *
+	 * Executes bound function object.
+	 */
+
+	void run() override
+	{
+		boundFunction_();
+	}
+
+	/// bound function object
+	decltype(std::bind(std::declval<Function>(), std::declval<Args>()...)) boundFunction_;
+};
+
+/**
+ * \brief Helper factory function to make StaticHighResolutionTimer object with deduced template arguments
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for function
+ *
+ * \param [in] supervisor is a reference to HighResolutionTimerSupervisor which will manage the timer
+ * \param [in] function is a function that will be executed from interrupt context at a later time
+ * \param [in] args are arguments for function
+ *
+ * \return StaticHighResolutionTimer object with deduced template arguments
+ */
+
+template<typename Function, typename... Args>
+StaticHighResolutionTimer<Function, Args...> makeStaticHighResolutionTimer(HighResolutionTimerSupervisor& supervisor,
+		Function&& function, Args&&... args)
+{
+	return {supervisor, std::forward<Function>(function), std::forward<Args>(args)...};
+}
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICHIGHRESOLUTIONTIMER_HPP_
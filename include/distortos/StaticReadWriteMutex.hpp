@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief StaticReadWriteMutex class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICREADWRITEMUTEX_HPP_
+#define INCLUDE_DISTORTOS_STATICREADWRITEMUTEX_HPP_
+
+#include "distortos/ReadWriteMutex.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticReadWriteMutex class is a variant of ReadWriteMutex that has automatic storage for readers.
+ *
+ * \tparam MaxReaders is the max number of threads which can own the read-write mutex in shared mode at the same time
+ *
+ * \ingroup synchronization
+ */
+
+template<size_t MaxReaders>
+class StaticReadWriteMutex : public ReadWriteMutex
+{
+public:
+
+	/**
+	 * \brief StaticReadWriteMutex's constructor
+	 */
+
+	StaticReadWriteMutex() :
+			ReadWriteMutex{readersStorage_.data(), readersStorage_.size()},
+			readersStorage_{}
+	{
+
+	}
+
+private:
+
+	/// storage for readers
+	std::array<ReaderStorage, MaxReaders> readersStorage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICREADWRITEMUTEX_HPP_
@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief StaticRecordQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICRECORDQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICRECORDQUEUE_HPP_
+
+#include "RecordQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticRecordQueue class is a variant of RecordQueue that has automatic storage for records.
+ *
+ * \tparam StorageSize is the size of storage for records, bytes
+ *
+ * \ingroup queues
+ */
+
+template<size_t StorageSize>
+class StaticRecordQueue : public RecordQueue
+{
+public:
+
+	/**
+	 * \brief StaticRecordQueue's constructor
+	 */
+
+	explicit StaticRecordQueue() :
+			RecordQueue{{storage_.data(), internal::dummyDeleter<uint8_t>}, StorageSize}
+	{
+
+	}
+
+private:
+
+	/// storage for records
+	alignas(internal::RecordBuffer::headerSize) std::array<uint8_t, StorageSize> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICRECORDQUEUE_HPP_
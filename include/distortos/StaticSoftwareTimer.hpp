@@ -2,7 +2,7 @@
  * \file
  * \brief StaticSoftwareTimer class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -48,6 +48,19 @@ public:
 
 	}
 
+	/**
+	 * \brief StaticSoftwareTimer's destructor
+	 *
+	 * Stops the timer before bound function object is destroyed.
+	 */
+
+	~StaticSoftwareTimer() override
+	{
+		stop();
+	}
+
+	StaticSoftwareTimer(StaticSoftwareTimer&&) = default;
+
 private:
 
 	/**
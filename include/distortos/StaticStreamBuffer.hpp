@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief StaticStreamBuffer class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICSTREAMBUFFER_HPP_
+#define INCLUDE_DISTORTOS_STATICSTREAMBUFFER_HPP_
+
+#include "StreamBuffer.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticStreamBuffer class is a variant of StreamBuffer that has automatic storage for data.
+ *
+ * \tparam StorageSize is the size of storage for data, bytes
+ *
+ * \ingroup queues
+ */
+
+template<size_t StorageSize>
+class StaticStreamBuffer : public StreamBuffer
+{
+public:
+
+	/**
+	 * \brief StaticStreamBuffer's constructor
+	 *
+	 * \param [in] triggerLevel is the number of bytes which must be available to wake the reader, 1 - StorageSize,
+	 * default - 1
+	 */
+
+	explicit StaticStreamBuffer(const size_t triggerLevel = 1) :
+			StreamBuffer{{storage_.data(), internal::dummyDeleter<uint8_t>}, StorageSize, triggerLevel}
+	{
+
+	}
+
+private:
+
+	/// storage for data
+	std::array<uint8_t, StorageSize> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICSTREAMBUFFER_HPP_
@@ -0,0 +1,541 @@
+/**
+ * \file
+ * \brief StreamBuffer class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STREAMBUFFER_HPP_
+#define INCLUDE_DISTORTOS_STREAMBUFFER_HPP_
+
+#include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
+
+#include "distortos/Semaphore.hpp"
+
+#include "estd/RawCircularBuffer.hpp"
+
+#include <memory>
+
+namespace distortos
+{
+
+/**
+ * \brief StreamBuffer class is a circular buffer for a stream of bytes, with blocking read and write.
+ *
+ * StreamBuffer is intended for transfer of data between an interrupt handler and a thread (for example received
+ * characters from a driver), without the need to pair raw circular buffer with a semaphore in each driver. Reader is
+ * woken only when at least "trigger level" bytes are available (or when the timeout expires), so data arriving byte by
+ * byte doesn't cause a context switch for each byte. Data may also be accessed without copying with getReadBlock() and
+ * increaseReadPosition().
+ *
+ * Data is copied without masking interrupts, so there may be only one reader and only one writer at a time (each of
+ * them may be a thread or an interrupt handler).
+ *
+ * \ingroup queues
+ */
+
+class StreamBuffer
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief StreamBuffer's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for data and
+	 * appropriate deleter
+	 * \param [in] storageSize is the size of storage, bytes
+	 * \param [in] triggerLevel is the number of bytes which must be available to wake the reader, 1 - getCapacity(),
+	 * default - 1
+	 */
+
+	StreamBuffer(StorageUniquePointer&& storageUniquePointer, size_t storageSize, size_t triggerLevel = 1);
+
+	/**
+	 * \return total capacity of the buffer, bytes
+	 */
+
+	size_t getCapacity() const
+	{
+		return circularBuffer_.getCapacity();
+	}
+
+	/**
+	 * \brief Gets first contiguous block of data which can be read.
+	 *
+	 * Data is not removed from the buffer until increaseReadPosition() is called, so it may be processed in place.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \return pair with pointer to first byte of data and size of contiguous block, bytes; size is 0 if the buffer is
+	 * empty
+	 */
+
+	std::pair<const void*, size_t> getReadBlock() const
+	{
+		return circularBuffer_.getReadBlock();
+	}
+
+	/**
+	 * \return number of bytes available for reading
+	 *
+	 * \note This function can be used from interrupt context.
+	 */
+
+	size_t getSize() const
+	{
+		return circularBuffer_.getSize();
+	}
+
+	/**
+	 * \return number of bytes which must be available to wake the reader
+	 */
+
+	size_t getTriggerLevel() const
+	{
+		return triggerLevel_;
+	}
+
+	/**
+	 * \brief Removes data which was accessed with getReadBlock() from the buffer.
+	 *
+	 * Thread waiting for free space in any "write" function is woken, if there is enough space.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] size is the number of bytes which will be removed, must not be greater than the size of block
+	 * returned by getReadBlock()
+	 */
+
+	void increaseReadPosition(size_t size);
+
+	/**
+	 * \brief Reads data from the buffer.
+	 *
+	 * This function will block until at least trigger level bytes (but no more than \a size) are available.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, size_t> read(void* buffer, size_t size);
+
+	/**
+	 * \brief Sets trigger level.
+	 *
+	 * New value is used by the waits which start after this call.
+	 *
+	 * \param [in] triggerLevel is the number of bytes which must be available to wake the reader, 1 - getCapacity()
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a triggerLevel is not valid;
+	 */
+
+	int setTriggerLevel(size_t triggerLevel);
+
+	/**
+	 * \brief Tries to read data from the buffer.
+	 *
+	 * This function never blocks - it reads all data which is available (no more than \a size), regardless of trigger
+	 * level.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes; error codes:
+	 * - EAGAIN - the buffer is empty;
+	 */
+
+	std::pair<int, size_t> tryRead(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to read data from the buffer for a given duration of time.
+	 *
+	 * This function will block until at least trigger level bytes (but no more than \a size) are available or until
+	 * the timeout expires - in that case all data which is available is read.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes; error codes:
+	 * - ETIMEDOUT - no data was available before the specified timeout expired;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, size_t> tryReadFor(TickClock::duration duration, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to read data from the buffer for a given duration of time.
+	 *
+	 * Template variant of tryReadFor(TickClock::duration, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes; error codes:
+	 * - ETIMEDOUT - no data was available before the specified timeout expired;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryReadFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t size)
+	{
+		return tryReadFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to read data from the buffer until a given time point.
+	 *
+	 * This function will block until at least trigger level bytes (but no more than \a size) are available or until
+	 * the timeout expires - in that case all data which is available is read.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes; error codes:
+	 * - ETIMEDOUT - no data was available before the specified timeout expired;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, size_t> tryReadUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to read data from the buffer until a given time point.
+	 *
+	 * Template variant of tryReadUntil(TickClock::time_point, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes; error codes:
+	 * - ETIMEDOUT - no data was available before the specified timeout expired;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryReadUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t size)
+	{
+		return tryReadUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to wait until at least trigger level bytes are available for a given duration of time.
+	 *
+	 * Intended to be used together with getReadBlock() and increaseReadPosition().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 *
+	 * \return 0 if at least trigger level bytes are available, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryWaitFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to wait until at least trigger level bytes are available for a given duration of time.
+	 *
+	 * Template variant of tryWaitFor(TickClock::duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 *
+	 * \return 0 if at least trigger level bytes are available, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryWaitFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to wait until at least trigger level bytes are available until a given time point.
+	 *
+	 * Intended to be used together with getReadBlock() and increaseReadPosition().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 *
+	 * \return 0 if at least trigger level bytes are available, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryWaitUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to wait until at least trigger level bytes are available until a given time point.
+	 *
+	 * Template variant of tryWaitUntil(TickClock::time_point).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 *
+	 * \return 0 if at least trigger level bytes are available, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Tries to write data to the buffer.
+	 *
+	 * This function never blocks - it writes as much data as fits in the buffer.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] buffer is the buffer with data that will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes; error codes:
+	 * - EAGAIN - the buffer is full;
+	 */
+
+	std::pair<int, size_t> tryWrite(const void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to write data to the buffer for a given duration of time.
+	 *
+	 * This function will block until all data is written or until the timeout expires.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] buffer is the buffer with data that will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, size_t> tryWriteFor(TickClock::duration duration, const void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to write data to the buffer for a given duration of time.
+	 *
+	 * Template variant of tryWriteFor(TickClock::duration, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] buffer is the buffer with data that will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryWriteFor(const std::chrono::duration<Rep, Period> duration, const void* const buffer,
+			const size_t size)
+	{
+		return tryWriteFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to write data to the buffer until a given time point.
+	 *
+	 * This function will block until all data is written or until the timeout expires.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] buffer is the buffer with data that will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, size_t> tryWriteUntil(TickClock::time_point timePoint, const void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to write data to the buffer until a given time point.
+	 *
+	 * Template variant of tryWriteUntil(TickClock::time_point, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] buffer is the buffer with data that will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryWriteUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const void* const buffer, const size_t size)
+	{
+		return tryWriteUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+	}
+
+	/**
+	 * \brief Waits until at least trigger level bytes are available.
+	 *
+	 * Intended to be used together with getReadBlock() and increaseReadPosition().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if at least trigger level bytes are available, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int wait();
+
+	/**
+	 * \brief Writes data to the buffer.
+	 *
+	 * This function will block until all data is written.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] buffer is the buffer with data that will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, size_t> write(const void* buffer, size_t size);
+
+	StreamBuffer(const StreamBuffer&) = delete;
+	StreamBuffer(StreamBuffer&&) = delete;
+	const StreamBuffer& operator=(const StreamBuffer&) = delete;
+	StreamBuffer& operator=(StreamBuffer&&) = delete;
+
+private:
+
+	/**
+	 * \brief Reads data from the buffer.
+	 *
+	 * Internal version - \a waitSemaphoreFunctor is executed with \a readSemaphore_ each time there is not enough data
+	 * in the buffer, so it must not use relative timeout.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a readSemaphore_
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call, only if the buffer is empty;
+	 */
+
+	std::pair<int, size_t> readInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer,
+			size_t size);
+
+	/**
+	 * \brief Waits until given number of bytes is available.
+	 *
+	 * Internal version - \a waitSemaphoreFunctor is executed with \a readSemaphore_ each time there is not enough data
+	 * in the buffer, so it must not use relative timeout.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a readSemaphore_
+	 * \param [in] size is the number of bytes which must be available
+	 *
+	 * \return 0 if at least \a size bytes are available, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int waitInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, size_t size);
+
+	/**
+	 * \brief Writes data to the buffer.
+	 *
+	 * Internal version - \a waitSemaphoreFunctor is executed with \a writeSemaphore_ each time the buffer is full, so it
+	 * must not use relative timeout.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with
+	 * \a writeSemaphore_
+	 * \param [in] buffer is the buffer with data that will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of written bytes (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, size_t> writeInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* buffer,
+			size_t size);
+
+	/// storage for data
+	const StorageUniquePointer storageUniquePointer_;
+
+	/// circular buffer with data
+	estd::RawCircularBuffer circularBuffer_;
+
+	/// binary semaphore posted when the number of available bytes reaches \a readThreshold_
+	Semaphore readSemaphore_;
+
+	/// binary semaphore posted when the number of free bytes reaches \a writeThreshold_
+	Semaphore writeSemaphore_;
+
+	/// number of available bytes for which the reader is waiting, 0 if the reader is not waiting
+	size_t readThreshold_;
+
+	/// number of free bytes for which the writer is waiting, 0 if the writer is not waiting
+	size_t writeThreshold_;
+
+	/// number of bytes which must be available to wake the reader
+	size_t triggerLevel_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STREAMBUFFER_HPP_
@@ -49,6 +49,27 @@ int detach();
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
 
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+/**
+ * \brief Enables private newlib's reentrancy structure (_reent) for calling (current) thread.
+ *
+ * By default all threads share newlib's global _reent structure, so they also share its contents - e.g. `errno`,
+ * state of `strtok()` and `rand()`, buffers used by `asctime()`... A thread which needs its own copy of this data must
+ * call this function - preferably as the first thing it does. Private _reent structure is allocated dynamically and it
+ * is deallocated when the thread is destroyed. Calling this function for a thread which already has private _reent
+ * structure has no effect.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return 0 on success, error code otherwise:
+ * - ENOMEM - amount of free memory is insufficient to allocate _reent structure;
+ */
+
+int enablePrivateReent();
+
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
 /**
  * \brief Exits calling (current) thread.
  *
@@ -114,6 +135,14 @@ size_t getStackHighWaterMark();
 
 size_t getStackSize();
 
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return default slack of software timers used for timeouts of blocking operations of calling (current) thread
+ */
+
+TickClock::duration getTimerSlack();
+
 /**
  * \brief Changes priority of calling (current) thread.
  *
@@ -133,6 +162,21 @@ void setPriority(uint8_t priority, bool alwaysBehind = {});
 
 void setSchedulingPolicy(SchedulingPolicy schedulingPolicy);
 
+/**
+ * \brief Sets default slack of software timers used for timeouts of blocking operations of calling (current) thread.
+ *
+ * Sleeps and timed waits of the thread may end up to \a timerSlack later than requested, if this allows to coalesce
+ * their timeouts with expirations of other software timers. They never end earlier than requested. Default slack of
+ * each thread is 0, which gives exact timeouts.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] timerSlack is the new default slack of software timers used for timeouts of blocking operations of
+ * calling (current) thread, negative values are treated as 0
+ */
+
+void setTimerSlack(TickClock::duration timerSlack);
+
 /**
  * \brief Makes the calling (current) thread sleep for at least given duration.
  *
@@ -129,6 +129,9 @@ public:
 
 	/**
 	 * \return "high water mark" (max usage) of thread's stack, bytes
+	 *
+	 * \note If stack monitor is enabled (DISTORTOS_STACK_MONITOR_ENABLE == 1), this function doesn't scan the stack -
+	 * it returns the value which is updated in the background by the idle thread and on each context switch.
 	 */
 
 	virtual size_t getStackHighWaterMark() const = 0;
@@ -0,0 +1,110 @@
+/**
+ * \file
+ * \brief ThreadLocal class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_THREADLOCAL_HPP_
+#define INCLUDE_DISTORTOS_THREADLOCAL_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+namespace distortos
+{
+
+/// \addtogroup threads
+/// \{
+
+/**
+ * \brief Sets destructor of slot of thread-local storage.
+ *
+ * Similar to destructor argument of POSIX pthread_key_create() -
+ * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_key_create.html
+ *
+ * When a thread exits, destructor is executed for each slot of its thread-local storage which holds non-null pointer.
+ * The slot is set to nullptr before its destructor is executed. If destructors set any slots to non-null values, the
+ * procedure is repeated, up to 4 times.
+ *
+ * \note Destructors should be set during initialization of application, before any thread using the slot exits.
+ *
+ * \param [in] slot is the index of slot of thread-local storage, [0; DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS)
+ * \param [in] destructor is a pointer to function which will be executed with the pointer held in the slot when the
+ * thread exits, nullptr to execute no function
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a slot is not valid;
+ */
+
+int setThreadLocalDestructor(size_t slot, void (* destructor)(void*));
+
+/**
+ * \brief ThreadLocal class template provides typed access to one slot of thread-local storage of current thread.
+ *
+ * Slot is selected at compile time, so each access is just a single load or store relative to the control block of
+ * current thread, without any locking or lookups. Each thread has its own copy of each slot, initialized to nullptr.
+ *
+ * \tparam T is the type of object pointed to by the pointer held in the slot
+ * \tparam Slot is the index of slot of thread-local storage, [0; DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS)
+ */
+
+template<typename T, size_t Slot>
+class ThreadLocal
+{
+public:
+
+	static_assert(Slot < DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS, "Invalid slot of thread-local storage!");
+
+	/**
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return pointer held in the slot of thread-local storage of current thread
+	 */
+
+	static T* get()
+	{
+		return static_cast<T*>(internal::getScheduler().getCurrentThreadControlBlock().getThreadLocalSlot(Slot));
+	}
+
+	/**
+	 * \brief Sets pointer held in the slot of thread-local storage of current thread.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] pointer is the new pointer for the slot of thread-local storage of current thread
+	 */
+
+	static void set(T* const pointer)
+	{
+		internal::getScheduler().getCurrentThreadControlBlock().getThreadLocalSlot(Slot) = pointer;
+	}
+
+	/**
+	 * \brief Sets destructor of the slot of thread-local storage.
+	 *
+	 * \param [in] destructor is a pointer to function which will be executed with the pointer held in the slot when
+	 * the thread exits, nullptr to execute no function
+	 */
+
+	static void setDestructor(void (* const destructor)(void*))
+	{
+		setThreadLocalDestructor(Slot, destructor);
+	}
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+#endif	// INCLUDE_DISTORTOS_THREADLOCAL_HPP_
@@ -43,6 +43,8 @@ enum class ThreadState : uint8_t
 	blockedOnMutex,
 	/// thread is blocked on ConditionVariable
 	blockedOnConditionVariable,
+	/// thread is blocked on ReadWriteMutex
+	blockedOnReadWriteMutex,
 
 #if DISTORTOS_SIGNALS_ENABLE == 1
 
@@ -0,0 +1,85 @@
+/**
+ * \file
+ * \brief TraceRecord struct header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TRACERECORD_HPP_
+#define INCLUDE_DISTORTOS_TRACERECORD_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+/// \addtogroup statistics
+/// \{
+
+/**
+ * \brief TraceRecord struct describes single event recorded by trace recorder
+ *
+ * On 32-bit targets the struct occupies 24 bytes, with fields placed at offsets 0 (timestamp), 8 (thread), 12
+ * (object), 16 (argument), 20 (type) and 21 (interrupt) - this layout is expected by scripts/convertTrace.py.
+ */
+
+struct TraceRecord
+{
+	/// type of record, value 0 is never used, so zero-initialized storage contains no valid records
+	enum class Type : uint8_t
+	{
+		/// context switch, \a thread is the previous thread, \a object is the next thread, \a argument is the effective
+		/// priority of the next thread
+		threadSwitch = 1,
+		/// thread was blocked, \a object is the blocked thread, \a argument is its new ThreadState
+		threadBlock,
+		/// thread was unblocked, \a object is the unblocked thread, \a argument is the reason of unblocking
+		/// (0 - unblock request, 1 - timeout, 2 - signal)
+		threadUnblock,
+		/// tick interrupt, \a argument is the lower 32 bits of tick count
+		tick,
+		/// mutex was locked, \a object is the mutex, \a argument is 1 if the lock was acquired after blocking, 0
+		/// otherwise
+		mutexLock,
+		/// mutex was unlocked, \a object is the mutex
+		mutexUnlock,
+		/// element was pushed to queue, \a object is the queue
+		queuePush,
+		/// element was popped from queue, \a object is the queue
+		queuePop,
+		/// entry to interrupt handler, \a argument is the number of interrupt
+		interruptEntry,
+		/// exit from interrupt handler, \a argument is the number of interrupt
+		interruptExit,
+		/// records were overwritten before they were read, \a argument is the number of lost records
+		lostRecords,
+	};
+
+	/// number of cycles of tick timer since the start of scheduler
+	uint64_t timestamp;
+
+	/// pointer to thread which was running when the event was recorded, nullptr if scheduler was not started yet
+	const void* thread;
+
+	/// pointer to object related to the event, meaning depends on \a type
+	const void* object;
+
+	/// argument of the event, meaning depends on \a type
+	uint32_t argument;
+
+	/// type of record
+	Type type;
+
+	/// true if the event was recorded in interrupt context, false otherwise
+	bool interrupt;
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_TRACERECORD_HPP_
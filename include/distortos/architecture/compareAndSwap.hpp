@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief compareAndSwap() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_COMPAREANDSWAP_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_COMPAREANDSWAP_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Atomic compare-and-swap of a word.
+ *
+ * If \a object is equal to \a expected, it is replaced with \a desired. Comparison and replacement are a single atomic
+ * operation with respect to threads and interrupts.
+ *
+ * \param [in,out] object is a reference to word which will be compared and replaced
+ * \param [in] expected is the value which is expected in \a object
+ * \param [in] desired is the value which will be written to \a object if it is equal to \a expected
+ *
+ * \return true if \a object was equal to \a expected and it was replaced with \a desired, false otherwise
+ */
+
+bool compareAndSwap(uintptr_t& object, uintptr_t expected, uintptr_t desired);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_COMPAREANDSWAP_HPP_
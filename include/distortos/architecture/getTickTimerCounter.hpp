@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief getTickTimerCounter() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// state of hardware counter of tick timer
+struct TickTimerCounter
+{
+	/// number of counter cycles elapsed since the start of current tick period, [0; period)
+	uint32_t elapsed;
+
+	/// number of counter cycles in one tick period
+	uint32_t period;
+
+	/// true if current tick period started, but tick interrupt for previous period was not handled yet
+	bool pendingTick;
+};
+
+/**
+ * \brief Architecture-specific read of hardware counter of tick timer.
+ *
+ * This is used to interpolate time between consecutive ticks. The counter must wrap (and tick interrupt must become
+ * pending) exactly at the boundary of tick periods. If the counter wraps between the read of its value and the read of
+ * pending flag, the value must be read again, so that \a elapsed always refers to the period indicated by
+ * \a pendingTick.
+ *
+ * \note This function can be used from any context.
+ *
+ * \return current state of hardware counter of tick timer
+ */
+
+TickTimerCounter getTickTimerCounter();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_
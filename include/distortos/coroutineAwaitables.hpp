@@ -0,0 +1,685 @@
+/**
+ * \file
+ * \brief Awaitables for coroutine tasks executed by CoroutineScheduler
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_COROUTINEAWAITABLES_HPP_
+#define INCLUDE_DISTORTOS_COROUTINEAWAITABLES_HPP_
+
+#include "distortos/devices/communication/SerialPort.hpp"
+
+#include "distortos/CoroutineScheduler.hpp"
+#include "distortos/FifoQueue.hpp"
+#include "distortos/Mutex.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/// FifoQueuePopAwaiter class is an awaiter for FifoQueue::tryPop()
+template<typename T>
+class FifoQueuePopAwaiter : public CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief FifoQueuePopAwaiter's constructor
+	 *
+	 * \param [in] fifoQueue is a reference to FifoQueue from which the element will be popped
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 * \param [in] deadline is the time point at which the wait will be terminated with ETIMEDOUT
+	 */
+
+	FifoQueuePopAwaiter(FifoQueue<T>& fifoQueue, T& value, const TickClock::time_point deadline) :
+			CoroutineAwaiter{deadline},
+			fifoQueue_{fifoQueue},
+			value_{value},
+			ret_{}
+	{
+
+	}
+
+	/**
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - ETIMEDOUT - no element was popped before the specified timeout expired;
+	 * - error codes returned by FifoQueue::tryPop();
+	 */
+
+	int await_resume() const
+	{
+		return ret_;
+	}
+
+	void expire() override
+	{
+		ret_ = ETIMEDOUT;
+	}
+
+	bool poll() override
+	{
+		ret_ = fifoQueue_.tryPop(value_);
+		return ret_ != EAGAIN;
+	}
+
+private:
+
+	/// reference to FifoQueue from which the element will be popped
+	FifoQueue<T>& fifoQueue_;
+
+	/// reference to object that will be used to return popped value
+	T& value_;
+
+	/// result of operation
+	int ret_;
+};
+
+/// FifoQueuePushAwaiter class is an awaiter for FifoQueue::tryPush()
+template<typename T, typename U>
+class FifoQueuePushAwaiter : public CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief FifoQueuePushAwaiter's constructor
+	 *
+	 * \param [in] fifoQueue is a reference to FifoQueue to which the element will be pushed
+	 * \param [in] value is a reference to object that will be pushed (copied or moved, depending on \a U)
+	 * \param [in] deadline is the time point at which the wait will be terminated with ETIMEDOUT
+	 */
+
+	FifoQueuePushAwaiter(FifoQueue<T>& fifoQueue, U&& value, const TickClock::time_point deadline) :
+			CoroutineAwaiter{deadline},
+			fifoQueue_{fifoQueue},
+			value_{std::forward<U>(value)},
+			ret_{}
+	{
+
+	}
+
+	/**
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by FifoQueue::tryPush();
+	 */
+
+	int await_resume() const
+	{
+		return ret_;
+	}
+
+	void expire() override
+	{
+		ret_ = ETIMEDOUT;
+	}
+
+	bool poll() override
+	{
+		ret_ = fifoQueue_.tryPush(std::forward<U>(value_));
+		return ret_ != EAGAIN;
+	}
+
+private:
+
+	/// reference to FifoQueue to which the element will be pushed
+	FifoQueue<T>& fifoQueue_;
+
+	/// reference to object that will be pushed
+	U&& value_;
+
+	/// result of operation
+	int ret_;
+};
+
+/// MutexLockAwaiter class is an awaiter for Mutex::tryLock()
+class MutexLockAwaiter : public CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief MutexLockAwaiter's constructor
+	 *
+	 * \param [in] mutex is a reference to Mutex which will be locked
+	 * \param [in] deadline is the time point at which the wait will be terminated with ETIMEDOUT
+	 */
+
+	MutexLockAwaiter(Mutex& mutex, const TickClock::time_point deadline) :
+			CoroutineAwaiter{deadline},
+			mutex_{mutex},
+			ret_{}
+	{
+
+	}
+
+	/**
+	 * \return 0 if the mutex was locked successfully, error code otherwise:
+	 * - EINVAL - type of the mutex is not Mutex::Type::normal;
+	 * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
+	 * - error codes returned by Mutex::tryLock();
+	 */
+
+	int await_resume() const
+	{
+		return ret_;
+	}
+
+	void expire() override
+	{
+		ret_ = ETIMEDOUT;
+	}
+
+	bool poll() override
+	{
+		// the mutex is owned by the thread of the scheduler, so recursive or errorChecking mutex cannot tell coroutine
+		// tasks apart - it would let second task enter critical section or fail with EDEADLK instead of waiting
+		if (mutex_.getType() != Mutex::Type::normal)
+		{
+			ret_ = EINVAL;
+			return true;
+		}
+
+		ret_ = mutex_.tryLock();
+		return ret_ != EBUSY;
+	}
+
+private:
+
+	/// reference to Mutex which will be locked
+	Mutex& mutex_;
+
+	/// result of operation
+	int ret_;
+};
+
+/// SemaphoreWaitAwaiter class is an awaiter for Semaphore::tryWait()
+class SemaphoreWaitAwaiter : public CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief SemaphoreWaitAwaiter's constructor
+	 *
+	 * \param [in] semaphore is a reference to Semaphore which will be waited for
+	 * \param [in] deadline is the time point at which the wait will be terminated with ETIMEDOUT
+	 */
+
+	SemaphoreWaitAwaiter(Semaphore& semaphore, const TickClock::time_point deadline) :
+			CoroutineAwaiter{deadline},
+			semaphore_{semaphore},
+			ret_{}
+	{
+
+	}
+
+	/**
+	 * \return 0 if the semaphore was locked successfully, error code otherwise:
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	int await_resume() const
+	{
+		return ret_;
+	}
+
+	void expire() override
+	{
+		ret_ = ETIMEDOUT;
+	}
+
+	bool poll() override
+	{
+		ret_ = semaphore_.tryWait();
+		return ret_ != EAGAIN;
+	}
+
+private:
+
+	/// reference to Semaphore which will be waited for
+	Semaphore& semaphore_;
+
+	/// result of operation
+	int ret_;
+};
+
+/// SerialPortReadAwaiter class is an awaiter for non-blocking devices::SerialPort::read()
+class SerialPortReadAwaiter : public CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief SerialPortReadAwaiter's constructor
+	 *
+	 * \param [in] serialPort is a reference to devices::SerialPort from which the data will be read
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] minSize is the minimum size of read, bytes
+	 * \param [in] deadline is the time point at which the wait will be terminated with ETIMEDOUT
+	 */
+
+	SerialPortReadAwaiter(devices::SerialPort& serialPort, void* const buffer, const size_t size,
+			const size_t minSize, const TickClock::time_point deadline) :
+					CoroutineAwaiter{deadline},
+					serialPort_{serialPort},
+					buffer_{static_cast<uint8_t*>(buffer)},
+					size_{size},
+					minSize_{std::min(minSize, size)},
+					bytesRead_{},
+					ret_{}
+	{
+
+	}
+
+	/**
+	 * \return pair with return code (0 on success, error code otherwise) and number of read bytes (valid even when
+	 * error code is returned); error codes:
+	 * - ETIMEDOUT - required amount of data could not be read before the specified timeout expired;
+	 * - error codes returned by devices::SerialPort::read();
+	 */
+
+	std::pair<int, size_t> await_resume() const
+	{
+		return {ret_, bytesRead_};
+	}
+
+	void expire() override
+	{
+		ret_ = ETIMEDOUT;
+	}
+
+	bool poll() override
+	{
+		const auto ret = serialPort_.read(buffer_ + bytesRead_, size_ - bytesRead_, 0);
+		bytesRead_ += ret.second;
+		if (ret.first != 0 && ret.first != EAGAIN)
+		{
+			ret_ = ret.first;
+			return true;
+		}
+
+		return bytesRead_ >= minSize_;
+	}
+
+private:
+
+	/// reference to devices::SerialPort from which the data will be read
+	devices::SerialPort& serialPort_;
+
+	/// buffer to which the data will be written
+	uint8_t* buffer_;
+
+	/// size of \a buffer_, bytes
+	size_t size_;
+
+	/// minimum size of read, bytes
+	size_t minSize_;
+
+	/// number of bytes read so far
+	size_t bytesRead_;
+
+	/// result of operation
+	int ret_;
+};
+
+/// SleepAwaiter class is an awaiter which completes when its deadline is reached
+class SleepAwaiter : public CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief SleepAwaiter's constructor
+	 *
+	 * \param [in] deadline is the time point at which the sleep will end
+	 */
+
+	constexpr explicit SleepAwaiter(const TickClock::time_point deadline) :
+			CoroutineAwaiter{deadline, false}
+	{
+
+	}
+
+	/**
+	 * \return 0 - sleep always ends successfully
+	 */
+
+	int await_resume() const
+	{
+		return 0;
+	}
+
+	void expire() override
+	{
+
+	}
+
+	bool poll() override
+	{
+		return false;
+	}
+};
+
+/// YieldAwaiter class is an awaiter which moves coroutine task to the end of the list of ready tasks
+class YieldAwaiter
+{
+public:
+
+	/**
+	 * \return false - coroutine task is always suspended
+	 */
+
+	constexpr bool await_ready() const
+	{
+		return false;
+	}
+
+	/**
+	 * \brief Does nothing.
+	 */
+
+	void await_resume() const
+	{
+
+	}
+
+	/**
+	 * \brief Moves coroutine task to the end of the list of ready tasks.
+	 *
+	 * \param [in] handle is the handle of suspended coroutine task
+	 */
+
+	void await_suspend(const CoroutineTask::Handle handle) const
+	{
+		handle.promise().getScheduler()->yield(handle.promise());
+	}
+};
+
+}	// namespace internal
+
+/**
+ * \brief Pops the oldest (first) element from the queue.
+ *
+ * Awaitable variant of FifoQueue::pop().
+ *
+ * \tparam T is the type of data in queue
+ *
+ * \param [in] fifoQueue is a reference to FifoQueue from which the element will be popped
+ * \param [out] value is a reference to object that will be used to return popped value
+ *
+ * \return awaitable which returns 0 if element was popped successfully, error code otherwise:
+ * - error codes returned by FifoQueue::tryPop();
+ *
+ * \ingroup threads
+ */
+
+template<typename T>
+internal::FifoQueuePopAwaiter<T> asyncPop(FifoQueue<T>& fifoQueue, T& value)
+{
+	return {fifoQueue, value, TickClock::time_point::max()};
+}
+
+/**
+ * \brief Pops the oldest (first) element from the queue until given time point.
+ *
+ * Awaitable variant of FifoQueue::tryPopUntil().
+ *
+ * \tparam T is the type of data in queue
+ *
+ * \param [in] fifoQueue is a reference to FifoQueue from which the element will be popped
+ * \param [in] timePoint is the time point at which the wait will be terminated without popping the element
+ * \param [out] value is a reference to object that will be used to return popped value
+ *
+ * \return awaitable which returns 0 if element was popped successfully, error code otherwise:
+ * - ETIMEDOUT - no element was popped before the specified timeout expired;
+ * - error codes returned by FifoQueue::tryPop();
+ *
+ * \ingroup threads
+ */
+
+template<typename T>
+internal::FifoQueuePopAwaiter<T> asyncTryPopUntil(FifoQueue<T>& fifoQueue, const TickClock::time_point timePoint,
+		T& value)
+{
+	return {fifoQueue, value, timePoint};
+}
+
+/**
+ * \brief Pushes the element to the queue.
+ *
+ * Awaitable variant of FifoQueue::push().
+ *
+ * \tparam T is the type of data in queue
+ * \tparam U is the type of pushed object, value in queue's storage is copy-constructed for lvalues and
+ * move-constructed for rvalues
+ *
+ * \param [in] fifoQueue is a reference to FifoQueue to which the element will be pushed
+ * \param [in] value is a reference to object that will be pushed
+ *
+ * \return awaitable which returns 0 if element was pushed successfully, error code otherwise:
+ * - error codes returned by FifoQueue::tryPush();
+ *
+ * \ingroup threads
+ */
+
+template<typename T, typename U>
+internal::FifoQueuePushAwaiter<T, U> asyncPush(FifoQueue<T>& fifoQueue, U&& value)
+{
+	return {fifoQueue, std::forward<U>(value), TickClock::time_point::max()};
+}
+
+/**
+ * \brief Pushes the element to the queue until given time point.
+ *
+ * Awaitable variant of FifoQueue::tryPushUntil().
+ *
+ * \tparam T is the type of data in queue
+ * \tparam U is the type of pushed object, value in queue's storage is copy-constructed for lvalues and
+ * move-constructed for rvalues
+ *
+ * \param [in] fifoQueue is a reference to FifoQueue to which the element will be pushed
+ * \param [in] timePoint is the time point at which the wait will be terminated without pushing the element
+ * \param [in] value is a reference to object that will be pushed
+ *
+ * \return awaitable which returns 0 if element was pushed successfully, error code otherwise:
+ * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+ * - error codes returned by FifoQueue::tryPush();
+ *
+ * \ingroup threads
+ */
+
+template<typename T, typename U>
+internal::FifoQueuePushAwaiter<T, U> asyncTryPushUntil(FifoQueue<T>& fifoQueue,
+		const TickClock::time_point timePoint, U&& value)
+{
+	return {fifoQueue, std::forward<U>(value), timePoint};
+}
+
+/**
+ * \brief Locks the mutex.
+ *
+ * Awaitable variant of Mutex::lock().
+ *
+ * All coroutine tasks share the thread of CoroutineScheduler, which becomes the owner of the mutex, so only mutexes of
+ * Mutex::Type::normal can be used.
+ *
+ * \param [in] mutex is a reference to Mutex which will be locked
+ *
+ * \return awaitable which returns 0 if the mutex was locked successfully, error code otherwise:
+ * - EINVAL - type of the mutex is not Mutex::Type::normal;
+ * - error codes returned by Mutex::tryLock();
+ *
+ * \ingroup threads
+ */
+
+inline internal::MutexLockAwaiter asyncLock(Mutex& mutex)
+{
+	return {mutex, TickClock::time_point::max()};
+}
+
+/**
+ * \brief Locks the mutex until given time point.
+ *
+ * Awaitable variant of Mutex::tryLockUntil().
+ *
+ * All coroutine tasks share the thread of CoroutineScheduler, which becomes the owner of the mutex, so only mutexes of
+ * Mutex::Type::normal can be used.
+ *
+ * \param [in] mutex is a reference to Mutex which will be locked
+ * \param [in] timePoint is the time point at which the wait will be terminated without locking the mutex
+ *
+ * \return awaitable which returns 0 if the mutex was locked successfully, error code otherwise:
+ * - EINVAL - type of the mutex is not Mutex::Type::normal;
+ * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
+ * - error codes returned by Mutex::tryLock();
+ *
+ * \ingroup threads
+ */
+
+inline internal::MutexLockAwaiter asyncTryLockUntil(Mutex& mutex, const TickClock::time_point timePoint)
+{
+	return {mutex, timePoint};
+}
+
+/**
+ * \brief Reads data from serial port.
+ *
+ * Awaitable variant of devices::SerialPort::read().
+ *
+ * \param [in] serialPort is a reference to devices::SerialPort from which the data will be read
+ * \param [out] buffer is the buffer to which the data will be written
+ * \param [in] size is the size of \a buffer, bytes
+ * \param [in] minSize is the minimum size of read, bytes, default - 1
+ *
+ * \return awaitable which returns pair with return code (0 on success, error code otherwise) and number of read bytes
+ * (valid even when error code is returned); error codes:
+ * - error codes returned by devices::SerialPort::read();
+ *
+ * \ingroup threads
+ */
+
+inline internal::SerialPortReadAwaiter asyncRead(devices::SerialPort& serialPort, void* const buffer,
+		const size_t size, const size_t minSize = 1)
+{
+	return {serialPort, buffer, size, minSize, TickClock::time_point::max()};
+}
+
+/**
+ * \brief Reads data from serial port until given time point.
+ *
+ * Awaitable variant of devices::SerialPort::tryReadUntil().
+ *
+ * \param [in] serialPort is a reference to devices::SerialPort from which the data will be read
+ * \param [in] timePoint is the time point at which the wait will be terminated without reading \a minSize
+ * \param [out] buffer is the buffer to which the data will be written
+ * \param [in] size is the size of \a buffer, bytes
+ * \param [in] minSize is the minimum size of read, bytes, default - 1
+ *
+ * \return awaitable which returns pair with return code (0 on success, error code otherwise) and number of read bytes
+ * (valid even when error code is returned); error codes:
+ * - ETIMEDOUT - required amount of data could not be read before the specified timeout expired;
+ * - error codes returned by devices::SerialPort::read();
+ *
+ * \ingroup threads
+ */
+
+inline internal::SerialPortReadAwaiter asyncTryReadUntil(devices::SerialPort& serialPort,
+		const TickClock::time_point timePoint, void* const buffer, const size_t size, const size_t minSize = 1)
+{
+	return {serialPort, buffer, size, minSize, timePoint};
+}
+
+/**
+ * \brief Suspends coroutine task for given duration of time.
+ *
+ * Awaitable variant of ThisThread::sleepFor().
+ *
+ * \param [in] duration is the duration after which the coroutine task will be resumed
+ *
+ * \return awaitable which returns 0
+ *
+ * \ingroup threads
+ */
+
+inline internal::SleepAwaiter asyncSleepFor(const TickClock::duration duration)
+{
+	return internal::SleepAwaiter{TickClock::now() + duration + TickClock::duration{1}};
+}
+
+/**
+ * \brief Suspends coroutine task until given time point.
+ *
+ * Awaitable variant of ThisThread::sleepUntil().
+ *
+ * \param [in] timePoint is the time point at which the coroutine task will be resumed
+ *
+ * \return awaitable which returns 0
+ *
+ * \ingroup threads
+ */
+
+inline internal::SleepAwaiter asyncSleepUntil(const TickClock::time_point timePoint)
+{
+	return internal::SleepAwaiter{timePoint};
+}
+
+/**
+ * \brief Waits for the semaphore.
+ *
+ * Awaitable variant of Semaphore::wait().
+ *
+ * \param [in] semaphore is a reference to Semaphore which will be waited for
+ *
+ * \return awaitable which returns 0 if the semaphore was locked successfully
+ *
+ * \ingroup threads
+ */
+
+inline internal::SemaphoreWaitAwaiter asyncWait(Semaphore& semaphore)
+{
+	return {semaphore, TickClock::time_point::max()};
+}
+
+/**
+ * \brief Waits for the semaphore until given time point.
+ *
+ * Awaitable variant of Semaphore::tryWaitUntil().
+ *
+ * \param [in] semaphore is a reference to Semaphore which will be waited for
+ * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+ *
+ * \return awaitable which returns 0 if the semaphore was locked successfully, error code otherwise:
+ * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+ *
+ * \ingroup threads
+ */
+
+inline internal::SemaphoreWaitAwaiter asyncTryWaitUntil(Semaphore& semaphore, const TickClock::time_point timePoint)
+{
+	return {semaphore, timePoint};
+}
+
+/**
+ * \brief Moves current coroutine task to the end of the list of ready tasks of its CoroutineScheduler.
+ *
+ * Awaitable variant of ThisThread::yield().
+ *
+ * \return awaitable which returns nothing
+ *
+ * \ingroup threads
+ */
+
+constexpr internal::YieldAwaiter asyncYield()
+{
+	return {};
+}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_COROUTINEAWAITABLES_HPP_
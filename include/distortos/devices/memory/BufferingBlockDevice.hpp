@@ -14,6 +14,18 @@
 
 #include "distortos/devices/memory/BlockDevice.hpp"
 
+#ifndef DISTORTOS_UNIT_TEST
+
+#include "distortos/distortosConfiguration.h"
+
+#endif	// !def DISTORTOS_UNIT_TEST
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/MemoryCapabilities.hpp"
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 namespace distortos
 {
 
@@ -61,12 +73,36 @@ public:
 					writeBuffer_{writeBuffer},
 					writeBufferSize_{writeBufferSize},
 					writeBufferValidSize_{},
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+					ownsBuffers_{},
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
 					openCount_{},
 					readBufferValid_{}
 	{
 
 	}
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+	/**
+	 * \brief BufferingBlockDevice's constructor
+	 *
+	 * Both buffers are allocated from memory region with requested capabilities (with alignment of
+	 * `DISTORTOS_BLOCKDEVICE_BUFFER_ALIGNMENT` bytes) and are deallocated in destructor.
+	 *
+	 * \param [in] blockDevice is a reference to associated block device
+	 * \param [in] readBufferSize is the size of buffer for reads, bytes, must be a multiple of \a blockDevice block
+	 * size
+	 * \param [in] writeBufferSize is the size of buffer for writes, bytes, must be a multiple of \a blockDevice block
+	 * size
+	 * \param [in] capabilities are the required capabilities of memory region used for buffers
+	 */
+
+	BufferingBlockDevice(BlockDevice& blockDevice, size_t readBufferSize, size_t writeBufferSize,
+			MemoryCapabilities capabilities);
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 	/**
 	 * \brief BufferingBlockDevice's destructor
 	 *
@@ -286,6 +322,13 @@ private:
 	/// amount of data pending to be written in write buffer, bytes
 	size_t writeBufferValidSize_;
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+	/// true if buffers were allocated by constructor and must be deallocated in destructor, false otherwise
+	bool ownsBuffers_;
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 	/// number of times this device was opened but not yet closed
 	uint8_t openCount_;
 
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief CompareTimerBase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEVICES_TIMERS_COMPARETIMERBASE_HPP_
+#define INCLUDE_DISTORTOS_DEVICES_TIMERS_COMPARETIMERBASE_HPP_
+
+namespace distortos
+{
+
+namespace devices
+{
+
+/**
+ * \brief CompareTimerBase class is an interface with callbacks for low-level driver of hardware timer with compare
+ * channel, which can serve as a base for high-level drivers.
+ *
+ * \ingroup devices
+ */
+
+class CompareTimerBase
+{
+public:
+
+	/**
+	 * \brief CompareTimerBase's destructor
+	 */
+
+	virtual ~CompareTimerBase() = default;
+
+	/**
+	 * \brief "Compare match" event
+	 *
+	 * Called by low-level driver of hardware timer from interrupt context when the counter reaches the value of compare
+	 * channel or when the event was generated with CompareTimerLowLevel::generateEvent().
+	 */
+
+	virtual void compareMatchEvent() = 0;
+};
+
+}	// namespace devices
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DEVICES_TIMERS_COMPARETIMERBASE_HPP_
@@ -0,0 +1,103 @@
+/**
+ * \file
+ * \brief CompareTimerLowLevel class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEVICES_TIMERS_COMPARETIMERLOWLEVEL_HPP_
+#define INCLUDE_DISTORTOS_DEVICES_TIMERS_COMPARETIMERLOWLEVEL_HPP_
+
+#include <utility>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace devices
+{
+
+class CompareTimerBase;
+
+/**
+ * \brief CompareTimerLowLevel class is an interface for low-level driver of free-running hardware timer with compare
+ * channel.
+ *
+ * The counter of the timer counts up through the whole 32-bit range and wraps from UINT32_MAX to 0. Drivers of timers
+ * with narrower counters must extend them to 32 bits in software.
+ *
+ * \ingroup devices
+ */
+
+class CompareTimerLowLevel
+{
+public:
+
+	/**
+	 * \brief CompareTimerLowLevel's destructor
+	 */
+
+	virtual ~CompareTimerLowLevel() = default;
+
+	/**
+	 * \brief Generates "compare match" event by software.
+	 *
+	 * CompareTimerBase::compareMatchEvent() will be executed from interrupt context as soon as possible.
+	 *
+	 * \note This function can be used from interrupt context.
+	 */
+
+	virtual void generateEvent() = 0;
+
+	/**
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \return current value of counter
+	 */
+
+	virtual uint32_t getCounter() const = 0;
+
+	/**
+	 * \brief Sets the value of compare channel.
+	 *
+	 * When the counter reaches \a value, CompareTimerBase::compareMatchEvent() will be executed. If \a value was already
+	 * passed, the event will not be generated before the counter wraps. Previously set value is overwritten.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] value is the new value of compare channel
+	 */
+
+	virtual void setCompare(uint32_t value) = 0;
+
+	/**
+	 * \brief Starts low-level driver of hardware timer.
+	 *
+	 * \param [in] compareTimerBase is a reference to CompareTimerBase object that will be associated with this one
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and frequency of counter, Hz; error codes:
+	 * - EBADF - the driver is not stopped;
+	 */
+
+	virtual std::pair<int, uint32_t> start(CompareTimerBase& compareTimerBase) = 0;
+
+	/**
+	 * \brief Stops low-level driver of hardware timer.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - the driver is not started;
+	 */
+
+	virtual int stop() = 0;
+};
+
+}	// namespace devices
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DEVICES_TIMERS_COMPARETIMERLOWLEVEL_HPP_
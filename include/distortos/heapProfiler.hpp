@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief heapProfiler namespace header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HEAPPROFILER_HPP_
+#define INCLUDE_DISTORTOS_HEAPPROFILER_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#include "distortos/HeapProfilerCallSite.hpp"
+#include "distortos/HeapProfilerEvent.hpp"
+#include "distortos/HeapProfilerSnapshot.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+namespace distortos
+{
+
+namespace heapProfiler
+{
+
+/// \addtogroup statistics
+/// \{
+
+/**
+ * \brief Clears ring buffer of events recorded by heap profiler.
+ *
+ * Counters of call sites are not modified, as they describe blocks which are still live.
+ */
+
+void clearEvents();
+
+/**
+ * \brief Takes consistent snapshot of state of heap profiler.
+ *
+ * The snapshot is taken with the heap locked, so no allocation or deallocation can happen in the meantime. This
+ * function doesn't allocate any memory - all data is copied to provided storage.
+ *
+ * The copied data may be decoded on host with scripts/decodeHeapProfile.py, which symbolises addresses of callers and
+ * threads with the ELF file of the application.
+ *
+ * \param [out] events is a range in which the most recent events will be copied, from the oldest to the newest
+ * \param [out] callSites is a range in which call sites will be copied, in unspecified order
+ *
+ * \return HeapProfilerSnapshot struct describing copied data
+ */
+
+HeapProfilerSnapshot takeSnapshot(estd::ContiguousRange<HeapProfilerEvent> events,
+		estd::ContiguousRange<HeapProfilerCallSite> callSites);
+
+/// \}
+
+}	// namespace heapProfiler
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_HEAPPROFILER_HPP_
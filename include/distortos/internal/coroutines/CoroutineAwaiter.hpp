@@ -0,0 +1,153 @@
+/**
+ * \file
+ * \brief CoroutineAwaiter class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_COROUTINES_COROUTINEAWAITER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_COROUTINES_COROUTINEAWAITER_HPP_
+
+#include "distortos/CoroutineTask.hpp"
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief CoroutineAwaiter class is a base for awaiters which suspend coroutine task until an operation on a kernel
+ * object can be completed without blocking.
+ *
+ * Kernel objects have no way to resume a coroutine directly, so suspended awaiters are polled by CoroutineScheduler -
+ * each time it wakes up, it calls poll() of all suspended awaiters and resumes the coroutine tasks whose operations
+ * completed or whose deadlines passed.
+ */
+
+class CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief CoroutineAwaiter's constructor
+	 *
+	 * \param [in] deadline is the time point at which the wait will be terminated with expire(), default -
+	 * TickClock::time_point::max() (no deadline)
+	 * \param [in] pollable selects whether poll() can ever return true (true) or whether the awaiter completes only
+	 * when \a deadline is reached (false), default - true
+	 */
+
+	constexpr explicit CoroutineAwaiter(const TickClock::time_point deadline = TickClock::time_point::max(),
+			const bool pollable = true) :
+					node{},
+					deadline_{deadline},
+					promise_{},
+					pollable_{pollable}
+	{
+
+	}
+
+	/**
+	 * \brief Tries to complete the operation before the coroutine task is suspended.
+	 *
+	 * \return true if the operation was completed (or its deadline already passed) and the coroutine task does not
+	 * need to be suspended, false otherwise
+	 */
+
+	bool await_ready()
+	{
+		if (poll() == true)
+			return true;
+
+		if (deadline_ > TickClock::now())
+			return false;
+
+		expire();
+		return true;
+	}
+
+	/**
+	 * \brief Suspends the coroutine task, transferring this awaiter to CoroutineScheduler which executes the task.
+	 *
+	 * Defined in CoroutineScheduler.hpp.
+	 *
+	 * \param [in] handle is the handle of suspended coroutine task
+	 */
+
+	void await_suspend(CoroutineTask::Handle handle);
+
+	/**
+	 * \brief Called by CoroutineScheduler when the deadline passed before the operation could be completed.
+	 */
+
+	virtual void expire() = 0;
+
+	/**
+	 * \return time point at which the wait will be terminated with expire()
+	 */
+
+	TickClock::time_point getDeadline() const
+	{
+		return deadline_;
+	}
+
+	/**
+	 * \return reference to promise of suspended coroutine task
+	 */
+
+	CoroutineTask::promise_type& getPromise() const
+	{
+		return *promise_;
+	}
+
+	/**
+	 * \return true if poll() can ever return true, false if the awaiter completes only when deadline is reached
+	 */
+
+	bool isPollable() const
+	{
+		return pollable_;
+	}
+
+	/**
+	 * \brief Tries to complete the operation without blocking.
+	 *
+	 * \return true if the operation was completed (successfully or with an error), false if it would block
+	 */
+
+	virtual bool poll() = 0;
+
+	/// node for intrusive list of suspended awaiters in CoroutineScheduler
+	estd::IntrusiveListNode node;
+
+protected:
+
+	/**
+	 * \brief CoroutineAwaiter's destructor
+	 */
+
+	~CoroutineAwaiter() = default;
+
+private:
+
+	/// time point at which the wait will be terminated with expire()
+	TickClock::time_point deadline_;
+
+	/// pointer to promise of suspended coroutine task
+	CoroutineTask::promise_type* promise_;
+
+	/// true if poll() can ever return true, false if the awaiter completes only when deadline is reached
+	bool pollable_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_COROUTINES_COROUTINEAWAITER_HPP_
@@ -0,0 +1,208 @@
+/**
+ * \file
+ * \brief HeapProfiler class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_HEAPPROFILER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_HEAPPROFILER_HPP_
+
+#include "distortos/HeapProfilerCallSite.hpp"
+#include "distortos/HeapProfilerEvent.hpp"
+#include "distortos/HeapProfilerSnapshot.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief HeapProfiler class records allocations and deallocations and attributes them to call sites.
+ *
+ * All storage is provided by the user of the class, so recording is bounded in time and never allocates memory:
+ * - events are kept in a ring buffer, where the oldest events are overwritten;
+ * - each call site (return address of caller of allocation function) gets an entry in a hash table with counters of
+ * live blocks and bytes, entries are never removed;
+ * - each live block is associated with its call site in another hash table, so that deallocation can update the
+ * counters.
+ *
+ * When any of the hash tables is full, the allocation is still recorded as an event, but it is not attributed to any
+ * call site.
+ *
+ * This class is not thread-safe - it must be protected by the same lock as the heap.
+ */
+
+class HeapProfiler
+{
+public:
+
+	/// TrackedBlock struct associates live block of memory with its call site
+	struct TrackedBlock
+	{
+		/// pointer to block of memory, nullptr if this entry is empty
+		const void* memory;
+
+		/// pointer to call site of allocation of the block
+		HeapProfilerCallSite* callSite;
+
+		/// usable size of block of memory, bytes
+		size_t size;
+	};
+
+	/// type of range of HeapProfilerCallSite elements
+	using CallSitesRange = estd::ContiguousRange<HeapProfilerCallSite>;
+
+	/// type of range of HeapProfilerEvent elements
+	using EventsRange = estd::ContiguousRange<HeapProfilerEvent>;
+
+	/// type of range of TrackedBlock elements
+	using TrackedBlocksRange = estd::ContiguousRange<TrackedBlock>;
+
+	/**
+	 * \brief HeapProfiler's constructor
+	 *
+	 * \param [in] events is a range with storage for ring buffer of events
+	 * \param [in] callSites is a range with storage for hash table of call sites, all elements must be
+	 * zero-initialized
+	 * \param [in] trackedBlocks is a range with storage for hash table of live blocks, all elements must be
+	 * zero-initialized
+	 */
+
+	constexpr HeapProfiler(const EventsRange events, const CallSitesRange callSites,
+			const TrackedBlocksRange trackedBlocks) :
+					callSites_{callSites},
+					events_{events},
+					trackedBlocks_{trackedBlocks},
+					nextEvent_{},
+					recordedEvents_{},
+					untrackedAllocations_{}
+	{
+
+	}
+
+	/**
+	 * \brief Clears ring buffer of events.
+	 *
+	 * Counters of call sites are not modified, as they describe blocks which are still live.
+	 */
+
+	void clearEvents()
+	{
+		nextEvent_ = {};
+		recordedEvents_ = {};
+	}
+
+	/**
+	 * \brief Records allocation of block of memory.
+	 *
+	 * \param [in] memory is a pointer to allocated block of memory, must not be nullptr
+	 * \param [in] size is the usable size of \a memory, bytes
+	 * \param [in] caller is the return address of the function which called allocation function
+	 * \param [in] thread is a pointer to thread which executed the allocation, nullptr if not executed by a thread
+	 * \param [in] timestamp is the tick count at the moment of allocation
+	 */
+
+	void recordAllocation(const void* memory, size_t size, const void* caller, const void* thread, uint64_t timestamp);
+
+	/**
+	 * \brief Records deallocation of block of memory.
+	 *
+	 * \param [in] memory is a pointer to deallocated block of memory, must not be nullptr
+	 * \param [in] size is the usable size of \a memory, bytes
+	 * \param [in] caller is the return address of the function which called deallocation function
+	 * \param [in] thread is a pointer to thread which executed the deallocation, nullptr if not executed by a thread
+	 * \param [in] timestamp is the tick count at the moment of deallocation
+	 */
+
+	void recordDeallocation(const void* memory, size_t size, const void* caller, const void* thread,
+			uint64_t timestamp);
+
+	/**
+	 * \brief Copies current state of profiler.
+	 *
+	 * \param [out] events is a range in which the most recent events will be copied, from the oldest to the newest
+	 * \param [out] callSites is a range in which call sites will be copied, in unspecified order
+	 *
+	 * \return HeapProfilerSnapshot struct describing copied data
+	 */
+
+	HeapProfilerSnapshot takeSnapshot(EventsRange events, CallSitesRange callSites) const;
+
+	HeapProfiler(const HeapProfiler&) = delete;
+	HeapProfiler(HeapProfiler&&) = delete;
+	const HeapProfiler& operator=(const HeapProfiler&) = delete;
+	HeapProfiler& operator=(HeapProfiler&&) = delete;
+
+private:
+
+	/**
+	 * \brief Finds call site in hash table, adding it if it is not present.
+	 *
+	 * \param [in] caller is the return address of the function which called allocation function
+	 *
+	 * \return pointer to call site, nullptr if it is not present and the hash table is full
+	 */
+
+	HeapProfilerCallSite* findOrAddCallSite(const void* caller);
+
+	/**
+	 * \brief Finds live block in hash table.
+	 *
+	 * \param [in] memory is a pointer to block of memory
+	 *
+	 * \return index of entry with \a memory, or index of empty entry at which \a memory would be added, or size of
+	 * hash table if \a memory is not present and the hash table is full
+	 */
+
+	size_t findTrackedBlock(const void* memory) const;
+
+	/**
+	 * \brief Adds event to ring buffer, overwriting the oldest event if the ring buffer is full.
+	 *
+	 * \param [in] event is the event which will be added
+	 */
+
+	void pushEvent(const HeapProfilerEvent& event);
+
+	/**
+	 * \brief Removes entry from hash table of live blocks.
+	 *
+	 * Following entries of the same cluster are moved back, so that no "tombstones" are needed.
+	 *
+	 * \param [in] index is the index of removed entry
+	 */
+
+	void removeTrackedBlock(size_t index);
+
+	/// hash table of call sites
+	CallSitesRange callSites_;
+
+	/// ring buffer of events
+	EventsRange events_;
+
+	/// hash table of live blocks
+	TrackedBlocksRange trackedBlocks_;
+
+	/// index of element of \a events_ in which next event will be written
+	size_t nextEvent_;
+
+	/// number of events recorded since last clearing of events
+	size_t recordedEvents_;
+
+	/// number of allocations which were not attributed to any call site
+	size_t untrackedAllocations_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_HEAPPROFILER_HPP_
@@ -0,0 +1,157 @@
+/**
+ * \file
+ * \brief MemoryRegion class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_MEMORYREGION_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_MEMORYREGION_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/MemoryCapabilities.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class TlsfHeap;
+
+/**
+ * \brief MemoryRegion class is a single region of memory with its own heap.
+ *
+ * The region which holds main heap (used by malloc() and free()) shares this heap - its TlsfHeap is the main instance
+ * returned by getTlsfHeap(). All other regions have their own TlsfHeap objects. Regions are defined by board, with
+ * bounds imported from linker script and capabilities taken from board's metadata.
+ */
+
+class MemoryRegion
+{
+public:
+
+	/**
+	 * \brief MemoryRegion's constructor
+	 *
+	 * \param [in] name is the name of region, as in board's metadata
+	 * \param [in] capabilities are the capabilities of region
+	 * \param [in] heap is a reference to heap which manages the region
+	 * \param [in] begin is a pointer to beginning of region's heap
+	 * \param [in] end is a pointer to end of region's heap
+	 */
+
+	constexpr MemoryRegion(const char* const name, const MemoryCapabilities capabilities, TlsfHeap& heap,
+			char* const begin, char* const end) :
+					name_{name},
+					heap_{heap},
+					begin_{begin},
+					end_{end},
+					capabilities_{capabilities}
+	{
+
+	}
+
+	/**
+	 * \param [in] pointer is the pointer which will be checked
+	 *
+	 * \return true if \a pointer is in region's heap, false otherwise
+	 */
+
+	bool contains(const void* const pointer) const
+	{
+		return pointer >= begin_ && pointer < end_;
+	}
+
+	/**
+	 * \return pointer to beginning of region's heap
+	 */
+
+	char* getBegin() const
+	{
+		return begin_;
+	}
+
+	/**
+	 * \return capabilities of region
+	 */
+
+	MemoryCapabilities getCapabilities() const
+	{
+		return capabilities_;
+	}
+
+	/**
+	 * \return pointer to end of region's heap
+	 */
+
+	char* getEnd() const
+	{
+		return end_;
+	}
+
+	/**
+	 * \return reference to heap which manages the region
+	 */
+
+	TlsfHeap& getHeap() const
+	{
+		return heap_;
+	}
+
+	/**
+	 * \return name of region
+	 */
+
+	const char* getName() const
+	{
+		return name_;
+	}
+
+private:
+
+	/// name of region
+	const char* name_;
+
+	/// reference to heap which manages the region
+	TlsfHeap& heap_;
+
+	/// pointer to beginning of region's heap
+	char* begin_;
+
+	/// pointer to end of region's heap
+	char* end_;
+
+	/// capabilities of region
+	MemoryCapabilities capabilities_;
+};
+
+/// range of MemoryRegion objects
+using MemoryRegionsRange = estd::ContiguousRange<MemoryRegion>;
+
+/**
+ * \return range with all memory regions of the board
+ *
+ * \note This function is defined by the board.
+ */
+
+MemoryRegionsRange getMemoryRegions();
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_MEMORYREGION_HPP_
@@ -0,0 +1,162 @@
+/**
+ * \file
+ * \brief ThreadRecyclingCache class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_THREADRECYCLINGCACHE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_THREADRECYCLINGCACHE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+
+#include "distortos/MemoryCapabilities.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief ThreadRecyclingCache class is a cache of blocks of memory used by dynamic threads.
+ *
+ * When dynamic thread is deleted, its block of memory (with control block, stack and storage for signals) is retained
+ * in the cache - up to configured limit - instead of being deallocated. Next dynamic thread which needs a block of
+ * exactly the same size reuses it, skipping both allocation and deallocation.
+ *
+ * Each block has a small header (used to store its size and to link cached blocks), which precedes the memory returned
+ * by allocate().
+ *
+ * If memory regions are enabled, blocks are allocated from regions with requested capabilities and a cached block is
+ * reused only by allocation with exactly the same capabilities.
+ */
+
+class ThreadRecyclingCache
+{
+public:
+
+	/**
+	 * \brief ThreadRecyclingCache's constructor
+	 *
+	 * \param [in] maxSize is the max number of blocks retained in the cache, 0 to disable retaining of blocks
+	 */
+
+	constexpr explicit ThreadRecyclingCache(const size_t maxSize) :
+			list_{},
+			hitCount_{},
+			maxSize_{maxSize},
+			missCount_{},
+			size_{}
+	{
+
+	}
+
+	/**
+	 * \brief Allocates block of memory.
+	 *
+	 * If the cache contains a block of exactly requested size (and capabilities), it is removed from the cache and
+	 * returned. Otherwise new block is allocated - if this fails, the cache is trimmed and the allocation is repeated.
+	 *
+	 * \param [in] size is the size of block of memory, bytes
+	 * \param [in] capabilities are the required capabilities of memory region, relevant only if memory regions are
+	 * enabled, default - MemoryCapabilities::none
+	 *
+	 * \return pointer to block of memory with at least \a size bytes, aligned to alignof(max_align_t)
+	 */
+
+	void* allocate(size_t size, MemoryCapabilities capabilities = {});
+
+	/**
+	 * \brief Deallocates block of memory.
+	 *
+	 * If the cache is not full, the block is retained in the cache. Otherwise it is deallocated.
+	 *
+	 * \param [in] pointer is a pointer to block of memory returned by allocate()
+	 */
+
+	void deallocate(void* pointer);
+
+	/**
+	 * \return number of allocations which reused block from the cache
+	 */
+
+	size_t getHitCount() const;
+
+	/**
+	 * \return number of allocations which could not reuse block from the cache
+	 */
+
+	size_t getMissCount() const;
+
+	/**
+	 * \return number of blocks currently retained in the cache
+	 */
+
+	size_t getSize() const;
+
+	/**
+	 * \brief Deallocates all blocks retained in the cache.
+	 *
+	 * \return number of deallocated blocks
+	 */
+
+	size_t trim();
+
+	ThreadRecyclingCache(const ThreadRecyclingCache&) = delete;
+	ThreadRecyclingCache(ThreadRecyclingCache&&) = delete;
+	const ThreadRecyclingCache& operator=(const ThreadRecyclingCache&) = delete;
+	ThreadRecyclingCache& operator=(ThreadRecyclingCache&&) = delete;
+
+private:
+
+	/// Header struct is placed at the beginning of each block of memory
+	struct Header
+	{
+		/// pointer to next cached block, valid only when the block is retained in the cache
+		Header* next;
+
+		/// size of memory following the header, bytes
+		size_t size;
+
+		/// capabilities of memory region requested for the block
+		MemoryCapabilities capabilities;
+	};
+
+	/// size of header, adjusted to alignment requirements of dynamically allocated memory
+	constexpr static size_t headerSize
+	{
+		(sizeof(Header) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t)
+	};
+
+	/// list of cached blocks, nullptr if the cache is empty
+	Header* list_;
+
+	/// number of allocations which reused block from the cache
+	size_t hitCount_;
+
+	/// max number of blocks retained in the cache
+	size_t maxSize_;
+
+	/// number of allocations which could not reuse block from the cache
+	size_t missCount_;
+
+	/// number of blocks currently retained in the cache
+	size_t size_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_THREADRECYCLINGCACHE_HPP_
@@ -0,0 +1,350 @@
+/**
+ * \file
+ * \brief TlsfHeap class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAP_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAP_HPP_
+
+#include "distortos/HeapStatistics.hpp"
+
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief TlsfHeap class is a heap with "two-level segregated fit" allocator.
+ *
+ * Free blocks are kept in segregated lists, selected with two-level bitmap - first level splits sizes into powers of
+ * two, second level splits each power of two into 16 equal ranges. Allocation, deallocation and reallocation take
+ * constant time, regardless of the number and layout of blocks, and free blocks are always coalesced with physical
+ * neighbours.
+ *
+ * Each block - free or used - is preceded by a header with pointer to physically previous block and size of the
+ * block. All memory returned by the heap is aligned to alignof(max_align_t).
+ *
+ * This class does no locking - it must be provided by the user of the heap.
+ */
+
+class TlsfHeap
+{
+public:
+
+	/// alignment of memory returned by the heap, bytes
+	constexpr static size_t alignment {alignof(max_align_t)};
+
+	/**
+	 * \brief TlsfHeap's constructor
+	 *
+	 * Constructed heap is empty - initialize() must be called before it can be used.
+	 */
+
+	constexpr TlsfHeap() :
+			freeLists_{},
+			secondLevelBitmaps_{},
+			firstLevelBitmap_{},
+			freeBlocks_{},
+			freeSize_{},
+			totalSize_{},
+			usedBlocks_{},
+			usedSize_{}
+	{
+
+	}
+
+	/**
+	 * \brief Allocates block of memory.
+	 *
+	 * Similar to malloc() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/malloc.html
+	 *
+	 * \param [in] size is the size of block of memory, bytes
+	 *
+	 * \return pointer to allocated block of memory, aligned to TlsfHeap::alignment, nullptr if there is no free block
+	 * large enough
+	 */
+
+	void* allocate(size_t size);
+
+	/**
+	 * \brief Allocates block of memory with given alignment.
+	 *
+	 * Similar to posix_memalign() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/posix_memalign.html
+	 *
+	 * \param [in] alignment is the required alignment of block of memory, must be a power of 2, bytes
+	 * \param [in] size is the size of block of memory, bytes
+	 *
+	 * \return pointer to allocated block of memory, nullptr if \a alignment is invalid or there is no free block large
+	 * enough
+	 */
+
+	void* allocateAligned(size_t alignment, size_t size);
+
+	/**
+	 * \brief Deallocates block of memory.
+	 *
+	 * Similar to free() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/free.html
+	 *
+	 * \param [in] pointer is a pointer to block of memory allocated from this heap, nullptr is ignored
+	 */
+
+	void deallocate(void* pointer);
+
+	/**
+	 * \return snapshot of usage of the heap
+	 */
+
+	HeapStatistics getStatistics() const;
+
+	/**
+	 * \brief Initializes the heap with given memory.
+	 *
+	 * \param [in] storage is a pointer to memory used by the heap
+	 * \param [in] size is the size of \a storage, bytes
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a storage is too small;
+	 */
+
+	int initialize(void* storage, size_t size);
+
+	/**
+	 * \brief Reallocates block of memory.
+	 *
+	 * Similar to realloc() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/realloc.html
+	 *
+	 * The block is resized in place if possible - when it is shrunk or when physically next block is free and large
+	 * enough. Otherwise new block is allocated, contents are copied and old block is deallocated.
+	 *
+	 * \param [in] pointer is a pointer to block of memory allocated from this heap, nullptr to just allocate new block
+	 * \param [in] size is the new size of block of memory, 0 to just deallocate the block, bytes
+	 *
+	 * \return pointer to reallocated block of memory, nullptr if \a size is 0 or if there is no free block large enough
+	 * (in this case the old block is left intact)
+	 */
+
+	void* reallocate(void* pointer, size_t size);
+
+	/**
+	 * \param [in] pointer is a pointer to block of memory allocated from TlsfHeap
+	 *
+	 * \return usable size of block of memory, bytes
+	 */
+
+	static size_t getUsableSize(const void* pointer);
+
+	TlsfHeap(const TlsfHeap&) = delete;
+	TlsfHeap(TlsfHeap&&) = delete;
+	const TlsfHeap& operator=(const TlsfHeap&) = delete;
+	TlsfHeap& operator=(TlsfHeap&&) = delete;
+
+private:
+
+	/// Block struct is a header of each block of memory
+	struct Block
+	{
+		/// pointer to physically previous block, nullptr for the first block
+		Block* previousPhysical;
+
+		/// size of block (excluding the header), bytes, two least significant bits are used as flags
+		size_t size;
+
+		/// pointer to next block on free list, valid only if the block is free
+		Block* nextFree;
+
+		/// pointer to previous block on free list, valid only if the block is free
+		Block* previousFree;
+	};
+
+	/// log2 of number of second level lists for each first level
+	constexpr static size_t secondLevelIndexLog2 {4};
+
+	/// number of second level lists for each first level
+	constexpr static size_t secondLevelIndexCount {1 << secondLevelIndexLog2};
+
+	/// shift of first level index - sizes below (1 << firstLevelIndexShift) are all mapped to first level 0
+	constexpr static size_t firstLevelIndexShift {secondLevelIndexLog2 + __builtin_ctz(alignment)};
+
+	/// log2 of max size of block, limits number of first levels and amount of memory used by the lists
+	constexpr static size_t firstLevelIndexMax {24};
+
+	/// number of first levels
+	constexpr static size_t firstLevelIndexCount {firstLevelIndexMax - firstLevelIndexShift + 1};
+
+	/// max size of block, bytes
+	constexpr static size_t maxBlockSize {(size_t{1} << (firstLevelIndexMax + 1)) - alignment};
+
+	/// size of header of each block - the part of Block which precedes memory returned by the heap, bytes
+	constexpr static size_t blockOverhead {2 * sizeof(void*)};
+
+	/// min size of block (excluding the header), large enough for pointers of free list, bytes
+	constexpr static size_t minBlockSize {(sizeof(Block) - blockOverhead + alignment - 1) / alignment * alignment};
+
+	static_assert(blockOverhead % alignment == 0, "Size of header of block must be a multiple of alignment!");
+	static_assert(firstLevelIndexCount < 32, "First level bitmap is too small!");
+
+	/// flag in Block::size which is set if the block is free
+	constexpr static size_t freeFlag {1};
+
+	/// flag in Block::size which is set if physically previous block is free
+	constexpr static size_t previousFreeFlag {2};
+
+	/// mask of all flags in Block::size
+	constexpr static size_t flagsMask {freeFlag | previousFreeFlag};
+
+	/**
+	 * \param [in] memory is a pointer to memory of block
+	 *
+	 * \return reference to block with \a memory
+	 */
+
+	static Block& getBlock(const void* const memory)
+	{
+		return *reinterpret_cast<Block*>(reinterpret_cast<uintptr_t>(memory) - blockOverhead);
+	}
+
+	/**
+	 * \param [in] block is a reference to block
+	 *
+	 * \return pointer to memory of \a block
+	 */
+
+	static uint8_t* getMemory(Block& block)
+	{
+		return reinterpret_cast<uint8_t*>(&block) + blockOverhead;
+	}
+
+	/**
+	 * \param [in] block is a reference to block
+	 *
+	 * \return reference to block which is physically next after \a block
+	 */
+
+	static Block& getNextPhysical(Block& block)
+	{
+		return *reinterpret_cast<Block*>(getMemory(block) + getSize(block));
+	}
+
+	/**
+	 * \param [in] block is a reference to block
+	 *
+	 * \return size of \a block (excluding the header), bytes
+	 */
+
+	static size_t getSize(const Block& block)
+	{
+		return block.size & ~flagsMask;
+	}
+
+	/**
+	 * \brief Maps size of block to indexes of free list.
+	 *
+	 * \param [in] size is the size of block, bytes
+	 *
+	 * \return pair with first level index and second level index of free list which holds blocks of size \a size
+	 */
+
+	static std::pair<size_t, size_t> map(size_t size);
+
+	/**
+	 * \brief Sets size of block, preserving its flags.
+	 *
+	 * \param [in] block is a reference to block
+	 * \param [in] size is the new size of \a block (excluding the header), bytes
+	 */
+
+	static void setSize(Block& block, const size_t size)
+	{
+		block.size = size | (block.size & flagsMask);
+	}
+
+	/**
+	 * \brief Finds free block large enough for given size and removes it from free lists.
+	 *
+	 * \param [in] size is the required size of block, bytes
+	 *
+	 * \return pointer to found free block, nullptr if there is no free block large enough
+	 */
+
+	Block* findFreeBlock(size_t size);
+
+	/**
+	 * \brief Inserts free block to appropriate free list.
+	 *
+	 * \param [in] block is a reference to free block which will be inserted
+	 */
+
+	void insertFreeBlock(Block& block);
+
+	/**
+	 * \brief Marks block as used and updates statistics.
+	 *
+	 * \param [in] block is a reference to block which will be marked as used
+	 *
+	 * \return pointer to memory of \a block
+	 */
+
+	void* markUsed(Block& block);
+
+	/**
+	 * \brief Removes free block from its free list.
+	 *
+	 * \param [in] block is a reference to free block which will be removed
+	 */
+
+	void removeFreeBlock(Block& block);
+
+	/**
+	 * \brief Splits block, so that it has given size.
+	 *
+	 * If the remainder is large enough, it is turned into a free block (merged with physically next block if it is also
+	 * free) and inserted to free lists. Otherwise \a block is not changed.
+	 *
+	 * \param [in] block is a reference to block which is not on free lists
+	 * \param [in] size is the required size of \a block, bytes
+	 */
+
+	void split(Block& block, size_t size);
+
+	/// array with heads of free lists, indexed by first and second level
+	Block* freeLists_[firstLevelIndexCount][secondLevelIndexCount];
+
+	/// bitmaps of non-empty second level lists, one for each first level
+	uint32_t secondLevelBitmaps_[firstLevelIndexCount];
+
+	/// bitmap of first levels with non-empty second level lists
+	uint32_t firstLevelBitmap_;
+
+	/// number of free blocks
+	size_t freeBlocks_;
+
+	/// total size of free blocks, bytes
+	size_t freeSize_;
+
+	/// total size of the heap, bytes
+	size_t totalSize_;
+
+	/// number of used blocks
+	size_t usedBlocks_;
+
+	/// total size of used blocks, bytes
+	size_t usedSize_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAP_HPP_
@@ -0,0 +1,86 @@
+/**
+ * \file
+ * \brief TlsfHeapLock class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAPLOCK_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAPLOCK_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_TLSF_HEAP_INTERRUPT_MASKING_ENABLE == 1
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#else	// DISTORTOS_TLSF_HEAP_INTERRUPT_MASKING_ENABLE != 1
+
+#include "distortos/internal/newlib/locking.hpp"
+
+#endif	// DISTORTOS_TLSF_HEAP_INTERRUPT_MASKING_ENABLE != 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+#if DISTORTOS_TLSF_HEAP_INTERRUPT_MASKING_ENABLE == 1
+
+/// TlsfHeapLock class is a RAII lock of main instance of TlsfHeap - interrupts are masked
+class TlsfHeapLock : private InterruptMaskingLock
+{
+
+};
+
+#else	// DISTORTOS_TLSF_HEAP_INTERRUPT_MASKING_ENABLE != 1
+
+/// TlsfHeapLock class is a RAII lock of main instance of TlsfHeap - Mutex used for malloc() and free() is locked
+class TlsfHeapLock
+{
+public:
+
+	/**
+	 * \brief TlsfHeapLock's constructor
+	 *
+	 * Recursively locks Mutex used for malloc() and free() locking.
+	 */
+
+	TlsfHeapLock()
+	{
+		getMallocMutex().lock();
+	}
+
+	/**
+	 * \brief TlsfHeapLock's destructor
+	 *
+	 * Recursively unlocks Mutex used for malloc() and free() locking.
+	 */
+
+	~TlsfHeapLock()
+	{
+		getMallocMutex().unlock();
+	}
+
+	TlsfHeapLock(const TlsfHeapLock&) = delete;
+	TlsfHeapLock(TlsfHeapLock&&) = delete;
+	const TlsfHeapLock& operator=(const TlsfHeapLock&) = delete;
+	TlsfHeapLock& operator=(TlsfHeapLock&&) = delete;
+};
+
+#endif	// DISTORTOS_TLSF_HEAP_INTERRUPT_MASKING_ENABLE != 1
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAPLOCK_HPP_
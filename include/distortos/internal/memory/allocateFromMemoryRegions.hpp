@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief allocateFromMemoryRegions() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_ALLOCATEFROMMEMORYREGIONS_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_ALLOCATEFROMMEMORYREGIONS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/MemoryCapabilities.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief Allocates memory from a region with requested capabilities.
+ *
+ * Same as memoryRegions::allocate(), but failure of allocation is a fatal error - just like failure of operator new
+ * when exceptions are disabled. Memory should be deallocated with memoryRegions::deallocate().
+ *
+ * \param [in] capabilities are the required capabilities, MemoryCapabilities::none matches any region
+ * \param [in] size is the size of memory, bytes
+ * \param [in] alignment is the required alignment of memory, must be a power of 2, default - alignof(max_align_t)
+ *
+ * \return pointer to allocated memory
+ */
+
+void* allocateFromMemoryRegions(MemoryCapabilities capabilities, size_t size, size_t alignment = alignof(max_align_t));
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_ALLOCATEFROMMEMORYREGIONS_HPP_
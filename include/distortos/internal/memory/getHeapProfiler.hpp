@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief getHeapProfiler() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETHEAPPROFILER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETHEAPPROFILER_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class HeapProfiler;
+
+/**
+ * \return reference to main instance of HeapProfiler, which records operations of malloc() and free()
+ */
+
+constexpr HeapProfiler& getHeapProfiler()
+{
+	extern HeapProfiler heapProfilerInstance;
+	return heapProfilerInstance;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETHEAPPROFILER_HPP_
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief getThreadRecyclingCache() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETTHREADRECYCLINGCACHE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETTHREADRECYCLINGCACHE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadRecyclingCache;
+
+/**
+ * \return reference to main instance of ThreadRecyclingCache
+ */
+
+constexpr ThreadRecyclingCache& getThreadRecyclingCache()
+{
+	extern ThreadRecyclingCache threadRecyclingCacheInstance;
+	return threadRecyclingCacheInstance;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETTHREADRECYCLINGCACHE_HPP_
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief getTlsfHeap() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETTLSFHEAP_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETTLSFHEAP_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class TlsfHeap;
+
+/**
+ * \return reference to main instance of TlsfHeap, used by malloc() and free()
+ */
+
+constexpr TlsfHeap& getTlsfHeap()
+{
+	extern TlsfHeap tlsfHeapInstance;
+	return tlsfHeapInstance;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETTLSFHEAP_HPP_
@@ -0,0 +1,53 @@
+/**
+ * \file
+ * \brief profiledMalloc() and profiledFree() declarations
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_PROFILEDMALLOC_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_PROFILEDMALLOC_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief Same as free(), but with explicit return address of caller recorded by heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ * \param [in] caller is the return address of the function which called deallocation function
+ */
+
+void profiledFree(void* memory, const void* caller);
+
+/**
+ * \brief Same as malloc(), but with explicit return address of caller recorded by heap profiler.
+ *
+ * \param [in] size is the size of memory, bytes
+ * \param [in] caller is the return address of the function which called allocation function
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise (errno is set to ENOMEM)
+ */
+
+void* profiledMalloc(size_t size, const void* caller);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_PROFILEDMALLOC_HPP_
@@ -15,11 +15,21 @@
 #include "distortos/DynamicSignalsReceiver.hpp"
 #include "distortos/DynamicThreadParameters.hpp"
 
+#include "distortos/internal/memory/dummyDeleter.hpp"
 #include "distortos/internal/memory/storageDeleter.hpp"
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/internal/memory/allocateFromMemoryRegions.hpp"
+
+#include "distortos/memoryRegions.hpp"
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 #include "distortos/internal/scheduler/ThreadCommon.hpp"
 
 #include <functional>
+#include <new>
 
 namespace distortos
 {
@@ -40,13 +50,19 @@ namespace internal
  * If thread detachment is enabled (DISTORTOS_THREAD_DETACH_ENABLE is defined) then this class is dynamically allocated
  * by DynamicThread - which allows it to be "detached". Otherwise - if thread detachment is disabled
  * (DISTORTOS_THREAD_DETACH_ENABLE is not defined) - DynamicThread just inherits from this class.
+ *
+ * Stack and storage for internal DynamicSignalsReceiver object are placed in a single block of dynamic memory. If
+ * thread detachment is enabled, objects can be made only with make(), which places the object itself at the beginning
+ * of the same block. Such blocks are allocated from ThreadRecyclingCache, so they can be reused by threads with the
+ * same parameters. If memory regions are enabled, the block is allocated from memory region with capabilities selected
+ * by DynamicThreadParameters::memoryCapabilities.
  */
 
 class DynamicThreadBase : public ThreadCommon
 {
 public:
 
-#if DISTORTOS_THREAD_DETACH_ENABLE == 1
+#if DISTORTOS_THREAD_DETACH_ENABLE != 1
 
 	/**
 	 * \brief DynamicThreadBase's constructor
@@ -63,17 +79,13 @@ public:
 	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
 	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicy is the scheduling policy of the thread
-	 * \param [in] owner is a reference to owner DynamicThread object
 	 * \param [in] function is a function that will be executed in separate thread
 	 * \param [in] args are arguments for \a function
 	 */
 
 	template<typename Function, typename... Args>
 	DynamicThreadBase(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, DynamicThread& owner, Function&& function,
-			Args&&... args);
-
-#else	// DISTORTOS_THREAD_DETACH_ENABLE != 1
+			uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args);
 
 	/**
 	 * \brief DynamicThreadBase's constructor
@@ -81,6 +93,42 @@ public:
 	 * \tparam Function is the function that will be executed in separate thread
 	 * \tparam Args are the arguments for \a Function
 	 *
+	 * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 */
+
+	template<typename Function, typename... Args>
+	DynamicThreadBase(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+			DynamicThreadBase{makeStorage(static_cast<uint8_t*>(allocateFromMemoryRegions(parameters.memoryCapabilities,
+					getBlockSize(0, parameters.stackSize, parameters.canReceiveSignals, parameters.queuedSignals,
+					parameters.signalActions))), 0, memoryRegions::deallocate, parameters.stackSize,
+					parameters.canReceiveSignals, parameters.queuedSignals, parameters.signalActions),
+					parameters.priority, parameters.schedulingPolicy, std::forward<Function>(function),
+					std::forward<Args>(args)...}
+#else	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
+			DynamicThreadBase{parameters.stackSize, parameters.canReceiveSignals, parameters.queuedSignals,
+					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
+					std::forward<Function>(function), std::forward<Args>(args)...}
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
+	{
+
+	}
+
+#endif	// DISTORTOS_THREAD_DETACH_ENABLE != 1
+
+#if DISTORTOS_THREAD_DETACH_ENABLE == 1
+
+	/**
+	 * \brief Makes DynamicThreadBase object with single dynamic allocation.
+	 *
+	 * The object, its stack and storage for its internal DynamicSignalsReceiver object are all placed in a single block
+	 * of dynamic memory, which is deallocated when the object is deleted.
+	 *
+	 * \tparam Function is the function that will be executed in separate thread
+	 * \tparam Args are the arguments for \a Function
+	 *
 	 * \param [in] stackSize is the size of stack, bytes
 	 * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
 	 * thread
@@ -90,37 +138,30 @@ public:
 	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
 	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicy is the scheduling policy of the thread
+	 * \param [in] memoryCapabilities are the required capabilities of memory region used for the block, relevant only
+	 * if memory regions are enabled
+	 * \param [in] owner is a reference to owner DynamicThread object
 	 * \param [in] function is a function that will be executed in separate thread
 	 * \param [in] args are arguments for \a function
+	 *
+	 * \return pointer to DynamicThreadBase object, which should be deleted with delete operator
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThreadBase(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args);
+	static DynamicThreadBase* make(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
+			uint8_t priority, SchedulingPolicy schedulingPolicy, MemoryCapabilities memoryCapabilities,
+			DynamicThread& owner, Function&& function, Args&&... args);
 
 	/**
-	 * \brief DynamicThreadBase's constructor
+	 * \brief DynamicThreadBase's deallocation function
 	 *
-	 * \tparam Function is the function that will be executed in separate thread
-	 * \tparam Args are the arguments for \a Function
+	 * Objects made with make() are placed at the beginning of a block allocated from ThreadRecyclingCache, so the same
+	 * block is returned to the cache here.
 	 *
-	 * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
-	 * \param [in] function is a function that will be executed in separate thread
-	 * \param [in] args are arguments for \a function
+	 * \param [in] pointer is a pointer to deallocated object
 	 */
 
-	template<typename Function, typename... Args>
-	DynamicThreadBase(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
-			DynamicThreadBase{parameters.stackSize, parameters.canReceiveSignals, parameters.queuedSignals,
-					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
-					std::forward<Function>(function), std::forward<Args>(args)...}
-	{
-
-	}
-
-#endif	// DISTORTOS_THREAD_DETACH_ENABLE != 1
-
-#if DISTORTOS_THREAD_DETACH_ENABLE == 1
+	static void operator delete(void* pointer);
 
 	/**
 	 * \brief Detaches the thread.
@@ -194,26 +235,135 @@ protected:
 
 private:
 
+	/// Storage struct has the stack and - if signals are enabled - storage for internal DynamicSignalsReceiver object,
+	/// all placed in a single block of dynamic memory
+	struct Storage
+	{
+		/// stack of the thread
+		Stack stack;
+
+#if DISTORTOS_SIGNALS_ENABLE == 1
+
+		/// storage for queued signals, nullptr if queuing of signals is disabled
+		SignalInformationQueueWrapper::Storage* queuedSignalsStorage;
+
+		/// max number of queued signals
+		size_t queuedSignals;
+
+		/// storage for SignalAction associations, nullptr if catching of signals is disabled
+		SignalsCatcher::Storage* signalActionsStorage;
+
+		/// max number of different SignalAction objects
+		size_t signalActions;
+
+		/// selects whether reception of signals is enabled (true) or disabled (false)
+		bool canReceiveSignals;
+
+#endif	// DISTORTOS_SIGNALS_ENABLE == 1
+	};
+
+#if DISTORTOS_THREAD_DETACH_ENABLE == 1
+
 	/**
-	 * \brief Helper function to make stack with size adjusted to alignment requirements
+	 * \brief DynamicThreadBase's constructor
 	 *
-	 * Size of "stack guard" is added to function argument.
+	 * \tparam Function is the function that will be executed in separate thread
+	 * \tparam Args are the arguments for \a Function
 	 *
+	 * \param [in] storage is a rvalue reference to Storage struct with stack and storage for signals
+	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicy is the scheduling policy of the thread
+	 * \param [in] owner is a reference to owner DynamicThread object
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 */
+
+	template<typename Function, typename... Args>
+	DynamicThreadBase(Storage&& storage, uint8_t priority, SchedulingPolicy schedulingPolicy, DynamicThread& owner,
+			Function&& function, Args&&... args);
+
+#else	// DISTORTOS_THREAD_DETACH_ENABLE != 1
+
+	/**
+	 * \brief DynamicThreadBase's constructor
+	 *
+	 * \tparam Function is the function that will be executed in separate thread
+	 * \tparam Args are the arguments for \a Function
+	 *
+	 * \param [in] storage is a rvalue reference to Storage struct with stack and storage for signals
+	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicy is the scheduling policy of the thread
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 */
+
+	template<typename Function, typename... Args>
+	DynamicThreadBase(Storage&& storage, uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function,
+			Args&&... args);
+
+#endif	// DISTORTOS_THREAD_DETACH_ENABLE != 1
+
+#if DISTORTOS_THREAD_DETACH_ENABLE == 1
+
+	/**
+	 * \brief Allocates block of memory for make().
+	 *
+	 * Before the allocation, deferred deletion of terminated detached threads is attempted, so that their blocks may be
+	 * reused. The block is allocated from ThreadRecyclingCache.
+	 *
+	 * \param [in] size is the size of block of memory, bytes
+	 * \param [in] memoryCapabilities are the required capabilities of memory region used for the block, relevant only
+	 * if memory regions are enabled
+	 *
+	 * \return pointer to allocated block of memory
+	 */
+
+	static uint8_t* allocateBlock(size_t size, MemoryCapabilities memoryCapabilities);
+
+#endif	// DISTORTOS_THREAD_DETACH_ENABLE == 1
+
+	/**
+	 * \brief Calculates size of single block of memory for stack and storage for signals.
+	 *
+	 * Size of "stack guard" is added to \a stackSize, which is also adjusted to alignment requirements.
+	 *
+	 * \param [in] offset is the offset of stack in the block, bytes, must be a multiple of
+	 * DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT
 	 * \param [in] stackSize is the size of stack, bytes
+	 * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
+	 * thread
+	 * \param [in] queuedSignals is the max number of queued signals for this thread, relevant only if
+	 * \a canReceiveSignals == true
+	 * \param [in] signalActions is the max number of different SignalAction objects for this thread, relevant only if
+	 * \a canReceiveSignals == true
 	 *
-	 * \return Stack object with size adjusted to alignment requirements
+	 * \return size of block of memory, bytes
 	 */
 
-	static Stack makeStack(const size_t stackSize)
-	{
-		static_assert(alignof(max_align_t) >= DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT,
-				"Alignment of dynamically allocated memory is too low!");
+	static size_t getBlockSize(size_t offset, size_t stackSize, bool canReceiveSignals, size_t queuedSignals,
+			size_t signalActions);
 
-		const auto adjustedStackSize = (stackSize + DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT - 1) /
-				DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT * DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT;
-		return {{new uint8_t[adjustedStackSize + stackGuardSize], storageDeleter<uint8_t>},
-				adjustedStackSize + stackGuardSize};
-	}
+	/**
+	 * \brief Makes Storage struct with all its elements placed in provided block of memory.
+	 *
+	 * \param [in] block is a pointer to block of memory with size returned by getBlockSize() called with the same
+	 * arguments
+	 * \param [in] offset is the offset of stack in the block, bytes, must be a multiple of
+	 * DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT
+	 * \param [in] deleter is a reference to deleter of stack's storage, which is located at \a block + \a offset
+	 * \param [in] stackSize is the size of stack, bytes
+	 * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
+	 * thread
+	 * \param [in] queuedSignals is the max number of queued signals for this thread, relevant only if
+	 * \a canReceiveSignals == true
+	 * \param [in] signalActions is the max number of different SignalAction objects for this thread, relevant only if
+	 * \a canReceiveSignals == true
+	 *
+	 * \return Storage struct with stack and storage for signals placed in \a block
+	 */
+
+	static Storage makeStorage(uint8_t* block, size_t offset, void (& deleter)(void*), size_t stackSize,
+			bool canReceiveSignals, size_t queuedSignals, size_t signalActions);
 
 #if DISTORTOS_SIGNALS_ENABLE == 1
 
@@ -233,16 +383,55 @@ private:
 #endif	// DISTORTOS_THREAD_DETACH_ENABLE == 1
 };
 
-#if DISTORTOS_SIGNALS_ENABLE == 1 && DISTORTOS_THREAD_DETACH_ENABLE == 1
+#if DISTORTOS_THREAD_DETACH_ENABLE == 1
+
+template<typename Function, typename... Args>
+DynamicThreadBase* DynamicThreadBase::make(const size_t stackSize, const bool canReceiveSignals,
+		const size_t queuedSignals, const size_t signalActions, const uint8_t priority,
+		const SchedulingPolicy schedulingPolicy, const MemoryCapabilities memoryCapabilities, DynamicThread& owner,
+		Function&& function, Args&&... args)
+{
+	static_assert(alignof(max_align_t) >= alignof(DynamicThreadBase),
+			"Alignment of dynamically allocated memory is too low!");
+
+	// stack is placed right after the object, so the object's size must be adjusted to alignment requirements of stack
+	constexpr size_t offset
+	{
+		(sizeof(DynamicThreadBase) + DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT - 1) /
+				DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT * DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT
+	};
+	const auto block = allocateBlock(getBlockSize(offset, stackSize, canReceiveSignals, queuedSignals, signalActions),
+			memoryCapabilities);
+	return new (block) DynamicThreadBase{makeStorage(block, offset, dummyDeleter<uint8_t>, stackSize,
+			canReceiveSignals, queuedSignals, signalActions), priority, schedulingPolicy, owner,
+			std::forward<Function>(function), std::forward<Args>(args)...};
+}
+
+#else	// DISTORTOS_THREAD_DETACH_ENABLE != 1
 
 template<typename Function, typename... Args>
 DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
 		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+		Function&& function, Args&&... args) :
+				DynamicThreadBase{makeStorage(new uint8_t[getBlockSize(0, stackSize, canReceiveSignals, queuedSignals,
+						signalActions)], 0, storageDeleter<uint8_t>, stackSize, canReceiveSignals, queuedSignals,
+						signalActions), priority, schedulingPolicy, std::forward<Function>(function),
+						std::forward<Args>(args)...}
+{
+
+}
+
+#endif	// DISTORTOS_THREAD_DETACH_ENABLE != 1
+
+#if DISTORTOS_SIGNALS_ENABLE == 1 && DISTORTOS_THREAD_DETACH_ENABLE == 1
+
+template<typename Function, typename... Args>
+DynamicThreadBase::DynamicThreadBase(Storage&& storage, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
 		DynamicThread& owner, Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr,
-						canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
-				dynamicSignalsReceiver_{canReceiveSignals == true ? queuedSignals : 0,
-						canReceiveSignals == true ? signalActions : 0},
+				ThreadCommon{std::move(storage.stack), priority, schedulingPolicy, nullptr,
+						storage.canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
+				dynamicSignalsReceiver_{storage.queuedSignalsStorage, storage.queuedSignals,
+						storage.signalActionsStorage, storage.signalActions},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)},
 				owner_{&owner}
 {
@@ -252,13 +441,12 @@ DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canRecei
 #elif DISTORTOS_SIGNALS_ENABLE == 1 && DISTORTOS_THREAD_DETACH_ENABLE != 1
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
-		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+DynamicThreadBase::DynamicThreadBase(Storage&& storage, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
 		Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr,
-						canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
-				dynamicSignalsReceiver_{canReceiveSignals == true ? queuedSignals : 0,
-						canReceiveSignals == true ? signalActions : 0},
+				ThreadCommon{std::move(storage.stack), priority, schedulingPolicy, nullptr,
+						storage.canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
+				dynamicSignalsReceiver_{storage.queuedSignalsStorage, storage.queuedSignals,
+						storage.signalActionsStorage, storage.signalActions},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
 {
 
@@ -267,9 +455,9 @@ DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canRecei
 #elif DISTORTOS_SIGNALS_ENABLE != 1 && DISTORTOS_THREAD_DETACH_ENABLE == 1
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, bool, size_t, size_t, const uint8_t priority,
-		const SchedulingPolicy schedulingPolicy, DynamicThread& owner, Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr, nullptr},
+DynamicThreadBase::DynamicThreadBase(Storage&& storage, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+		DynamicThread& owner, Function&& function, Args&&... args) :
+				ThreadCommon{std::move(storage.stack), priority, schedulingPolicy, nullptr, nullptr},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)},
 				owner_{&owner}
 {
@@ -279,9 +467,9 @@ DynamicThreadBase::DynamicThreadBase(const size_t stackSize, bool, size_t, size_
 #else	// DISTORTOS_SIGNALS_ENABLE != 1 && DISTORTOS_THREAD_DETACH_ENABLE != 1
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, bool, size_t, size_t, const uint8_t priority,
-		const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr, nullptr},
+DynamicThreadBase::DynamicThreadBase(Storage&& storage, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+		Function&& function, Args&&... args) :
+				ThreadCommon{std::move(storage.stack), priority, schedulingPolicy, nullptr, nullptr},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
 {
 
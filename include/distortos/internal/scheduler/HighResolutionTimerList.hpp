@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \brief HighResolutionTimerList class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_HIGHRESOLUTIONTIMERLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_HIGHRESOLUTIONTIMERLIST_HPP_
+
+#include "distortos/internal/scheduler/HighResolutionTimerListNode.hpp"
+
+#include "estd/SortedIntrusiveList.hpp"
+
+namespace distortos
+{
+
+class HighResolutionTimer;
+
+namespace internal
+{
+
+/// functor which gives ascending deadline order of elements on the list
+struct HighResolutionTimerAscendingDeadline
+{
+	/**
+	 * \brief HighResolutionTimerAscendingDeadline's constructor
+	 */
+
+	constexpr HighResolutionTimerAscendingDeadline()
+	{
+
+	}
+
+	/**
+	 * \brief HighResolutionTimerAscendingDeadline's function call operator
+	 *
+	 * \param [in] left is the object on the left side of comparison
+	 * \param [in] right is the object on the right side of comparison
+	 *
+	 * \return true if left's deadline is greater than right's deadline
+	 */
+
+	bool operator()(const HighResolutionTimerListNode& left, const HighResolutionTimerListNode& right) const
+	{
+		return left.getDeadline() > right.getDeadline();
+	}
+};
+
+/// sorted intrusive list of high-resolution timers
+using HighResolutionTimerList = estd::SortedIntrusiveList<HighResolutionTimerAscendingDeadline,
+		HighResolutionTimerListNode, &HighResolutionTimerListNode::node, HighResolutionTimer>;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_HIGHRESOLUTIONTIMERLIST_HPP_
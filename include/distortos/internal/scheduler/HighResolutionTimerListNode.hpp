@@ -0,0 +1,80 @@
+/**
+ * \file
+ * \brief HighResolutionTimerListNode class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_HIGHRESOLUTIONTIMERLISTNODE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_HIGHRESOLUTIONTIMERLISTNODE_HPP_
+
+#include "estd/IntrusiveList.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief HighResolutionTimerListNode class is a base for HighResolutionTimer that serves as a node in intrusive list of
+ * high-resolution timers
+ *
+ * This class is needed to break any potential circular dependencies.
+ */
+
+class HighResolutionTimerListNode
+{
+public:
+
+	/**
+	 * \brief HighResolutionTimerListNode's constructor
+	 */
+
+	constexpr HighResolutionTimerListNode() :
+			node{},
+			deadline_{}
+	{
+
+	}
+
+	/**
+	 * \return deadline, ticks of counter of hardware timer
+	 */
+
+	uint64_t getDeadline() const
+	{
+		return deadline_;
+	}
+
+	/// node for intrusive list
+	estd::IntrusiveListNode node;
+
+protected:
+
+	/**
+	 * \brief Sets deadline.
+	 *
+	 * \param [in] deadline is the new deadline, ticks of counter of hardware timer
+	 */
+
+	void setDeadline(const uint64_t deadline)
+	{
+		deadline_ = deadline;
+	}
+
+private:
+
+	/// deadline, ticks of counter of hardware timer
+	uint64_t deadline_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_HIGHRESOLUTIONTIMERLISTNODE_HPP_
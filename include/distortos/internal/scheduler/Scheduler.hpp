@@ -14,6 +14,7 @@
 
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
 #include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/internal/scheduler/ThreadPriorityQueue.hpp"
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
 namespace distortos
@@ -37,7 +38,8 @@ public:
 			suspendedList_{},
 			softwareTimerSupervisor_{},
 			contextSwitchCount_{},
-			tickCount_{}
+			tickCounts_{},
+			tickCountSequence_{}
 	{
 
 	}
@@ -113,6 +115,46 @@ public:
 	int blockUntil(ThreadList& container, ThreadState state, TickClock::time_point timePoint,
 			const UnblockFunctor* unblockFunctor = {});
 
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+	/**
+	 * \brief Blocks current thread, transferring it to provided queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] container is a reference to destination queue to which the thread will be transferred
+	 * \param [in] state is the new state of thread that will be blocked
+	 * \param [in] unblockFunctor is a pointer to UnblockFunctor which will be executed in
+	 * ThreadControlBlock::unblockHook(), default - nullptr (no functor will be executed)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - thread was unblocked with UnblockReason::signal;
+	 * - ETIMEDOUT - thread was unblocked with UnblockReason::timeout;
+	 */
+
+	int block(ThreadPriorityQueue& container, ThreadState state, const UnblockFunctor* unblockFunctor = {});
+
+	/**
+	 * \brief Blocks current thread with timeout, transferring it to provided queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] container is a reference to destination queue to which the thread will be transferred
+	 * \param [in] state is the new state of thread that will be blocked
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 * \param [in] unblockFunctor is a pointer to UnblockFunctor which will be executed in
+	 * ThreadControlBlock::unblockHook(), default - nullptr (no functor will be executed)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - thread was unblocked with UnblockReason::signal;
+	 * - ETIMEDOUT - thread was unblocked because timePoint was reached;
+	 */
+
+	int blockUntil(ThreadPriorityQueue& container, ThreadState state, TickClock::time_point timePoint,
+			const UnblockFunctor* unblockFunctor = {});
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
 	/**
 	 * \return number of context switches
 	 */
@@ -147,6 +189,9 @@ public:
 	}
 
 	/**
+	 * \note This function doesn't mask interrupts - tick count is protected with a sequence lock, so it can be read
+	 * from any context, including interrupts with priority higher than the priority of tick interrupt.
+	 *
 	 * \return current value of tick count
 	 */
 
@@ -166,6 +211,15 @@ public:
 
 	int initialize(ThreadControlBlock& mainThreadControlBlock);
 
+	/**
+	 * \return true if scheduler was already initialized with initialize(), false otherwise
+	 */
+
+	bool isInitialized() const
+	{
+		return currentThreadControlBlock_ != ThreadList::iterator{};
+	}
+
 	/**
 	 * \brief Requests context switch if it is needed.
 	 *
@@ -287,11 +341,34 @@ private:
 
 	int addInternal(ThreadControlBlock& threadControlBlock);
 
+	/**
+	 * \brief Implementation of block() and blockUntil() for any type of container.
+	 *
+	 * \tparam Container is the type of destination container - ThreadList or ThreadPriorityQueue
+	 *
+	 * \param [in] container is a reference to destination container to which the thread will be transferred
+	 * \param [in] iterator is the iterator to the thread that will be blocked
+	 * \param [in] state is the new state of thread that will be blocked
+	 * \param [in] unblockFunctor is a pointer to UnblockFunctor which will be executed in
+	 * ThreadControlBlock::unblockHook()
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - thread was unblocked with UnblockReason::signal (possible only when blocking current thread);
+	 * - EINVAL - provided thread is not on "runnable" list;
+	 * - ETIMEDOUT - thread was unblocked with UnblockReason::timeout (possible only when blocking current thread);
+	 */
+
+	template<typename Container>
+	int blockImplementation(Container& container, ThreadList::iterator iterator, ThreadState state,
+			const UnblockFunctor* unblockFunctor);
+
 	/**
 	 * \brief Blocks thread, transferring it to provided container.
 	 *
 	 * Internal version - without interrupt masking and forced context switch.
 	 *
+	 * \tparam Container is the type of destination container - ThreadList or ThreadPriorityQueue
+	 *
 	 * \param [in] container is a reference to destination container to which the thread will be transferred
 	 * \param [in] iterator is the iterator to the thread that will be blocked
 	 * \param [in] state is the new state of thread that will be blocked
@@ -302,7 +379,28 @@ private:
 	 * - EINVAL - provided thread is not on "runnable" list;
 	 */
 
-	int blockInternal(ThreadList& container, ThreadList::iterator iterator, ThreadState state,
+	template<typename Container>
+	int blockInternal(Container& container, ThreadList::iterator iterator, ThreadState state,
+			const UnblockFunctor* unblockFunctor);
+
+	/**
+	 * \brief Implementation of blockUntil() for any type of container.
+	 *
+	 * \tparam Container is the type of destination container - ThreadList or ThreadPriorityQueue
+	 *
+	 * \param [in] container is a reference to destination container to which the thread will be transferred
+	 * \param [in] state is the new state of thread that will be blocked
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 * \param [in] unblockFunctor is a pointer to UnblockFunctor which will be executed in
+	 * ThreadControlBlock::unblockHook()
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - thread was unblocked with UnblockReason::signal;
+	 * - ETIMEDOUT - thread was unblocked because timePoint was reached;
+	 */
+
+	template<typename Container>
+	int blockUntilImplementation(Container& container, ThreadState state, TickClock::time_point timePoint,
 			const UnblockFunctor* unblockFunctor);
 
 	/**
@@ -347,8 +445,11 @@ private:
 	/// number of context switches
 	uint64_t contextSwitchCount_;
 
-	/// tick count
-	uint64_t tickCount_;
+	/// two copies of tick count, readers use the one selected by the lowest bit of tickCountSequence_
+	uint64_t tickCounts_[2];
+
+	/// sequence counter of updates of tick count, incremented twice per tick
+	uint32_t tickCountSequence_;
 };
 
 }	// namespace internal
@@ -14,6 +14,14 @@
 
 #include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#include "distortos/HighResolutionClock.hpp"
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 namespace distortos
 {
 
@@ -42,8 +50,15 @@ public:
 	constexpr SoftwareTimerControlBlock(FunctionRunner& functionRunner, SoftwareTimer& owner) :
 			SoftwareTimerListNode{},
 			period_{},
+			slack_{},
 			functionRunner_{functionRunner},
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+			owner_{owner},
+			expiryTimePoint_{},
+			deferred_{}
+#else	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE != 1
 			owner_{owner}
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE != 1
 	{
 
 	}
@@ -59,26 +74,110 @@ public:
 		stop();
 	}
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \return time point at which the timer expired and was passed to SoftwareTimerDaemon
+	 */
+
+	HighResolutionClock::time_point getExpiryTimePoint() const
+	{
+		return expiryTimePoint_;
+	}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 	/**
-	 * \return true if the timer is running, false otherwise
+	 * \return slack of the timer
+	 */
+
+	TickClock::duration getSlack() const
+	{
+		return slack_;
+	}
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \return true if function of the timer is executed by SoftwareTimerDaemon, false if it is executed from "tick"
+	 * interrupt handler
+	 */
+
+	bool isDeferred() const
+	{
+		return deferred_;
+	}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \return true if the timer is running (including execution of its function by SoftwareTimerDaemon), false
+	 * otherwise
 	 */
 
 	bool isRunning() const
 	{
 		asm("" ::: "memory");	// required for LTO
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+		if (isExecutedByDaemon() == true)
+			return true;
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
 		return node.isLinked() != false || period_ != decltype(period_){};
 	}
 
 	/**
 	 * \brief Runs software timer's function.
 	 *
-	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler()
+	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler() or by SoftwareTimerDaemon
 	 *
 	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor that manages this object
 	 */
 
 	void run(SoftwareTimerSupervisor& supervisor);
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \brief Selects where function of the timer is executed.
+	 *
+	 * New value is used when the timer expires for the next time.
+	 *
+	 * \param [in] deferred selects whether function of the timer is executed by SoftwareTimerDaemon (true) or from
+	 * "tick" interrupt handler (false)
+	 */
+
+	void setDeferred(const bool deferred)
+	{
+		deferred_ = deferred;
+	}
+
+	/**
+	 * \brief Sets time point at which the timer expired and was passed to SoftwareTimerDaemon.
+	 *
+	 * \note this should only be called by SoftwareTimerDaemon
+	 *
+	 * \param [in] expiryTimePoint is the time point at which the timer expired
+	 */
+
+	void setExpiryTimePoint(const HighResolutionClock::time_point expiryTimePoint)
+	{
+		expiryTimePoint_ = expiryTimePoint;
+	}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \brief Sets slack of the timer.
+	 *
+	 * Function of the timer may be executed up to \a slack later than requested, if this allows to execute it in the
+	 * same tick as functions of other software timers. New value is used when the timer is started (or restarted) for
+	 * the next time.
+	 *
+	 * \param [in] slack is the new slack of the timer, negative values are treated as 0
+	 */
+
+	void setSlack(TickClock::duration slack);
+
 	/**
 	 * \brief Starts the timer.
 	 *
@@ -91,6 +190,9 @@ public:
 
 	/**
 	 * \brief Stops the timer.
+	 *
+	 * If function of the timer is currently executed by SoftwareTimerDaemon, waits until it returns (unless this is
+	 * called from interrupt context or from the function of the timer).
 	 */
 
 	void stop();
@@ -102,6 +204,16 @@ public:
 
 private:
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/**
+	 * \return true if function of the timer is currently executed by SoftwareTimerDaemon, false otherwise
+	 */
+
+	bool isExecutedByDaemon() const;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 	/**
 	 * \brief Starts the timer - internal version, with no interrupt masking, no stopping and no configuration of
 	 * period.
@@ -121,11 +233,24 @@ private:
 	/// period used to restart repetitive software timer, 0 for one-shot software timers
 	TickClock::duration period_;
 
+	/// duration by which execution of the function may be delayed to coalesce it with other software timers
+	TickClock::duration slack_;
+
 	/// reference to runner for software timer's function
 	FunctionRunner& functionRunner_;
 
 	/// reference to SoftwareTimer object that owns this SoftwareTimerControlBlock
 	SoftwareTimer& owner_;
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	/// time point at which the timer expired and was passed to SoftwareTimerDaemon
+	HighResolutionClock::time_point expiryTimePoint_;
+
+	/// true if function of the timer is executed by SoftwareTimerDaemon, false otherwise
+	bool deferred_;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
 };
 
 }	// namespace internal
@@ -0,0 +1,167 @@
+/**
+ * \file
+ * \brief SoftwareTimerDaemon class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERDAEMON_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERDAEMON_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerList.hpp"
+
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+/**
+ * \brief SoftwareTimerDaemon class executes functions of software timers in the context of a thread.
+ *
+ * "Tick" interrupt handler only moves expired software timers with deferred execution to the list of timers waiting
+ * for execution and wakes the daemon thread, which then executes all of them in a batch. Thanks to that functions of
+ * such timers don't increase interrupt latency and may use blocking functions.
+ */
+
+class SoftwareTimerDaemon
+{
+public:
+
+	/**
+	 * \brief SoftwareTimerDaemon's constructor
+	 */
+
+	constexpr SoftwareTimerDaemon() :
+			readyList_{},
+			executionMutex_{Mutex::Protocol::priorityInheritance},
+			semaphore_{0, 1},
+			executedSoftwareTimerControlBlock_{},
+			threadControlBlock_{},
+			executionCount_{},
+			maxQueueingDelay_{},
+			totalQueueingDelay_{}
+	{
+
+	}
+
+	/**
+	 * \brief Adds expired software timer to the list of timers waiting for execution and wakes the daemon thread.
+	 *
+	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler()
+	 *
+	 * \param [in] softwareTimerControlBlock is a reference to SoftwareTimerControlBlock of expired software timer
+	 */
+
+	void add(SoftwareTimerControlBlock& softwareTimerControlBlock);
+
+	/**
+	 * \return number of executions of software timers' functions by the daemon
+	 */
+
+	uint64_t getExecutionCount() const;
+
+	/**
+	 * \return max queueing delay - duration between expiration of software timer and execution of its function by the
+	 * daemon
+	 */
+
+	HighResolutionClock::duration getMaxQueueingDelay() const;
+
+	/**
+	 * \return sum of queueing delays of all executions of software timers' functions by the daemon, divided by
+	 * getExecutionCount() it gives mean queueing delay
+	 */
+
+	HighResolutionClock::duration getTotalQueueingDelay() const;
+
+	/**
+	 * \param [in] softwareTimerControlBlock is a reference to SoftwareTimerControlBlock of software timer
+	 *
+	 * \return true if function of software timer is currently executed by the daemon, false otherwise
+	 */
+
+	bool isExecuting(const SoftwareTimerControlBlock& softwareTimerControlBlock) const
+	{
+		return executedSoftwareTimerControlBlock_ == &softwareTimerControlBlock;
+	}
+
+	/**
+	 * \brief Main loop of daemon thread.
+	 *
+	 * Waits until at least one software timer expires and executes functions of all software timers from the list of
+	 * timers waiting for execution. Interrupts are masked only when the list is accessed, functions are executed with
+	 * interrupts unmasked. Executed timer is marked and the execution mutex is locked for the whole execution of its
+	 * function, so that waitForExecution() can wait for it to finish.
+	 *
+	 * \note this should only be called by daemon thread
+	 */
+
+	void run();
+
+	/**
+	 * \brief Waits until the daemon finishes execution of software timer's function.
+	 *
+	 * Returns immediately if function of software timer is not executed by the daemon at the moment, if this is called
+	 * from interrupt context or if this is called by the daemon thread (from function of software timer).
+	 *
+	 * \note this should only be called by SoftwareTimerControlBlock::stop()
+	 *
+	 * \param [in] softwareTimerControlBlock is a reference to SoftwareTimerControlBlock of software timer
+	 */
+
+	void waitForExecution(const SoftwareTimerControlBlock& softwareTimerControlBlock);
+
+	SoftwareTimerDaemon(const SoftwareTimerDaemon&) = delete;
+	SoftwareTimerDaemon(SoftwareTimerDaemon&&) = delete;
+	const SoftwareTimerDaemon& operator=(const SoftwareTimerDaemon&) = delete;
+	SoftwareTimerDaemon& operator=(SoftwareTimerDaemon&&) = delete;
+
+private:
+
+	/// list of expired software timers waiting for execution
+	SoftwareTimerList::UnsortedIntrusiveList readyList_;
+
+	/// mutex locked by the daemon for the duration of execution of software timer's function
+	Mutex executionMutex_;
+
+	/// semaphore used to wake the daemon thread
+	Semaphore semaphore_;
+
+	/// pointer to SoftwareTimerControlBlock of software timer which function is currently executed, nullptr if none
+	const SoftwareTimerControlBlock* volatile executedSoftwareTimerControlBlock_;
+
+	/// pointer to ThreadControlBlock of daemon thread, nullptr if the daemon was not started yet
+	const ThreadControlBlock* threadControlBlock_;
+
+	/// number of executions of software timers' functions by the daemon
+	uint64_t executionCount_;
+
+	/// max queueing delay - duration between expiration of software timer and execution of its function
+	HighResolutionClock::duration maxQueueingDelay_;
+
+	/// sum of queueing delays of all executions of software timers' functions
+	HighResolutionClock::duration totalQueueingDelay_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERDAEMON_HPP_
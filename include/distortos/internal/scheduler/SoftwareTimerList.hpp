@@ -24,7 +24,7 @@ namespace internal
 
 class SoftwareTimerControlBlock;
 
-/// functor which gives ascending expiration time point order of elements on the list
+/// functor which gives ascending latest expiration time point order of elements on the list
 struct SoftwareTimerAscendingTimePoint
 {
 	/**
@@ -42,12 +42,12 @@ struct SoftwareTimerAscendingTimePoint
 	 * \param [in] left is the object on the left side of comparison
 	 * \param [in] right is the object on the right side of comparison
 	 *
-	 * \return true if left's expiration time point is greater than right's expiration time point
+	 * \return true if left's latest expiration time point is greater than right's latest expiration time point
 	 */
 
 	bool operator()(const SoftwareTimerListNode& left, const SoftwareTimerListNode& right) const
 	{
-		return left.getTimePoint() > right.getTimePoint();
+		return left.getLatestTimePoint() > right.getLatestTimePoint();
 	}
 };
 
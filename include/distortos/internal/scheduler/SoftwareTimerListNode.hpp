@@ -39,11 +39,21 @@ public:
 
 	constexpr SoftwareTimerListNode() :
 			node{},
+			latestTimePoint_{},
 			timePoint_{}
 	{
 
 	}
 
+	/**
+	 * \return const reference to latest expiration time point - expiration time point extended by slack
+	 */
+
+	const TickClock::time_point& getLatestTimePoint() const
+	{
+		return latestTimePoint_;
+	}
+
 	/**
 	 * \return const reference to expiration time point
 	 */
@@ -62,15 +72,22 @@ protected:
 	 * \brief Sets time point of expiration
 	 *
 	 * \param [in] timePoint is the new time point of expiration
+	 * \param [in] slack is the duration by which expiration may be delayed to coalesce it with expiration of other
+	 * software timers, must not be negative, default - 0
 	 */
 
-	void setTimePoint(const TickClock::time_point timePoint)
+	void setTimePoint(const TickClock::time_point timePoint, const TickClock::duration slack = {})
 	{
+		latestTimePoint_ = timePoint <= TickClock::time_point::max() - slack ? timePoint + slack :
+				TickClock::time_point::max();
 		timePoint_ = timePoint;
 	}
 
 private:
 
+	/// latest time point of expiration - time point of expiration extended by slack
+	TickClock::time_point latestTimePoint_;
+
 	/// time point of expiration
 	TickClock::time_point timePoint_;
 };
@@ -30,7 +30,9 @@ public:
 	 */
 
 	constexpr SoftwareTimerSupervisor() :
-			activeList_{}
+			activeList_{},
+			executionCount_{},
+			expiryTickCount_{}
 	{
 
 	}
@@ -43,9 +45,26 @@ public:
 
 	void add(SoftwareTimerControlBlock& softwareTimerControlBlock);
 
+	/**
+	 * \return number of executions of software timers' functions
+	 */
+
+	uint64_t getExecutionCount() const;
+
+	/**
+	 * \return number of ticks in which at least one software timer expired
+	 */
+
+	uint64_t getExpiryTickCount() const;
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
+	 * Nothing is done until latest expiration time point of at least one software timer is reached. When this
+	 * happens, all software timers from the front of the list which reached their expiration time points are executed
+	 * - thanks to that software timers with overlapping slack windows expire in the same tick. Software timers with
+	 * deferred execution are passed to SoftwareTimerDaemon instead of being executed.
+	 *
 	 * \note this must not be called by user code
 	 *
 	 * \param [in] timePoint is the current time point
@@ -57,6 +76,12 @@ private:
 
 	/// list of active software timers (waiting for execution)
 	SoftwareTimerList activeList_;
+
+	/// number of executions of software timers' functions
+	uint64_t executionCount_;
+
+	/// number of ticks in which at least one software timer expired
+	uint64_t expiryTickCount_;
 };
 
 }	// namespace internal
@@ -94,6 +94,9 @@ public:
 
 	/**
 	 * \return stack's "high water mark" (max usage), excluding "stack guard", bytes
+	 *
+	 * \note If lazy stack painting is enabled (DISTORTOS_STACK_MONITOR_ENABLE == 1), the value is not calculated here,
+	 * but is tracked incrementally by updateHighWaterMark() and by setStackPointer().
 	 */
 
 	size_t getHighWaterMark() const;
@@ -121,6 +124,9 @@ public:
 	/**
 	 * \brief Fills the stack with stack sentinel, initializes its contents and stack pointer value.
 	 *
+	 * If lazy stack painting is enabled (DISTORTOS_STACK_MONITOR_ENABLE == 1), only "stack guard" is filled here, the
+	 * rest of the stack is filled later by updateHighWaterMark().
+	 *
 	 * \param [in] runnableThread is a reference to RunnableThread object that is being run
 	 *
 	 * \return 0 on success, error code otherwise:
@@ -138,8 +144,35 @@ public:
 	void setStackPointer(void* const stackPointer)
 	{
 		stackPointer_ = stackPointer;
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+		if (stackPointer < highWaterPointer_)
+			highWaterPointer_ = stackPointer;
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
 	}
 
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	/**
+	 * \brief Performs one step of lazy painting of the stack or of incremental scan of its "high water mark".
+	 *
+	 * Until whole stack is filled with sentinel, each call fills one chunk of the stack below the lowest address which
+	 * is known to be used, moving down towards "stack guard". Afterwards each call scans one chunk of the stack, moving
+	 * up from "stack guard", and lowers "high water mark" pointer when the chunk is found to be used.
+	 *
+	 * If the thread used the part of its stack which was not filled yet, the "high water mark" is based only on values
+	 * of stack pointer saved during context switches, so it may be underestimated.
+	 *
+	 * \warning This function must be called with interrupts masked and only for stack of thread which is not currently
+	 * running.
+	 */
+
+	void updateHighWaterMark();
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
 	Stack(const Stack&) = delete;
 	Stack(Stack&&) = default;
 	const Stack& operator=(const Stack&) = delete;
@@ -158,6 +191,19 @@ private:
 
 	/// current value of stack pointer register
 	void* stackPointer_;
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	/// lowest address of stack which is known to be used
+	void* highWaterPointer_;
+
+	/// address of stack below which lazy painting was not done yet
+	void* paintFrontier_;
+
+	/// current position of incremental scan of "high water mark"
+	void* scanPosition_;
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
 };
 
 }	// namespace internal
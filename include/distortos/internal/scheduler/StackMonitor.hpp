@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief StackMonitor class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_STACKMONITOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_STACKMONITOR_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+#include "distortos/internal/scheduler/ThreadListNode.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+/**
+ * \brief StackMonitor class is a background monitor of stacks of threads.
+ *
+ * Each thread added to the scheduler is also added to the monitor. Each call to step() - done in the idle thread -
+ * performs one step of lazy painting or of incremental scan of the stack of one thread, so the time of single call is
+ * bounded and short. When "high water mark" of the stack crosses configured threshold, stackUsageWarningHook() is
+ * called (once per thread), after interrupts are unmasked.
+ */
+
+class StackMonitor
+{
+public:
+
+	/**
+	 * \brief StackMonitor's constructor
+	 */
+
+	constexpr StackMonitor() :
+			list_{}
+	{
+
+	}
+
+	/**
+	 * \brief Adds thread to the monitor.
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of thread which will be added, its stack must
+	 * already be initialized
+	 */
+
+	void add(ThreadControlBlock& threadControlBlock);
+
+	/**
+	 * \brief Performs one step of monitoring.
+	 *
+	 * Stack of the first thread from the list is processed with Stack::updateHighWaterMark() and this thread is moved
+	 * to the end of the list. Current thread is not processed and terminated threads are removed from the list.
+	 */
+
+	void step();
+
+	StackMonitor(const StackMonitor&) = delete;
+	StackMonitor(StackMonitor&&) = delete;
+	const StackMonitor& operator=(const StackMonitor&) = delete;
+	StackMonitor& operator=(StackMonitor&&) = delete;
+
+private:
+
+	/// type of list of monitored threads
+	using List = estd::IntrusiveList<ThreadListNode, &ThreadListNode::stackMonitorNode, ThreadControlBlock>;
+
+	/// list of monitored threads
+	List list_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_STACKMONITOR_HPP_
@@ -18,9 +18,11 @@
 #include "distortos/internal/scheduler/UnblockFunctor.hpp"
 
 #include "distortos/internal/synchronization/MutexList.hpp"
+#include "distortos/internal/synchronization/ReadWriteMutexOwnership.hpp"
 
 #include "distortos/SchedulingPolicy.hpp"
 #include "distortos/ThreadState.hpp"
+#include "distortos/TickClock.hpp"
 
 namespace distortos
 {
@@ -33,6 +35,7 @@ namespace internal
 class RunnableThread;
 class SignalsReceiverControlBlock;
 class ThreadList;
+class ThreadPriorityQueue;
 class ThreadGroupControlBlock;
 
 /// ThreadControlBlock class is a simple description of a Thread
@@ -91,8 +94,27 @@ public:
 		unblockFunctor_ = unblockFunctor;
 	}
 
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+	/**
+	 * \brief Enables private newlib's _reent structure for this thread.
+	 *
+	 * Allocates and initializes _reent structure, which replaces the shared one used by this thread so far, and sets
+	 * global _impure_ptr (from newlib) to it.
+	 *
+	 * \attention This function should be called only for current thread.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - ENOMEM - amount of free memory is insufficient to allocate _reent structure;
+	 */
+
+	int enablePrivateReent();
+
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
 	/**
-	 * \return pointer to list that has this object
+	 * \return pointer to list that has this object, nullptr if this object is in ThreadPriorityQueue (or in no list at
+	 * all)
 	 */
 
 	ThreadList* getList() const
@@ -109,6 +131,15 @@ public:
 		return ownedProtocolMutexList_;
 	}
 
+	/**
+	 * \return reference to list of ownerships of read-write mutexes (exclusive or shared) held by this thread
+	 */
+
+	ReadWriteMutexOwnershipList& getOwnedReadWriteMutexList()
+	{
+		return ownedReadWriteMutexList_;
+	}
+
 	/**
 	 * \return reference to RunnableThread object that owns this ThreadControlBlock
 	 */
@@ -186,6 +217,30 @@ public:
 		return state_;
 	}
 
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+	/**
+	 * \param [in] slot is the index of slot of thread-local storage, [0; DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS)
+	 *
+	 * \return reference to pointer held in selected slot of thread-local storage of this thread
+	 */
+
+	void*& getThreadLocalSlot(const size_t slot)
+	{
+		return threadLocalStorage_[slot];
+	}
+
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+	/**
+	 * \return default slack of software timers used for timeouts of blocking operations of this thread
+	 */
+
+	TickClock::duration getTimerSlack() const
+	{
+		return timerSlack_;
+	}
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -195,8 +250,32 @@ public:
 	void setList(ThreadList* const list)
 	{
 		list_ = list;
+
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+		priorityQueue_ = {};
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
 	}
 
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+	/**
+	 * \brief Sets the priority queue that has this object.
+	 *
+	 * List returned by getList() is reset to nullptr.
+	 *
+	 * \param [in] priorityQueue is a pointer to priority queue that has this object
+	 */
+
+	void setList(ThreadPriorityQueue* const priorityQueue)
+	{
+		list_ = {};
+		priorityQueue_ = priorityQueue;
+	}
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -220,6 +299,17 @@ public:
 		priorityInheritanceMutexControlBlock_ = priorityInheritanceMutexControlBlock;
 	}
 
+	/**
+	 * \param [in] priorityInheritanceReadWriteMutexControlBlock is a pointer to ReadWriteMutexControlBlock that blocks
+	 * this thread
+	 */
+
+	void setPriorityInheritanceReadWriteMutexControlBlock(
+			const ReadWriteMutexControlBlock* const priorityInheritanceReadWriteMutexControlBlock)
+	{
+		priorityInheritanceReadWriteMutexControlBlock_ = priorityInheritanceReadWriteMutexControlBlock;
+	}
+
 	/**
 	 * \param [in] schedulingPolicy is the new scheduling policy of the thread
 	 */
@@ -235,6 +325,16 @@ public:
 		state_ = state;
 	}
 
+	/**
+	 * \param [in] timerSlack is the new default slack of software timers used for timeouts of blocking operations of
+	 * this thread, negative values are treated as 0
+	 */
+
+	void setTimerSlack(const TickClock::duration timerSlack)
+	{
+		timerSlack_ = timerSlack > decltype(timerSlack){} ? timerSlack : decltype(timerSlack){};
+	}
+
 	/**
 	 * \brief Hook function called when context is switched to this thread.
 	 *
@@ -245,7 +345,17 @@ public:
 
 	void switchedToHook()
 	{
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+		// when switching between threads using shared _reent structure, the store is not needed
+		if (_impure_ptr != reent_)
+			_impure_ptr = reent_;
+
+#else	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 		_impure_ptr = &reent_;
+
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
 	}
 
 	/**
@@ -264,10 +374,10 @@ public:
 	 * \brief Updates boosted priority of the thread.
 	 *
 	 * This function should be called after all operations involving this thread and a mutex with enabled priority
-	 * protocol.
+	 * protocol or a read-write mutex.
 	 *
 	 * \param [in] boostedPriority is the initial boosted priority, this should be effective priority of the thread that
-	 * is about to be blocked on a mutex owned by this thread, default - 0
+	 * is about to be blocked on a mutex or read-write mutex owned by this thread, default - 0
 	 */
 
 	void updateBoostedPriority(uint8_t boostedPriority = {});
@@ -280,11 +390,11 @@ public:
 private:
 
 	/**
-	 * \brief Repositions the thread on the list it's currently on.
+	 * \brief Repositions the thread on the list (or in the priority queue) it's currently on.
 	 *
 	 * This function should be called when thread's effective priority changes.
 	 *
-	 * \attention list_ must not be nullptr
+	 * \attention list_ or priorityQueue_ must not be nullptr
 	 *
 	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
 	 * priority is raised!):
@@ -298,21 +408,53 @@ private:
 	/// list of mutexes (mutex control blocks) with enabled priority protocol owned by this thread
 	MutexList ownedProtocolMutexList_;
 
+	/// list of ownerships of read-write mutexes (exclusive or shared) held by this thread
+	ReadWriteMutexOwnershipList ownedReadWriteMutexList_;
+
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+	/// pointer to newlib's _reent structure used by this thread, either the shared _global_impure_ptr or private one
+	_reent* reent_;
+
+#else	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 	/// newlib's _reent structure with thread-specific data
 	_reent reent_;
 
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 	/// internal stack object
 	Stack stack_;
 
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+	/// slots of thread-local storage
+	void* threadLocalStorage_[DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS];
+
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+	/// default slack of software timers used for timeouts of blocking operations of this thread
+	TickClock::duration timerSlack_;
+
 	/// pointer to list that has this object
 	ThreadList* list_;
 
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+	/// pointer to priority queue that has this object, nullptr if this object is not in any priority queue
+	ThreadPriorityQueue* priorityQueue_;
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
 	/// reference to RunnableThread object that owns this ThreadControlBlock
 	RunnableThread& owner_;
 
 	/// pointer to MutexControlBlock (with priorityInheritance protocol) that blocks this thread
 	const MutexControlBlock* priorityInheritanceMutexControlBlock_;
 
+	/// pointer to ReadWriteMutexControlBlock that blocks this thread
+	const ReadWriteMutexControlBlock* priorityInheritanceReadWriteMutexControlBlock_;
+
 	/// sequence number, one half of thread identifier
 	uintptr_t sequenceNumber_;
 
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "estd/IntrusiveList.hpp"
 
 #include <cstdint>
@@ -42,6 +44,10 @@ public:
 	constexpr explicit ThreadListNode(const uint8_t priority) :
 			threadListNode{},
 			threadGroupNode{},
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+			stackMonitorNode{},
+			stackUsageWarningReported{},
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
 			priority_{priority},
 			boostedPriority_{}
 	{
@@ -72,6 +78,16 @@ public:
 	/// node for intrusive list in thread group
 	estd::IntrusiveListNode threadGroupNode;
 
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	/// node for intrusive list in stack monitor
+	estd::IntrusiveListNode stackMonitorNode;
+
+	/// true if stack monitor already reported that usage of thread's stack crossed the threshold, false otherwise
+	bool stackUsageWarningReported;
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
 protected:
 
 	/// thread's priority, 0 - lowest, UINT8_MAX - highest
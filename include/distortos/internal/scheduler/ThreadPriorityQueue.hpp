@@ -0,0 +1,205 @@
+/**
+ * \file
+ * \brief ThreadPriorityQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADPRIORITYQUEUE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADPRIORITYQUEUE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include <type_traits>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief ThreadPriorityQueue class is a queue of threads (thread control blocks) with per-priority buckets.
+ *
+ * This class is a drop-in replacement for ThreadList in lists of threads blocked on synchronization objects. Threads
+ * are kept in an array of FIFO buckets - each bucket covers a range of effective priorities - and a bitmap of buckets
+ * which may be non-empty. Linking a thread in the queue, moving it after a change of its priority and finding the
+ * thread with highest priority take constant time, independently from the number of threads in the queue. When number
+ * of buckets is lower than number of priorities, threads with different priorities in the same bucket are kept sorted,
+ * so only threads from this single bucket are scanned.
+ *
+ * The elements are linked via the same node as in ThreadList, so threads can be unlinked from the queue (for example
+ * when they are transferred to the list of runnable threads by the scheduler) without any access to the queue. That is
+ * why the bitmap is cleared lazily - a bit of a bucket which became empty is cleared during next search for the first
+ * element.
+ *
+ * Buckets are constructed lazily, when the first element is linked in a bucket with cleared bit in the bitmap. Thanks
+ * to that a queue filled with zeroes is a valid empty queue, which is required for objects statically initialized with
+ * C-API initializers.
+ *
+ * \note Only the subset of ThreadList interface which is needed for lists of blocked threads is provided - there is no
+ * way to iterate over all elements of the queue.
+ */
+
+class ThreadPriorityQueue
+{
+public:
+
+	/// unsorted intrusive list used for buckets
+	using Bucket = ThreadList::UnsortedIntrusiveList;
+
+	/// iterator of elements in the queue
+	using iterator = ThreadList::iterator;
+
+	/// const reference to value linked in the queue
+	using const_reference = ThreadList::const_reference;
+
+	/// reference to value linked in the queue
+	using reference = ThreadList::reference;
+
+	/// number of buckets
+	constexpr static size_t bucketsCount {DISTORTOS_WAIT_QUEUE_PRIORITY_BUCKETS};
+
+	static_assert(bucketsCount >= 1 && bucketsCount <= UINT8_MAX + 1, "Invalid number of buckets!");
+
+	/**
+	 * \brief ThreadPriorityQueue's constructor
+	 */
+
+	constexpr ThreadPriorityQueue() :
+			bucketsStorage_{},
+			bitmap_{}
+	{
+
+	}
+
+	/**
+	 * \attention queue must not be empty
+	 *
+	 * \return iterator of first element in the queue - thread with highest effective priority which was linked as the
+	 * first one
+	 */
+
+	iterator begin();
+
+	/**
+	 * \return true if the queue is empty, false otherwise
+	 */
+
+	bool empty() const
+	{
+		return findFirstBucket() == nullptr;
+	}
+
+	/**
+	 * \attention queue must not be empty
+	 *
+	 * \return reference to first element in the queue
+	 */
+
+	reference front();
+
+	/**
+	 * \attention queue must not be empty
+	 *
+	 * \return const reference to first element in the queue
+	 */
+
+	const_reference front() const;
+
+	/**
+	 * \brief Links the element in the queue, at the end of the group of threads with the same effective priority.
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the queue
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator insert(reference newElement)
+	{
+		return insertInternal(newElement, {});
+	}
+
+	/**
+	 * \brief Transfers the element from any list or queue (including this one) to this queue.
+	 *
+	 * \param [in] splicedElement is an iterator of the element that will be spliced to this queue
+	 * \param [in] atFront selects the position of the element in the group of threads with the same effective
+	 * priority - head (true) or tail (false), default - tail
+	 */
+
+	void splice(iterator splicedElement, bool atFront = {});
+
+	ThreadPriorityQueue(const ThreadPriorityQueue&) = delete;
+	ThreadPriorityQueue(ThreadPriorityQueue&&) = delete;
+	const ThreadPriorityQueue& operator=(const ThreadPriorityQueue&) = delete;
+	ThreadPriorityQueue& operator=(ThreadPriorityQueue&&) = delete;
+
+private:
+
+	/// type of word of bitmap
+	using BitmapWord = uint32_t;
+
+	/// number of bits in one word of bitmap
+	constexpr static size_t bitmapWordBits {sizeof(BitmapWord) * 8};
+
+	/// number of words in bitmap
+	constexpr static size_t bitmapWords {(bucketsCount + bitmapWordBits - 1) / bitmapWordBits};
+
+	/// type of uninitialized storage for Bucket
+	using BucketStorage = typename std::aligned_storage<sizeof(Bucket), alignof(Bucket)>::type;
+
+	/**
+	 * \brief Finds non-empty bucket with highest priorities, clearing stale bits in the bitmap.
+	 *
+	 * \return pointer to non-empty bucket with highest priorities, nullptr if the queue is empty
+	 */
+
+	Bucket* findFirstBucket() const;
+
+	/**
+	 * \param [in] index is the index of bucket, [0; bucketsCount)
+	 *
+	 * \return reference to bucket with index \a index, valid only if its bit in the bitmap is set
+	 */
+
+	Bucket& getBucket(const size_t index) const
+	{
+		return *reinterpret_cast<Bucket*>(&bucketsStorage_[index]);
+	}
+
+	/**
+	 * \brief Links the element in the bucket appropriate for its effective priority.
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the queue, it must not be linked in
+	 * any other list or queue
+	 * \param [in] atFront selects the position of the element in the group of threads with the same effective
+	 * priority - head (true) or tail (false)
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator insertInternal(reference newElement, bool atFront);
+
+	/// storage for buckets, bucket with index 0 holds threads with lowest priorities
+	mutable BucketStorage bucketsStorage_[bucketsCount];
+
+	/// bitmap of buckets which may be non-empty, bit set in word 0 at position 0 corresponds to bucket with index 0
+	mutable BitmapWord bitmap_[bitmapWords];
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADPRIORITYQUEUE_HPP_
@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \brief ThreadWaitQueue type alias header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADWAITQUEUE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADWAITQUEUE_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/internal/scheduler/ThreadPriorityQueue.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+/// container of threads blocked on synchronization objects - queue with per-priority buckets
+using ThreadWaitQueue = ThreadPriorityQueue;
+
+#else	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE != 1
+
+/// container of threads blocked on synchronization objects - compact sorted list
+using ThreadWaitQueue = ThreadList;
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE != 1
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADWAITQUEUE_HPP_
@@ -0,0 +1,121 @@
+/**
+ * \file
+ * \brief TraceRecorder class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACERECORDER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACERECORDER_HPP_
+
+#include "distortos/TraceRecord.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief TraceRecorder class is a ring buffer of trace records.
+ *
+ * Storage is provided by the user of the class, so recording takes constant time and never allocates memory. When the
+ * ring buffer is full, the oldest record is overwritten - number of such records is reported with a record of
+ * TraceRecord::Type::lostRecords type on next read.
+ *
+ * This class is not thread-safe - it must be protected by masking of interrupts.
+ */
+
+class TraceRecorder
+{
+public:
+
+	/// type of range of TraceRecord elements
+	using RecordsRange = estd::ContiguousRange<TraceRecord>;
+
+	/**
+	 * \brief TraceRecorder's constructor
+	 *
+	 * \param [in] records is a range with storage for ring buffer of records
+	 */
+
+	constexpr explicit TraceRecorder(const RecordsRange records) :
+			records_{records},
+			lostRecords_{},
+			readPosition_{},
+			storedRecords_{}
+	{
+
+	}
+
+	/**
+	 * \brief Clears ring buffer of records.
+	 */
+
+	void clear()
+	{
+		lostRecords_ = {};
+		readPosition_ = {};
+		storedRecords_ = {};
+	}
+
+	/**
+	 * \return number of records which are currently stored in the ring buffer
+	 */
+
+	size_t getSize() const
+	{
+		return storedRecords_;
+	}
+
+	/**
+	 * \brief Moves the oldest records from the ring buffer.
+	 *
+	 * If any records were overwritten since previous read, first copied record has TraceRecord::Type::lostRecords type.
+	 *
+	 * \param [out] records is a range in which the oldest records will be copied, from the oldest to the newest
+	 *
+	 * \return number of records copied to \a records
+	 */
+
+	size_t read(RecordsRange records);
+
+	/**
+	 * \brief Adds record to ring buffer, overwriting the oldest record if the ring buffer is full.
+	 *
+	 * \param [in] record is the record which will be added
+	 */
+
+	void record(const TraceRecord& record);
+
+	TraceRecorder(const TraceRecorder&) = delete;
+	TraceRecorder(TraceRecorder&&) = delete;
+	const TraceRecorder& operator=(const TraceRecorder&) = delete;
+	TraceRecorder& operator=(TraceRecorder&&) = delete;
+
+private:
+
+	/// ring buffer of records
+	RecordsRange records_;
+
+	/// number of records overwritten since previous read
+	size_t lostRecords_;
+
+	/// index of the oldest record in \a records_
+	size_t readPosition_;
+
+	/// number of records stored in \a records_
+	size_t storedRecords_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACERECORDER_HPP_
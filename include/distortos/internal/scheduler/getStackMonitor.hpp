@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief getStackMonitor() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_GETSTACKMONITOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_GETSTACKMONITOR_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class StackMonitor;
+
+/**
+ * \return reference to main instance of StackMonitor
+ */
+
+constexpr StackMonitor& getStackMonitor()
+{
+	extern StackMonitor stackMonitorInstance;
+	return stackMonitorInstance;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_GETSTACKMONITOR_HPP_
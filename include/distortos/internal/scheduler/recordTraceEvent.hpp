@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief recordTraceEvent() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDTRACEEVENT_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDTRACEEVENT_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include "distortos/TraceRecord.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+#if DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+/**
+ * \brief Records event in main instance of TraceRecorder.
+ *
+ * Timestamp, current thread and interrupt context flag are filled automatically.
+ *
+ * \note This function can be used from any context.
+ *
+ * \param [in] type is the type of record
+ * \param [in] object is a pointer to object related to the event, meaning depends on \a type
+ * \param [in] argument is the argument of the event, meaning depends on \a type, default - 0
+ */
+
+void recordTraceEvent(TraceRecord::Type type, const void* object, uint32_t argument = {});
+
+#else	// DISTORTOS_TRACE_RECORDER_ENABLE != 1
+
+/**
+ * \brief Empty replacement of recordTraceEvent() used when trace recorder is disabled.
+ */
+
+inline void recordTraceEvent(TraceRecord::Type, const void*, uint32_t = {})
+{
+
+}
+
+#endif	// DISTORTOS_TRACE_RECORDER_ENABLE != 1
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDTRACEEVENT_HPP_
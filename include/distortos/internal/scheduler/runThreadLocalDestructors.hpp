@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief runThreadLocalDestructors() header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNTHREADLOCALDESTRUCTORS_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNTHREADLOCALDESTRUCTORS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+/**
+ * \brief Executes destructors of thread-local storage of exiting thread.
+ *
+ * For each slot which holds non-null pointer and has a destructor set, the slot is set to nullptr and the destructor
+ * is executed. This is repeated (up to 4 times) as long as any destructor was executed.
+ *
+ * \attention This function should be called only by threadExiter(), in the context of exiting thread.
+ *
+ * \param [in] threadControlBlock is a reference to ThreadControlBlock of exiting thread
+ */
+
+void runThreadLocalDestructors(ThreadControlBlock& threadControlBlock);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNTHREADLOCALDESTRUCTORS_HPP_
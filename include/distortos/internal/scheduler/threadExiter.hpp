@@ -24,6 +24,7 @@ class RunnableThread;
  * \brief Thread "exiter" function
  *
  * Performs following actions:
+ * - destructors of thread-local storage are executed;
  * - thread's "exit 0" hook is executed;
  * - thread is terminated and removed from scheduler;
  * - thread's "exit 1" hook is executed;
@@ -12,8 +12,11 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_FIFOQUEUEBASE_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_FIFOQUEUEBASE_HPP_
 
+#include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/Semaphore.hpp"
 
+#include "distortos/internal/scheduler/recordTraceEvent.hpp"
+
 #include "distortos/internal/synchronization/QueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
@@ -68,6 +71,12 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return number of elements dropped by pushOverwrite() since the queue was constructed
+	 */
+
+	size_t getOverrunCount() const;
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -85,6 +94,31 @@ public:
 		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_);
 	}
 
+	/**
+	 * \brief Implementation of pop() using functors with types known at compile time
+	 *
+	 * Unlike pop(const SemaphoreFunctor&, const QueueFunctor&), this variant calls the functors directly (without
+	 * virtual dispatch), so they can be inlined.
+	 *
+	 * \tparam WaitSemaphoreFunctor is the type of functor derived from SemaphoreFunctor
+	 * \tparam Functor is the type of functor derived from QueueFunctor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to WaitSemaphoreFunctor which will be executed with
+	 * \a popSemaphore_
+	 * \param [in] functor is a reference to Functor which will execute actions related to popping - it will get
+	 * readPosition_ as argument
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename WaitSemaphoreFunctor, typename Functor>
+	int popInlined(const WaitSemaphoreFunctor& waitSemaphoreFunctor, const Functor& functor)
+	{
+		return popPushInlined(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_);
+	}
+
 	/**
 	 * \brief Implementation of push() using type-erased functor
 	 *
@@ -102,8 +136,64 @@ public:
 		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
 	}
 
+	/**
+	 * \brief Implementation of pushOverwrite() using type-erased functors
+	 *
+	 * If the queue is full, the oldest element is dropped (with \a dropFunctor) and the new one is pushed in its place,
+	 * all in one critical section. This function never blocks.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will get
+	 * writePosition_ as argument
+	 * \param [in] dropFunctor is a reference to QueueFunctor which will execute actions related to dropping of the
+	 * oldest element - it will get readPosition_ as argument
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full and all its elements are already being popped by other threads;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushOverwrite(const QueueFunctor& functor, const QueueFunctor& dropFunctor);
+
+	/**
+	 * \brief Implementation of push() using functors with types known at compile time
+	 *
+	 * Unlike push(const SemaphoreFunctor&, const QueueFunctor&), this variant calls the functors directly (without
+	 * virtual dispatch), so they can be inlined.
+	 *
+	 * \tparam WaitSemaphoreFunctor is the type of functor derived from SemaphoreFunctor
+	 * \tparam Functor is the type of functor derived from QueueFunctor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to WaitSemaphoreFunctor which will be executed with
+	 * \a pushSemaphore_
+	 * \param [in] functor is a reference to Functor which will execute actions related to pushing - it will get
+	 * writePosition_ as argument
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename WaitSemaphoreFunctor, typename Functor>
+	int pushInlined(const WaitSemaphoreFunctor& waitSemaphoreFunctor, const Functor& functor)
+	{
+		return popPushInlined(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
+	}
+
 private:
 
+	/**
+	 * \brief Advances pointer to storage to next element, wrapping around at the end of storage.
+	 *
+	 * \param [in,out] storage is a reference to pointer to storage which will be advanced
+	 */
+
+	void advance(void*& storage) const
+	{
+		storage = static_cast<uint8_t*>(storage) + elementSize_;
+		if (storage >= storageEnd_)
+			storage = storageUniquePointer_.get();
+	}
+
 	/**
 	 * \brief Implementation of pop() and push() using type-erased functor
 	 *
@@ -125,6 +215,46 @@ private:
 	int popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, Semaphore& waitSemaphore,
 			Semaphore& postSemaphore, void*& storage);
 
+	/**
+	 * \brief Implementation of popInlined() and pushInlined()
+	 *
+	 * \tparam WaitSemaphoreFunctor is the type of functor derived from SemaphoreFunctor
+	 * \tparam Functor is the type of functor derived from QueueFunctor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to WaitSemaphoreFunctor which will be executed with
+	 * \a waitSemaphore
+	 * \param [in] functor is a reference to Functor which will execute actions related to popping/pushing - it will
+	 * get \a storage as argument
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for popInlined(),
+	 * \a pushSemaphore_ for pushInlined()
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted after the operation, \a pushSemaphore_
+	 * for popInlined(), \a popSemaphore_ for pushInlined()
+	 * \param [in] storage is a reference to appropriate pointer to storage, which will be passed to \a functor, \a
+	 * readPosition_ for popInlined(), \a writePosition_ for pushInlined()
+	 *
+	 * \return 0 if operation was successful, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename WaitSemaphoreFunctor, typename Functor>
+	int popPushInlined(const WaitSemaphoreFunctor& waitSemaphoreFunctor, const Functor& functor,
+			Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage)
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		// qualified calls are not virtual, so both functors can be inlined
+		const auto ret = waitSemaphoreFunctor.WaitSemaphoreFunctor::operator()(waitSemaphore);
+		if (ret != 0)
+			return ret;
+
+		functor.Functor::operator()(storage);
+		advance(storage);
+		recordTraceEvent(&storage == &writePosition_ ? TraceRecord::Type::queuePush : TraceRecord::Type::queuePop,
+				this);
+		return postSemaphore.post();
+	}
+
 	/// semaphore guarding access to "pop" functions - its value is equal to the number of available elements
 	Semaphore popSemaphore_;
 
@@ -145,6 +275,9 @@ private:
 
 	/// size of single queue element, bytes
 	const size_t elementSize_;
+
+	/// number of elements dropped by pushOverwrite()
+	size_t overrunCount_;
 };
 
 }	// namespace internal
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MESSAGEQUEUEBASE_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MESSAGEQUEUEBASE_HPP_
 
+#include "distortos/distortosConfiguration.h"
 #include "distortos/Semaphore.hpp"
 
 #include "distortos/internal/synchronization/QueueFunctor.hpp"
@@ -105,11 +106,93 @@ public:
 		}
 	};
 
+	/// type of free entry list
+	using FreeEntryList = estd::IntrusiveForwardList<Entry, &Entry::node>;
+
+#if DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE == 1
+
+	/**
+	 * \brief BucketedEntryList class is a list of entries sorted in descending order of priority, with constant time
+	 * insertion.
+	 *
+	 * Entries are kept on a single forward list, like in the sorted list used by default, but the list also has a
+	 * pointer to the last entry of each priority and a bitmap of priorities which have at least one entry. New entry
+	 * is linked after the last entry with the lowest priority that is higher than or equal to the priority of the new
+	 * entry, which is found in the bitmap, so entries with equal priority are kept in FIFO order.
+	 */
+
+	class BucketedEntryList
+	{
+	public:
+
+		/**
+		 * \brief BucketedEntryList's constructor
+		 */
+
+		constexpr BucketedEntryList() :
+				list_{},
+				tails_{},
+				bitmap_{}
+		{
+
+		}
+
+		/**
+		 * \return reference to first entry on the list - oldest entry with highest priority
+		 */
+
+		Entry& front()
+		{
+			return list_.front();
+		}
+
+		/**
+		 * \brief Transfers the first entry from this list to the front of another list.
+		 *
+		 * \param [in] other is a reference to FreeEntryList to which the first entry will be transferred
+		 */
+
+		void spliceFront(FreeEntryList& other);
+
+		/**
+		 * \brief Transfers the entry from another list to this one, after all entries with higher or equal priority.
+		 *
+		 * \param [in] beforeSplicedElement is an iterator of the entry preceding the one which will be spliced from
+		 * another list to this one
+		 */
+
+		void splice_after(FreeEntryList::iterator beforeSplicedElement);
+
+	private:
+
+		/// type of word of bitmap
+		using BitmapWord = uint32_t;
+
+		/// number of bits in one word of bitmap
+		constexpr static size_t bitmapWordBits {sizeof(BitmapWord) * 8};
+
+		/// number of priorities
+		constexpr static size_t priorities {UINT8_MAX + 1};
+
+		/// list of entries, sorted in descending order of priority
+		FreeEntryList list_;
+
+		/// pointers to last entry of each priority, valid only if bit of this priority is set in the bitmap
+		Entry* tails_[priorities];
+
+		/// bitmap of priorities which have at least one entry on the list
+		BitmapWord bitmap_[priorities / bitmapWordBits];
+	};
+
+	/// type of entry list
+	using EntryList = BucketedEntryList;
+
+#else	// DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE != 1
+
 	/// type of entry list
 	using EntryList = estd::SortedIntrusiveForwardList<DescendingPriority, Entry, &Entry::node>;
 
-	/// type of free entry list
-	using FreeEntryList = EntryList::UnsortedIntrusiveForwardList;
+#endif	// DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE != 1
 
 	/**
 	 * \brief InternalFunctor is a type-erased interface for functors which execute common code of pop() and push()
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,15 +12,24 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 
-#include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/distortosConfiguration.h"
+
+#include "distortos/internal/scheduler/ThreadWaitQueue.hpp"
 
 #include "distortos/internal/synchronization/MutexListNode.hpp"
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#include "distortos/internal/synchronization/MutexProfile.hpp"
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 #include "distortos/MutexProtocol.hpp"
 #include "distortos/MutexType.hpp"
 #include "distortos/TickClock.hpp"
 
 #include <climits>
+#include <cstdint>
 
 namespace distortos
 {
@@ -62,9 +71,23 @@ public:
 
 	ThreadControlBlock* getOwner() const
 	{
-		return owner_;
+		return reinterpret_cast<ThreadControlBlock*>(owner_ & ~slowUnlockFlag);
 	}
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	/**
+	 * \return snapshot of contention and hold times of the mutex
+	 */
+
+	MutexStatistics getStatistics() const;
+
+	/// node for intrusive list of profiled mutexes, the mutex is added to that list when it is locked for the first
+	/// time
+	estd::IntrusiveListNode profiledMutexNode;
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 	/// shift of "type" subfield, bits
 	constexpr static uint8_t typeShift {0};
 
@@ -99,6 +122,29 @@ protected:
 
 	}
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	/**
+	 * \brief MutexControlBlock's move constructor
+	 *
+	 * Explicitly defaulted, as user-provided destructor suppresses implicit declaration of move constructor.
+	 *
+	 * \param [in] other is a rvalue reference to MutexControlBlock used as source of move construction
+	 */
+
+	MutexControlBlock(MutexControlBlock&& other) = default;
+
+	/**
+	 * \brief MutexControlBlock's destructor
+	 *
+	 * Removes the mutex from the list of profiled mutexes with interrupts masked, so the list may be safely traversed
+	 * in any context.
+	 */
+
+	~MutexControlBlock();
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 	/**
 	 * \brief Blocks current thread, transferring it to blockedList_.
 	 *
@@ -137,6 +183,32 @@ protected:
 
 	void doUnlockOrTransferLock();
 
+	/**
+	 * \brief Tries to lock the mutex without masking interrupts.
+	 *
+	 * Fast path is possible only for mutexes with none or priorityInheritance protocol - the mutex is locked with
+	 * atomic compare-and-swap of owner if it is currently unlocked. For priorityInheritance protocol the mutex is added
+	 * to the list of mutexes owned by the thread only when some other thread blocks on it. When mutex profiling or
+	 * trace recorder is enabled, interrupts are masked, so that the lock is recorded atomically with the change of
+	 * owner.
+	 *
+	 * \return true if the mutex was locked, false if slow path must be used
+	 */
+
+	bool tryFastLock();
+
+	/**
+	 * \brief Tries to unlock the mutex without masking interrupts.
+	 *
+	 * Fast path is possible only when the mutex was locked with tryFastLock() by current thread, no thread blocked on
+	 * it since then and - for recursive mutex - there are no pending recursive locks. When mutex profiling or trace
+	 * recorder is enabled, interrupts are masked, so that the unlock is recorded atomically with the change of owner.
+	 *
+	 * \return true if the mutex was unlocked, false if slow path must be used
+	 */
+
+	bool tryFastUnlock();
+
 	/**
 	 * \return priority ceiling of mutex, valid only when protocol_ == Protocol::priorityProtect
 	 */
@@ -178,13 +250,14 @@ private:
 	/**
 	 * \brief Performs any actions required before actually blocking on the mutex.
 	 *
-	 * In case of priorityInheritance protocol, priority of owner thread is boosted and this mutex is set as the
-	 * blocking mutex of the calling thread. In all other cases this function does nothing.
+	 * Owner of the mutex is forced to use slow path when unlocking. In case of priorityInheritance protocol, the mutex
+	 * is added to the list of mutexes owned by the owner thread (if it was not added already), priority of owner thread
+	 * is boosted and this mutex is set as the blocking mutex of the calling thread.
 	 *
 	 * \attention must be called in block() and blockUntil() before actually blocking of the calling thread.
 	 */
 
-	void beforeBlock() const;
+	void beforeBlock();
 
 	/**
 	 * \brief Performs transfer of lock from current owner to next thread on the list.
@@ -202,11 +275,38 @@ private:
 
 	void doUnlock();
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	/**
+	 * \brief Records acquisition of the mutex by current thread.
+	 *
+	 * If the mutex is locked for the first time, it is added to the list of profiled mutexes.
+	 *
+	 * \param [in] contended selects whether the acquisition required blocking of the thread (true) or not (false)
+	 */
+
+	void profileLock(bool contended);
+
+	/**
+	 * \brief Records release of the mutex by current thread.
+	 */
+
+	void profileUnlock();
+
+	/// counters and durations of acquisitions, waits and holds of the mutex
+	MutexProfile profile_;
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 	/// ThreadControlBlock objects blocked on mutex
-	ThreadList blockedList_;
+	ThreadWaitQueue blockedList_;
+
+	/// flag in owner_ which forces slow path in tryFastUnlock()
+	constexpr static uintptr_t slowUnlockFlag {1};
 
-	/// owner of the mutex
-	ThreadControlBlock* owner_;
+	/// address of owner of the mutex (0 if mutex is unlocked), bitwise-or-ed with slowUnlockFlag if the mutex must be
+	/// unlocked via slow path
+	uintptr_t owner_;
 
 	/// number of recursive locks, used when mutex type is recursive
 	RecursiveLocksCount recursiveLocksCount_;
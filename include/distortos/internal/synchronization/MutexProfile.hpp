@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \brief MutexProfile class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXPROFILE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXPROFILE_HPP_
+
+#include "distortos/MutexStatistics.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief MutexProfile class accumulates counters and durations of acquisitions, waits and holds of single mutex.
+ *
+ * This class is not thread-safe - it must be protected by masking of interrupts.
+ */
+
+class MutexProfile
+{
+public:
+
+	/**
+	 * \brief MutexProfile's constructor
+	 */
+
+	constexpr MutexProfile() :
+			lockTimePoint_{},
+			statistics_{}
+	{
+
+	}
+
+	/**
+	 * \return accumulated statistics, MutexStatistics::mutex is always nullptr
+	 */
+
+	MutexStatistics getStatistics() const
+	{
+		return statistics_;
+	}
+
+	/**
+	 * \brief Records boost of priority of owner of the mutex by blocked thread.
+	 */
+
+	void recordBoost()
+	{
+		++statistics_.priorityInheritanceBoosts;
+	}
+
+	/**
+	 * \brief Records acquisition of the mutex.
+	 *
+	 * \param [in] timePoint is the time point of acquisition, hold time is measured from this moment
+	 * \param [in] contended selects whether the acquisition required blocking of the thread (true) or not (false)
+	 */
+
+	void recordLock(HighResolutionClock::time_point timePoint, bool contended);
+
+	/**
+	 * \brief Records release of the mutex.
+	 *
+	 * \param [in] timePoint is the time point of release
+	 */
+
+	void recordUnlock(HighResolutionClock::time_point timePoint);
+
+	/**
+	 * \brief Records single wait for the mutex.
+	 *
+	 * \param [in] waitTime is the duration of wait
+	 */
+
+	void recordWait(HighResolutionClock::duration waitTime);
+
+private:
+
+	/// time point of last acquisition of the mutex
+	HighResolutionClock::time_point lockTimePoint_;
+
+	/// accumulated statistics
+	MutexStatistics statistics_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXPROFILE_HPP_
@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \brief ProfiledMutexList header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_PROFILEDMUTEXLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_PROFILEDMUTEXLIST_HPP_
+
+#include "distortos/internal/synchronization/MutexControlBlock.hpp"
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/// intrusive list of profiled mutexes (mutex control blocks)
+using ProfiledMutexList = estd::IntrusiveList<MutexControlBlock, &MutexControlBlock::profiledMutexNode>;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_PROFILEDMUTEXLIST_HPP_
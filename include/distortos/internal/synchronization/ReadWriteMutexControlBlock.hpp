@@ -0,0 +1,213 @@
+/**
+ * \file
+ * \brief ReadWriteMutexControlBlock class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_READWRITEMUTEXCONTROLBLOCK_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_READWRITEMUTEXCONTROLBLOCK_HPP_
+
+#include "distortos/internal/scheduler/ThreadWaitQueue.hpp"
+
+#include "distortos/internal/synchronization/ReadWriteMutexOwnership.hpp"
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief ReadWriteMutexControlBlock class is a control block for ReadWriteMutex
+ *
+ * Threads blocked on the read-write mutex are kept on two priority-ordered lists - one for writers and one for readers.
+ * Writers are preferred - new shared lock is not possible when any writer is blocked. Priority of all owners (single
+ * writer or all readers) is boosted to the effective priority of the highest priority blocked thread.
+ */
+
+class ReadWriteMutexControlBlock
+{
+public:
+
+	/**
+	 * \return "boosted priority" of the read-write mutex - effective priority of the highest priority thread blocked on
+	 * this read-write mutex or 0 if no threads are blocked
+	 */
+
+	uint8_t getBoostedPriority() const;
+
+	/**
+	 * \brief Updates boosted priority of all owners of the read-write mutex.
+	 *
+	 * \param [in] boostedPriority is the initial boosted priority, this should be effective priority of the thread that
+	 * is about to be blocked on this read-write mutex, default - 0
+	 */
+
+	void updateOwnersBoostedPriority(uint8_t boostedPriority = {}) const;
+
+protected:
+
+	/**
+	 * \brief ReadWriteMutexControlBlock's constructor
+	 *
+	 * \param [in] readers is a pointer to array of ReadWriteMutexOwnership objects used for threads which own the
+	 * read-write mutex in shared mode
+	 * \param [in] maxReaders is the number of elements in \a readers array - max number of threads which can own the
+	 * read-write mutex in shared mode at the same time
+	 */
+
+	constexpr ReadWriteMutexControlBlock(ReadWriteMutexOwnership* const readers, const size_t maxReaders) :
+			readersBlockedList_{},
+			writersBlockedList_{},
+			writer_{},
+			readers_{readers},
+			maxReaders_{maxReaders},
+			readersCount_{}
+	{
+
+	}
+
+	/**
+	 * \brief Blocks current thread, transferring it to the list of blocked writers or readers.
+	 *
+	 * \param [in] writer selects whether current thread wants to lock the read-write mutex exclusively (true) or in
+	 * shared mode (false)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - values returned by Scheduler::block();
+	 */
+
+	int doBlock(bool writer);
+
+	/**
+	 * \brief Blocks current thread with timeout, transferring it to the list of blocked writers or readers.
+	 *
+	 * \param [in] writer selects whether current thread wants to lock the read-write mutex exclusively (true) or in
+	 * shared mode (false)
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - values returned by Scheduler::blockUntil();
+	 */
+
+	int doBlockUntil(bool writer, TickClock::time_point timePoint);
+
+	/**
+	 * \brief Unblocks all blocked readers if no writer owns the read-write mutex and no writer is blocked.
+	 *
+	 * This function should be called when a writer gives up waiting for the read-write mutex, as the readers might have
+	 * been blocked only because of this writer.
+	 */
+
+	void doReleaseReaders();
+
+	/**
+	 * \brief Tries to lock the read-write mutex exclusively.
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EBUSY - the read-write mutex could not be acquired because it was already locked;
+	 * - EDEADLK - the current thread already owns the read-write mutex (exclusively or in shared mode);
+	 */
+
+	int doTryLock();
+
+	/**
+	 * \brief Tries to lock the read-write mutex in shared mode.
+	 *
+	 * \return 0 if the caller successfully locked the read-write mutex, error code otherwise:
+	 * - EAGAIN - the read-write mutex could not be acquired because the maximum number of readers or recursive shared
+	 * locks has been exceeded;
+	 * - EBUSY - the read-write mutex could not be acquired because it was locked exclusively or some writer is waiting
+	 * for it;
+	 * - EDEADLK - the current thread already owns the read-write mutex exclusively;
+	 */
+
+	int doTryLockShared();
+
+	/**
+	 * \brief Unlocks the read-write mutex locked exclusively by current thread.
+	 *
+	 * If any writer is blocked, the ownership is transferred to the highest priority one, otherwise all blocked readers
+	 * are unblocked.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EPERM - the current thread does not own the read-write mutex exclusively;
+	 */
+
+	int doUnlock();
+
+	/**
+	 * \brief Unlocks the read-write mutex locked in shared mode by current thread.
+	 *
+	 * If it was the last shared lock of the last reader and any writer is blocked, the ownership is transferred to the
+	 * highest priority one.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EPERM - the current thread does not own the read-write mutex in shared mode;
+	 */
+
+	int doUnlockShared();
+
+private:
+
+	/**
+	 * \brief Performs actions required before actually blocking on the read-write mutex.
+	 *
+	 * This read-write mutex is set as the blocking read-write mutex of the calling thread and priority of all owners is
+	 * boosted.
+	 *
+	 * \attention must be called in doBlock() and doBlockUntil() before actually blocking of the calling thread.
+	 */
+
+	void beforeBlock() const;
+
+	/**
+	 * \brief Performs transfer of exclusive lock to the highest priority blocked writer.
+	 *
+	 * \attention read-write mutex must be unlocked and list of blocked writers must not be empty
+	 */
+
+	void doTransferLock();
+
+	/**
+	 * \brief Finds ownership of the read-write mutex in shared mode for given thread.
+	 *
+	 * \param [in] owner is a pointer to the thread for which the ownership will be found, nullptr to find unused object
+	 *
+	 * \return pointer to found ReadWriteMutexOwnership object, nullptr if no object matches
+	 */
+
+	ReadWriteMutexOwnership* findReader(const ThreadControlBlock* owner) const;
+
+	/// ThreadControlBlock objects blocked on read-write mutex waiting for shared lock
+	ThreadWaitQueue readersBlockedList_;
+
+	/// ThreadControlBlock objects blocked on read-write mutex waiting for exclusive lock
+	ThreadWaitQueue writersBlockedList_;
+
+	/// ownership of the read-write mutex in exclusive mode
+	ReadWriteMutexOwnership writer_;
+
+	/// pointer to array of ReadWriteMutexOwnership objects used for threads which own the read-write mutex in shared
+	/// mode
+	ReadWriteMutexOwnership* readers_;
+
+	/// number of elements in \a readers_ array
+	size_t maxReaders_;
+
+	/// number of threads which currently own the read-write mutex in shared mode
+	size_t readersCount_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_READWRITEMUTEXCONTROLBLOCK_HPP_
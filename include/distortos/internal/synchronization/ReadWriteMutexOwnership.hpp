@@ -0,0 +1,121 @@
+/**
+ * \file
+ * \brief ReadWriteMutexOwnership class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_READWRITEMUTEXOWNERSHIP_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_READWRITEMUTEXOWNERSHIP_HPP_
+
+#include "estd/IntrusiveList.hpp"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ReadWriteMutexControlBlock;
+class ThreadControlBlock;
+
+/**
+ * \brief ReadWriteMutexOwnership class describes ownership of ReadWriteMutexControlBlock by one thread.
+ *
+ * Each thread which owns the read-write mutex - exclusively or shared - has one such object on its list of owned
+ * read-write mutexes, so that priority inheritance can boost all owners of the read-write mutex.
+ *
+ * This class is needed to break circular dependency - ReadWriteMutexOwnershipList is contained in ThreadControlBlock
+ * and ThreadList is contained in ReadWriteMutexControlBlock.
+ */
+
+class ReadWriteMutexOwnership
+{
+public:
+
+	/// type used for counting locks
+	using LocksCount = uint16_t;
+
+	/**
+	 * \brief ReadWriteMutexOwnership's constructor
+	 */
+
+	constexpr ReadWriteMutexOwnership() :
+			node{},
+			readWriteMutexControlBlock_{},
+			owner_{},
+			locksCount_{}
+	{
+
+	}
+
+	/**
+	 * \return reference to number of locks
+	 */
+
+	LocksCount& getLocksCount()
+	{
+		return locksCount_;
+	}
+
+	/**
+	 * \return owner of the read-write mutex, nullptr if this object is not used
+	 */
+
+	ThreadControlBlock* getOwner() const
+	{
+		return owner_;
+	}
+
+	/**
+	 * \return reference to owned ReadWriteMutexControlBlock
+	 */
+
+	const ReadWriteMutexControlBlock& getReadWriteMutexControlBlock() const
+	{
+		return *readWriteMutexControlBlock_;
+	}
+
+	/**
+	 * \brief Sets owner of the read-write mutex.
+	 *
+	 * \param [in] readWriteMutexControlBlock is a reference to owned ReadWriteMutexControlBlock
+	 * \param [in] owner is a pointer to owner of the read-write mutex, nullptr if this object is no longer used
+	 */
+
+	void setOwner(const ReadWriteMutexControlBlock& readWriteMutexControlBlock, ThreadControlBlock* const owner)
+	{
+		readWriteMutexControlBlock_ = &readWriteMutexControlBlock;
+		owner_ = owner;
+		locksCount_ = owner != nullptr ? 1 : 0;
+	}
+
+	/// node for intrusive list
+	estd::IntrusiveListNode node;
+
+private:
+
+	/// pointer to owned ReadWriteMutexControlBlock
+	const ReadWriteMutexControlBlock* readWriteMutexControlBlock_;
+
+	/// owner of the read-write mutex, nullptr if this object is not used
+	ThreadControlBlock* owner_;
+
+	/// number of locks
+	LocksCount locksCount_;
+};
+
+/// intrusive list of ownerships of read-write mutexes
+using ReadWriteMutexOwnershipList = estd::IntrusiveList<ReadWriteMutexOwnership, &ReadWriteMutexOwnership::node>;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_READWRITEMUTEXOWNERSHIP_HPP_
@@ -0,0 +1,160 @@
+/**
+ * \file
+ * \brief RecordBuffer class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_RECORDBUFFER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_RECORDBUFFER_HPP_
+
+#include "estd/RawCircularBuffer.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief RecordBuffer class is a circular buffer of variable-length records.
+ *
+ * Each record is stored contiguously, preceded by a header with its length and followed by padding which aligns the
+ * next header. When the record doesn't fit between current write position and the end of storage, the remaining space
+ * is filled with a padding header and the record is written at the beginning of storage. Whenever the buffer becomes
+ * empty, read and write positions are reset to the beginning of storage, so an empty buffer can always hold a record of
+ * getMaxRecordSize() bytes.
+ *
+ * \note This class provides no synchronization - all accesses must be serialized by the user.
+ */
+
+class RecordBuffer
+{
+public:
+
+	/// type of header preceding each record
+	using Header = size_t;
+
+	/// size of header preceding each record, bytes, capacity and size of each record are aligned to this value
+	constexpr static size_t headerSize {sizeof(Header)};
+
+	/**
+	 * \brief RecordBuffer's constructor
+	 *
+	 * \param [in] storage is a pointer to storage for records, should be aligned to \a headerSize
+	 * \param [in] size is the size of \a storage, bytes, it is rounded down to a multiple of \a headerSize
+	 */
+
+	constexpr RecordBuffer(void* const storage, const size_t size) :
+			circularBuffer_{storage, size / headerSize * headerSize}
+	{
+
+	}
+
+	/**
+	 * \return total capacity of the buffer, bytes
+	 */
+
+	size_t getCapacity() const
+	{
+		return circularBuffer_.getCapacity();
+	}
+
+	/**
+	 * \brief Gets size of the first record in the buffer, skipping padding at the end of storage.
+	 *
+	 * \attention the buffer must not be empty
+	 *
+	 * \return size of the first record, bytes
+	 */
+
+	size_t getFirstRecordSize();
+
+	/**
+	 * \return maximum number of records in the buffer - all of them having 0 bytes
+	 */
+
+	size_t getMaxRecords() const
+	{
+		return getCapacity() / headerSize;
+	}
+
+	/**
+	 * \return maximum size of single record, bytes
+	 */
+
+	size_t getMaxRecordSize() const
+	{
+		return getCapacity() != 0 ? getCapacity() - headerSize : 0;
+	}
+
+	/**
+	 * \return true if the buffer is empty, false otherwise
+	 */
+
+	bool isEmpty() const
+	{
+		return circularBuffer_.isEmpty();
+	}
+
+	/**
+	 * \return true if the buffer is full, false otherwise
+	 */
+
+	bool isFull() const
+	{
+		return circularBuffer_.isFull();
+	}
+
+	/**
+	 * \brief Copies the first record from the buffer and removes it.
+	 *
+	 * \attention the buffer must not be empty
+	 *
+	 * \param [out] buffer is a pointer to buffer for the record, sufficiently large for getFirstRecordSize() bytes
+	 *
+	 * \return size of popped record, bytes
+	 */
+
+	size_t pop(void* buffer);
+
+	/**
+	 * \brief Tries to copy the record to the buffer.
+	 *
+	 * \param [in] data is a pointer to data of the record
+	 * \param [in] size is the size of \a data, bytes, must be less than or equal to getMaxRecordSize()
+	 *
+	 * \return true if the record was pushed, false if there is currently not enough contiguous free space for it
+	 */
+
+	bool tryPush(const void* data, size_t size);
+
+private:
+
+	/// value of header which marks padding at the end of storage
+	constexpr static Header paddingHeader {SIZE_MAX};
+
+	/**
+	 * \param [in] size is the size of record, bytes
+	 *
+	 * \return number of bytes occupied by the record in storage, including header and padding
+	 */
+
+	constexpr static size_t getFootprint(const size_t size)
+	{
+		return headerSize + (size + headerSize - 1) / headerSize * headerSize;
+	}
+
+	/// raw circular buffer for records
+	estd::RawCircularBuffer circularBuffer_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_RECORDBUFFER_HPP_
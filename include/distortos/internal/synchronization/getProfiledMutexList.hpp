@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief getProfiledMutexList() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_GETPROFILEDMUTEXLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_GETPROFILEDMUTEXLIST_HPP_
+
+#include "distortos/internal/synchronization/ProfiledMutexList.hpp"
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \return reference to main instance of ProfiledMutexList, which contains all mutexes that were locked at least once
+ */
+
+constexpr ProfiledMutexList& getProfiledMutexList()
+{
+	extern ProfiledMutexList profiledMutexListInstance;
+	return profiledMutexListInstance;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_GETPROFILEDMUTEXLIST_HPP_
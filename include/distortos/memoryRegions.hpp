@@ -0,0 +1,85 @@
+/**
+ * \file
+ * \brief Header with functions for allocation from memory regions
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_MEMORYREGIONS_HPP_
+#define INCLUDE_DISTORTOS_MEMORYREGIONS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/MemoryCapabilities.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace memoryRegions
+{
+
+/**
+ * \brief Allocates memory from a region with requested capabilities.
+ *
+ * Regions are tried in order in which they are defined in board's metadata, but the region which holds main heap (used
+ * by malloc() and free()) is always tried first. Allocation from the first matching region which has enough free
+ * memory is returned.
+ *
+ * \param [in] capabilities are the required capabilities, region is matching if it has all of them,
+ * MemoryCapabilities::none matches any region
+ * \param [in] size is the size of memory, bytes
+ * \param [in] alignment is the required alignment of memory, must be a power of 2, default - alignof(max_align_t)
+ *
+ * \return pointer to allocated memory on success, nullptr if no matching region has enough free memory
+ */
+
+void* allocate(MemoryCapabilities capabilities, size_t size, size_t alignment = alignof(max_align_t));
+
+/**
+ * \brief Deallocates memory allocated with allocate().
+ *
+ * Memory from the region which holds main heap may be also deallocated with free(), and memory allocated with
+ * malloc() may be also deallocated with this function.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void deallocate(void* memory);
+
+/**
+ * \param [in] index is the index of region, [0; getCount())
+ *
+ * \return capabilities of region
+ */
+
+MemoryCapabilities getCapabilities(size_t index);
+
+/**
+ * \return number of memory regions
+ */
+
+size_t getCount();
+
+/**
+ * \param [in] index is the index of region, [0; getCount())
+ *
+ * \return name of region, as in board's metadata
+ */
+
+const char* getName(size_t index);
+
+}	// namespace memoryRegions
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_MEMORYREGIONS_HPP_
@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief stackUsageWarningHook() header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STACKUSAGEWARNINGHOOK_HPP_
+#define INCLUDE_DISTORTOS_STACKUSAGEWARNINGHOOK_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+#include "distortos/ThreadIdentifier.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+/**
+ * \brief Hook function called when usage of thread's stack crosses configured threshold.
+ *
+ * This function is called by stack monitor - from the idle thread, with unmasked interrupts - at most once for each
+ * thread, when "high water mark" of its stack reaches DISTORTOS_STACK_USAGE_WARNING_THRESHOLD percent of stack's size.
+ * It may be used to log the warning, but it must not block. As the thread may be deleted before the hook is called, it
+ * is identified with ThreadIdentifier - ThreadIdentifier::getThread() returns nullptr in that case.
+ *
+ * \note Use of this function is optional - it may be left undefined, in which case it will not be called.
+ *
+ * \param [in] threadIdentifier is the identifier of thread which stack's usage crossed the threshold
+ * \param [in] highWaterMark is the "high water mark" (max usage) of thread's stack, bytes
+ */
+
+void stackUsageWarningHook(ThreadIdentifier threadIdentifier, size_t highWaterMark) __attribute__ ((weak));
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_STACKUSAGEWARNINGHOOK_HPP_
@@ -12,6 +12,29 @@
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#include "distortos/HighResolutionClock.hpp"
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include "distortos/HeapStatistics.hpp"
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#include "distortos/MutexStatistics.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#include <cstddef>
 #include <cstdint>
 
 namespace distortos
@@ -29,6 +52,106 @@ namespace statistics
 
 uint64_t getContextSwitchCount();
 
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+/**
+ * \return snapshot of usage of TLSF heap used by malloc() and free()
+ */
+
+HeapStatistics getHeapStatistics();
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+/**
+ * \param [in] index is the index of memory region, [0; memoryRegions::getCount())
+ *
+ * \return snapshot of usage of heap of memory region
+ */
+
+HeapStatistics getMemoryRegionStatistics(size_t index);
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+/**
+ * \brief Gets statistics of all profiled mutexes.
+ *
+ * Mutex is profiled after it is locked for the first time - this includes mutexes used internally, e.g. locks of
+ * newlib and mutex protecting file descriptions.
+ *
+ * \param [out] statistics is a range in which statistics of profiled mutexes will be copied, in the order of their
+ * first lock
+ *
+ * \return number of all profiled mutexes, may be greater than number of elements in \a statistics - in that case
+ * only the first statistics.size() entries are copied
+ */
+
+size_t getMutexStatistics(estd::ContiguousRange<MutexStatistics> statistics);
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+/**
+ * \return number of executions of software timers' functions by daemon thread of software timers
+ */
+
+uint64_t getSoftwareTimerDaemonExecutionCount();
+
+/**
+ * \return max queueing delay - duration between expiration of software timer with deferred execution and execution of
+ * its function by daemon thread of software timers
+ */
+
+HighResolutionClock::duration getSoftwareTimerDaemonMaxQueueingDelay();
+
+/**
+ * \return sum of queueing delays of all executions of software timers' functions by daemon thread of software timers,
+ * divided by getSoftwareTimerDaemonExecutionCount() it gives mean queueing delay
+ */
+
+HighResolutionClock::duration getSoftwareTimerDaemonTotalQueueingDelay();
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+/**
+ * \return number of executions of software timers' functions
+ */
+
+uint64_t getSoftwareTimerExecutionCount();
+
+/**
+ * \return number of ticks in which at least one software timer expired, ratio of getSoftwareTimerExecutionCount() to
+ * this value shows how effectively expirations of software timers are coalesced
+ */
+
+uint64_t getSoftwareTimerExpiryTickCount();
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+
+/**
+ * \return number of dynamic threads which reused block of memory of deleted dynamic thread
+ */
+
+size_t getThreadRecyclingCacheHitCount();
+
+/**
+ * \return number of dynamic threads which could not reuse block of memory of deleted dynamic thread
+ */
+
+size_t getThreadRecyclingCacheMissCount();
+
+/**
+ * \return number of blocks of memory of deleted dynamic threads which are currently retained for reuse
+ */
+
+size_t getThreadRecyclingCacheSize();
+
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
 /// \}
 
 }	// namespace statistics
@@ -0,0 +1,106 @@
+/**
+ * \file
+ * \brief trace namespace header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TRACE_HPP_
+#define INCLUDE_DISTORTOS_TRACE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+#include "distortos/TraceRecord.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief trace namespace groups functions of trace recorder
+ *
+ * Trace recorder keeps the most recent events of scheduler (context switches, blocking and unblocking of threads,
+ * ticks), mutexes and queues in a statically allocated ring buffer. Records may be drained with read() - e.g. to be
+ * written to devices::SerialPort - or the whole ring buffer may be dumped by the debugger from the range
+ * `distortos::internal::traceRecorderInstance.records_`. Both kinds of data can be converted on host with
+ * scripts/convertTrace.py to a format which can be viewed in Perfetto UI or chrome://tracing.
+ */
+
+namespace trace
+{
+
+/// \addtogroup statistics
+/// \{
+
+/**
+ * \brief Clears ring buffer of trace recorder.
+ *
+ * \note This function can be used from any context.
+ */
+
+void clear();
+
+/**
+ * \brief Gets frequency of timestamps of trace records.
+ *
+ * \note This function can be used from any context.
+ *
+ * \return frequency of timestamps of trace records (number of cycles of tick timer in one second), Hz
+ */
+
+uint64_t getTimestampFrequency();
+
+/**
+ * \brief Moves the oldest records from the ring buffer of trace recorder.
+ *
+ * Interrupts are masked only while a single record is moved, so this function can be used with large buffers. If any
+ * records were overwritten since previous read, first copied record has TraceRecord::Type::lostRecords type.
+ *
+ * \note This function can be used from any context.
+ *
+ * \param [out] records is a range in which the oldest records will be copied, from the oldest to the newest
+ *
+ * \return number of records copied to \a records
+ */
+
+size_t read(estd::ContiguousRange<TraceRecord> records);
+
+/**
+ * \brief Records entry to interrupt handler.
+ *
+ * Interrupt handlers are not wrapped by the system, so this function should be called at the beginning of each
+ * interrupt handler which should be visible in the trace.
+ *
+ * \note This function can be used from any context.
+ *
+ * \param [in] number is the number of interrupt, it is only stored in the trace
+ */
+
+void recordInterruptEntry(uint32_t number);
+
+/**
+ * \brief Records exit from interrupt handler.
+ *
+ * \note This function can be used from any context.
+ *
+ * \param [in] number is the number of interrupt, it is only stored in the trace
+ */
+
+void recordInterruptExit(uint32_t number);
+
+/// \}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_TRACE_HPP_
@@ -0,0 +1,204 @@
+#!/usr/bin/env python
+
+#
+# file: convertTrace.py
+#
+# author: Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+#
+
+import argparse
+import bisect
+import json
+import struct
+import subprocess
+
+# layout of distortos::TraceRecord on 32-bit little-endian target
+recordStruct = struct.Struct('<QIIIBB2x')
+
+threadSwitch, threadBlock, threadUnblock, tick, mutexLock, mutexUnlock, queuePush, queuePop, interruptEntry, \
+		interruptExit, lostRecords = range(1, 12)
+
+threadStates = ('created', 'runnable', 'terminated', 'sleeping', 'blockedOnSemaphore', 'suspended', 'blockedOnMutex',
+		'blockedOnConditionVariable', 'blockedOnReadWriteMutex', 'waitingForSignal', 'detached')
+
+unblockReasons = ('unblockRequest', 'timeout', 'signal')
+
+# process and thread identifiers used for tracks which are not related to any thread
+processId = 1
+interruptsThreadId = 0
+
+class Symbolizer(object):
+	"""Translates addresses of objects to names of symbols, using nm from the toolchain."""
+
+	def __init__(self, elf, prefix):
+		"""Symbolizer's constructor
+
+		* `elf` is the path to ELF file of the application, None if addresses should not be symbolized
+		* `prefix` is the prefix of toolchain tools, e.g. `'arm-none-eabi-'`
+		"""
+
+		self.symbols = []
+		if elf is not None:
+			output = subprocess.check_output([prefix + 'nm', '-S', '-C', '--defined-only', elf],
+					universal_newlines = True)
+			for line in output.splitlines():
+				fields = line.split(None, 3)
+				if len(fields) != 4:
+					continue
+				address, size, _, name = fields
+				self.symbols.append((int(address, 16), int(size, 16), name))
+		self.symbols.sort()
+		self.addresses = [symbol[0] for symbol in self.symbols]
+
+	def getName(self, address):
+		"""Returns name of symbol containing the address, possibly with offset.
+
+		* `address` is the address which will be translated
+		"""
+
+		index = bisect.bisect_right(self.addresses, address) - 1
+		if index >= 0:
+			symbolAddress, symbolSize, name = self.symbols[index]
+			if address < symbolAddress + max(symbolSize, 1):
+				return '{}+0x{:x}'.format(name, address - symbolAddress) if address != symbolAddress else name
+		return '0x{:08x}'.format(address)
+
+def readRecords(filenames):
+	"""Reads records from binary files, drops empty and duplicated records and sorts them by timestamp.
+
+	Files may contain records drained with `distortos::trace::read()` or raw dumps of the ring buffer made by the
+	debugger.
+
+	* `filenames` is a list of names of files with records
+	"""
+
+	records = []
+	seen = set()
+	for filename in filenames:
+		with open(filename, 'rb') as file:
+			data = file.read()
+		for offset in range(0, len(data) - recordStruct.size + 1, recordStruct.size):
+			record = recordStruct.unpack_from(data, offset)
+			if record[4] == 0 or record in seen:
+				continue
+			seen.add(record)
+			records.append(record)
+	records.sort(key = lambda record: record[0])
+	return records
+
+def convert(records, frequency, symbolizer):
+	"""Converts records to list of events in Trace Event Format, which can be opened in Perfetto UI and
+	chrome://tracing.
+
+	Each thread gets its own track with slices for periods in which it was running. Wake-ups are shown as flows from
+	the thread (or interrupt) which unblocked the thread to the moment when the woken thread started running. Mutex
+	hold times are shown as async slices.
+
+	* `records` is a list of records sorted by timestamp
+	* `frequency` is the frequency of timestamps, Hz
+	* `symbolizer` is the `Symbolizer` object used to name threads and objects
+	"""
+
+	events = [{'ph': 'M', 'pid': processId, 'name': 'process_name', 'args': {'name': 'distortos'}},
+			{'ph': 'M', 'pid': processId, 'tid': interruptsThreadId, 'name': 'thread_name',
+					'args': {'name': 'interrupts'}}]
+	threadIds = {}
+
+	def getThreadId(thread):
+		if thread not in threadIds:
+			threadIds[thread] = len(threadIds) + 1
+			events.append({'ph': 'M', 'pid': processId, 'tid': threadIds[thread], 'name': 'thread_name',
+					'args': {'name': symbolizer.getName(thread)}})
+		return threadIds[thread]
+
+	def getTime(timestamp):
+		return timestamp * 1000000.0 / frequency
+
+	def getTrackId(record):
+		return interruptsThreadId if record[5] == True or record[1] == 0 else getThreadId(record[1])
+
+	runningThread = None
+	runningSince = None
+	pendingWakeUps = {}
+	flowId = 0
+
+	for timestamp, thread, object, argument, type, interrupt in records:
+		time = getTime(timestamp)
+		record = (timestamp, thread, object, argument, type, interrupt)
+		if runningThread is None and thread != 0:
+			runningThread = thread
+			runningSince = time
+
+		if type == threadSwitch:
+			if runningThread is not None and time > runningSince:
+				events.append({'ph': 'X', 'pid': processId, 'tid': getThreadId(runningThread), 'ts': runningSince,
+						'dur': time - runningSince, 'name': 'running'})
+			runningThread = object
+			runningSince = time
+			for wakeUpId in pendingWakeUps.pop(object, []):
+				events.append({'ph': 'f', 'bp': 'e', 'pid': processId, 'tid': getThreadId(object), 'ts': time,
+						'id': wakeUpId, 'cat': 'wake-up', 'name': 'wake-up'})
+			events.append({'ph': 'i', 's': 't', 'pid': processId, 'tid': getThreadId(object), 'ts': time,
+					'name': 'switch in', 'args': {'priority': argument}})
+		elif type == threadBlock:
+			state = threadStates[argument] if argument < len(threadStates) else str(argument)
+			events.append({'ph': 'i', 's': 't', 'pid': processId, 'tid': getThreadId(object), 'ts': time,
+					'name': 'block', 'args': {'state': state}})
+		elif type == threadUnblock:
+			reason = unblockReasons[argument] if argument < len(unblockReasons) else str(argument)
+			events.append({'ph': 'i', 's': 't', 'pid': processId, 'tid': getThreadId(object), 'ts': time,
+					'name': 'unblock', 'args': {'reason': reason, 'by': symbolizer.getName(thread) if interrupt == False
+					else 'interrupt'}})
+			flowId += 1
+			pendingWakeUps.setdefault(object, []).append(flowId)
+			events.append({'ph': 's', 'pid': processId, 'tid': getTrackId(record), 'ts': time, 'id': flowId,
+					'cat': 'wake-up', 'name': 'wake-up'})
+		elif type == tick:
+			events.append({'ph': 'i', 's': 't', 'pid': processId, 'tid': interruptsThreadId, 'ts': time,
+					'name': 'tick', 'args': {'tick count': argument}})
+		elif type == mutexLock or type == mutexUnlock:
+			events.append({'ph': 'b' if type == mutexLock else 'e', 'pid': processId, 'tid': getTrackId(record),
+					'ts': time, 'id': '0x{:x}-0x{:x}'.format(object, thread), 'cat': 'mutex',
+					'name': 'hold {}'.format(symbolizer.getName(object)),
+					'args': {'contended': argument != 0} if type == mutexLock else {}})
+		elif type == queuePush or type == queuePop:
+			events.append({'ph': 'i', 's': 't', 'pid': processId, 'tid': getTrackId(record), 'ts': time,
+					'name': 'push' if type == queuePush else 'pop', 'args': {'queue': symbolizer.getName(object)}})
+		elif type == interruptEntry or type == interruptExit:
+			events.append({'ph': 'B' if type == interruptEntry else 'E', 'pid': processId, 'tid': interruptsThreadId,
+					'ts': time, 'name': 'interrupt {}'.format(argument)})
+		elif type == lostRecords:
+			events.append({'ph': 'i', 's': 'g', 'pid': processId, 'tid': interruptsThreadId, 'ts': time,
+					'name': '{} records lost'.format(argument)})
+
+	if runningThread is not None and len(records) != 0:
+		time = getTime(records[-1][0])
+		events.append({'ph': 'X', 'pid': processId, 'tid': getThreadId(runningThread), 'ts': runningSince,
+				'dur': time - runningSince, 'name': 'running'})
+
+	return events
+
+#
+# main
+#
+
+parser = argparse.ArgumentParser(description = 'Convert records of distortos trace recorder (drained with '
+		'distortos::trace::read() or dumped by the debugger) to Trace Event Format (JSON), which can be opened in '
+		'Perfetto UI (https://ui.perfetto.dev) or chrome://tracing.')
+parser.add_argument('input', nargs = '+', help = 'binary file with records')
+parser.add_argument('-o', '--output', required = True, help = 'output JSON file')
+parser.add_argument('-f', '--frequency', type = int, required = True, help = 'frequency of timestamps, Hz, as '
+		'returned by distortos::trace::getTimestampFrequency()')
+parser.add_argument('--elf', help = 'ELF file of the application, used to name threads, mutexes and queues')
+parser.add_argument('--prefix', default = 'arm-none-eabi-', help = 'prefix of toolchain tools, default - '
+		'\'arm-none-eabi-\'')
+arguments = parser.parse_args()
+
+records = readRecords(arguments.input)
+events = convert(records, arguments.frequency, Symbolizer(arguments.elf, arguments.prefix))
+with open(arguments.output, 'w') as file:
+	json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, file, indent = 1)
+print('Converted {} records to {} events'.format(len(records), len(events)))
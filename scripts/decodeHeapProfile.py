@@ -0,0 +1,152 @@
+#!/usr/bin/env python
+
+#
+# file: decodeHeapProfile.py
+#
+# author: Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+#
+
+import argparse
+import bisect
+import struct
+import subprocess
+
+# layout of distortos::HeapProfilerEvent on 32-bit little-endian target
+eventStruct = struct.Struct('<QIIIIB7x')
+# layout of distortos::HeapProfilerCallSite on 32-bit little-endian target
+callSiteStruct = struct.Struct('<IIIII')
+
+eventTypes = ('allocation', 'deallocation')
+
+class Symbolizer(object):
+	"""Translates addresses to names of symbols and source locations, using tools from the toolchain."""
+
+	def __init__(self, elf, prefix):
+		"""Symbolizer's constructor
+
+		* `elf` is the path to ELF file of the application, None if addresses should not be symbolized
+		* `prefix` is the prefix of toolchain tools, e.g. `'arm-none-eabi-'`
+		"""
+
+		self.elf = elf
+		self.prefix = prefix
+		self.locations = {}
+		self.symbols = []
+		if elf is None:
+			return
+
+		output = subprocess.check_output([prefix + 'nm', '-S', '-C', '--defined-only', elf], universal_newlines = True)
+		for line in output.splitlines():
+			fields = line.split(None, 3)
+			if len(fields) != 4:
+				continue
+			address, size, _, name = fields
+			self.symbols.append((int(address, 16), int(size, 16), name))
+		self.symbols.sort()
+		self.addresses = [symbol[0] for symbol in self.symbols]
+
+	def getLocations(self, addresses):
+		"""Translates addresses to source locations with a single call to addr2line.
+
+		* `addresses` is an iterable with addresses
+		"""
+
+		addresses = sorted(set(address for address in addresses if address not in self.locations and address != 0))
+		if self.elf is None or len(addresses) == 0:
+			return
+
+		# return address points after the call instruction (and has Thumb bit set), so look up the call instruction
+		arguments = [self.prefix + 'addr2line', '-e', self.elf] + ['0x{:x}'.format((address & ~1) - 1) for address in
+				addresses]
+		output = subprocess.check_output(arguments, universal_newlines = True)
+		for address, location in zip(addresses, output.splitlines()):
+			self.locations[address] = location.strip()
+
+	def getName(self, address):
+		"""Returns name of symbol containing the address, possibly with offset.
+
+		* `address` is the address which will be translated
+		"""
+
+		if address == 0:
+			return '-'
+		# Thumb bit is cleared, so that return addresses of Thumb code are found in their functions
+		address &= ~1
+		index = bisect.bisect_right(self.addresses, address) - 1 if self.elf is not None else -1
+		if index >= 0:
+			symbolAddress, symbolSize, name = self.symbols[index]
+			if address < symbolAddress + max(symbolSize, 1):
+				return '{}+0x{:x}'.format(name, address - symbolAddress) if address != symbolAddress else name
+		return '0x{:08x}'.format(address)
+
+	def describe(self, address):
+		"""Returns description of return address, with name of symbol and source location if available.
+
+		* `address` is the address which will be described
+		"""
+
+		location = self.locations.get(address)
+		name = self.getName(address)
+		if location is None or location.startswith('??') == True:
+			return name
+		return '{} ({})'.format(name, location)
+
+def readRecords(filename, recordStruct, count):
+	"""Reads records from raw binary dump.
+
+	* `filename` is the name of file with raw dump
+	* `recordStruct` is the `struct.Struct` object describing layout of single record
+	* `count` is the number of valid records in the dump, None to use all complete records
+	"""
+
+	with open(filename, 'rb') as file:
+		data = file.read()
+	available = len(data) // recordStruct.size
+	count = available if count is None else min(count, available)
+	return [recordStruct.unpack_from(data, i * recordStruct.size) for i in range(count)]
+
+#
+# main
+#
+
+parser = argparse.ArgumentParser(description = 'Decode raw dumps of distortos::HeapProfilerEvent and '
+		'distortos::HeapProfilerCallSite arrays filled by distortos::heapProfiler::takeSnapshot(). Dumps may be '
+		'created with GDB, e.g. "dump binary memory events.bin events events + snapshot.events".')
+parser.add_argument('--elf', help = 'ELF file of the application, used to symbolize callers and threads')
+parser.add_argument('--prefix', default = 'arm-none-eabi-', help = 'prefix of toolchain tools, default - '
+		'\'arm-none-eabi-\'')
+parser.add_argument('--events', help = 'raw dump of array of distortos::HeapProfilerEvent')
+parser.add_argument('--events-count', type = int, help = 'number of valid events in the dump, default - all')
+parser.add_argument('--call-sites', help = 'raw dump of array of distortos::HeapProfilerCallSite')
+parser.add_argument('--call-sites-count', type = int, help = 'number of valid call sites in the dump, default - '
+		'all')
+arguments = parser.parse_args()
+
+symbolizer = Symbolizer(arguments.elf, arguments.prefix)
+
+if arguments.call_sites is not None:
+	callSites = readRecords(arguments.call_sites, callSiteStruct, arguments.call_sites_count)
+	callSites = [callSite for callSite in callSites if callSite[0] != 0]
+	callSites.sort(key = lambda callSite: callSite[3], reverse = True)
+	symbolizer.getLocations(callSite[0] for callSite in callSites)
+	print('{:>12} {:>12} {:>12} {:>12}  {}'.format('live bytes', 'peak bytes', 'live blocks', 'allocations',
+			'call site'))
+	for caller, allocations, liveBlocks, liveSize, peakLiveSize in callSites:
+		print('{:>12} {:>12} {:>12} {:>12}  {}'.format(liveSize, peakLiveSize, liveBlocks, allocations,
+				symbolizer.describe(caller)))
+	print('{:>12} {:>12} {:>12} {:>12}  total'.format(sum(callSite[3] for callSite in callSites),
+			'', sum(callSite[2] for callSite in callSites), sum(callSite[1] for callSite in callSites)))
+
+if arguments.events is not None:
+	if arguments.call_sites is not None:
+		print('')
+	events = readRecords(arguments.events, eventStruct, arguments.events_count)
+	symbolizer.getLocations(event[1] for event in events)
+	print('{:>12} {:<12} {:>10} {:>8}  {:<24} {}'.format('timestamp', 'type', 'memory', 'size', 'thread', 'caller'))
+	for timestamp, caller, memory, thread, size, type in events:
+		typeName = eventTypes[type] if type < len(eventTypes) else str(type)
+		print('{:>12} {:<12} 0x{:08x} {:>8}  {:<24} {}'.format(timestamp, typeName, memory, size,
+				symbolizer.getName(thread), symbolizer.describe(caller)))
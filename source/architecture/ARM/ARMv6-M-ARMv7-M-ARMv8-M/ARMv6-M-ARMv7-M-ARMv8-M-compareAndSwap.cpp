@@ -0,0 +1,66 @@
+/**
+ * \file
+ * \brief compareAndSwap() implementation for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/compareAndSwap.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#ifdef __ARM_ARCH_6M__
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#endif	// def __ARM_ARCH_6M__
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool compareAndSwap(uintptr_t& object, const uintptr_t expected, const uintptr_t desired)
+{
+#ifdef __ARM_ARCH_6M__
+
+	// no exclusive access instructions in ARMv6-M
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (object != expected)
+		return false;
+
+	object = desired;
+	return true;
+
+#else	// !def __ARM_ARCH_6M__
+
+	const auto address = reinterpret_cast<volatile uint32_t*>(&object);
+	// local exclusive monitor is cleared on exception entry and return, so STREX fails if this sequence gets preempted
+	do
+	{
+		if (__LDREXW(address) != expected)
+		{
+			__CLREX();
+			return false;
+		}
+	} while (__STREXW(desired, address) != 0);
+
+	__DMB();
+	return true;
+
+#endif	// !def __ARM_ARCH_6M__
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief getTickTimerCounter() implementation for ARMv6-M, ARMv7-M and ARMv8-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getTickTimerCounter.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TickTimerCounter getTickTimerCounter()
+{
+	const uint32_t period {SysTick->LOAD + 1};
+	auto value = SysTick->VAL;
+	const auto pendingTick = (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+	// SysTick may have reached 0 (which makes its interrupt pending) after its value was read
+	if (pendingTick == true)
+		value = SysTick->VAL;
+
+	// SysTick counts down and period ends when it reaches 0, then LOAD is reloaded on next cycle
+	return {value == 0 ? 0 : period - value, period, pendingTick};
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -13,9 +13,11 @@ target_include_directories(distortos PUBLIC
 
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-architectureLowLevelInitializer.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-compareAndSwap.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-disableInterruptMasking.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-enableInterruptMasking.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-getMainStack.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-getTickTimerCounter.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-initializeStack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-isInInterruptContext.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ARMv8-M-PendSV_Handler.cpp
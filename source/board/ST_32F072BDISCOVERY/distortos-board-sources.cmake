@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F072BDISCOVERY-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F072BDISCOVERY-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F072BDISCOVERY-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_32F072BDISCOVERY-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F072BDISCOVERY-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F072BDISCOVERY-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F072BDISCOVERY-vectorTable.cpp)
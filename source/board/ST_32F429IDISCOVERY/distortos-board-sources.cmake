@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F429IDISCOVERY-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F429IDISCOVERY-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F429IDISCOVERY-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_32F429IDISCOVERY-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F429IDISCOVERY-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F429IDISCOVERY-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F429IDISCOVERY-uarts.cpp
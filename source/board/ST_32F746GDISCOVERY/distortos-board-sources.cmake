@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F746GDISCOVERY-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F746GDISCOVERY-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F746GDISCOVERY-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_32F746GDISCOVERY-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F746GDISCOVERY-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F746GDISCOVERY-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F746GDISCOVERY-uarts.cpp
@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F769IDISCOVERY-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F769IDISCOVERY-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F769IDISCOVERY-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_32F769IDISCOVERY-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F769IDISCOVERY-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F769IDISCOVERY-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_32F769IDISCOVERY-uarts.cpp
@@ -0,0 +1,85 @@
+/**
+ * \file
+ * \brief ST,NUCLEO-F042K6 (ST,STM32F042K6 chip) memory regions
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ * \warning
+ * Automatically generated file - do not edit!
+ */
+
+#include "distortos/internal/memory/MemoryRegion.hpp"
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+extern "C"
+{
+
+extern char __SRAM_heap_start[];	// imported from linker script
+extern char __SRAM_heap_end[];		// imported from linker script
+
+}	// extern "C"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef DISTORTOS_LD_HEAP_REGION_SRAM
+
+/// heap of SRAM memory region
+TlsfHeap SRAMHeap;
+
+#endif	// !def DISTORTOS_LD_HEAP_REGION_SRAM
+
+/// array with all memory regions
+MemoryRegion memoryRegionsArray[]
+{
+		{
+				"SRAM",
+				MemoryCapabilities::none,
+#ifdef DISTORTOS_LD_HEAP_REGION_SRAM
+				getTlsfHeap(),
+#else	// !def DISTORTOS_LD_HEAP_REGION_SRAM
+				SRAMHeap,
+#endif	// !def DISTORTOS_LD_HEAP_REGION_SRAM
+				__SRAM_heap_start,
+				__SRAM_heap_end,
+		},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MemoryRegionsRange getMemoryRegions()
+{
+	return MemoryRegionsRange{memoryRegionsArray};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
@@ -23,6 +23,7 @@ target_include_directories(distortos PUBLIC
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F042K6-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F042K6-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F042K6-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F042K6-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F042K6-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F042K6-vectorTable.cpp)
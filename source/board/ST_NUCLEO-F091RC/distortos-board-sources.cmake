@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F091RC-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F091RC-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F091RC-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F091RC-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F091RC-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F091RC-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F091RC-vectorTable.cpp)
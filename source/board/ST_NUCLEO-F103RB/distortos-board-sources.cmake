@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F103RB-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F103RB-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F103RB-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F103RB-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F103RB-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F103RB-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F103RB-vectorTable.cpp)
@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F401RE-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F401RE-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F401RE-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F401RE-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F401RE-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F401RE-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F401RE-uarts.cpp
@@ -0,0 +1,115 @@
+/**
+ * \file
+ * \brief Definitions of low-level compare timer drivers for TIMv1 in ST,NUCLEO-F429ZI (ST,STM32F429ZI chip)
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ * \warning
+ * Automatically generated file - do not edit!
+ */
+
+#include "distortos/chip/compareTimers.hpp"
+
+#include "distortos/chip/ChipCompareTimerLowLevel.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+
+namespace distortos
+{
+
+namespace chip
+{
+
+#ifdef DISTORTOS_CHIP_TIM2_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| TIM2
++---------------------------------------------------------------------------------------------------------------------*/
+
+namespace
+{
+
+/**
+ * \brief Low-level chip initializer for TIM2
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void tim2LowLevelInitializer()
+{
+#if defined(RCC_APB1ENR_TIM2EN)
+	RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+#elif defined(RCC_APB2ENR_TIM2EN)
+	RCC->APB2ENR |= RCC_APB2ENR_TIM2EN;
+#else
+	#error "Unsupported bus for TIM2!"
+#endif
+}
+
+BIND_LOW_LEVEL_INITIALIZER(50, tim2LowLevelInitializer);
+
+}	// namespace
+
+ChipCompareTimerLowLevel tim2 {TIM2_BASE, DISTORTOS_CHIP_TIM2_PRESCALER};
+
+/**
+ * \brief TIM2 interrupt handler
+ */
+
+extern "C" void TIM2_IRQHandler()
+{
+	tim2.interruptHandler();
+}
+
+#endif	// def DISTORTOS_CHIP_TIM2_ENABLE
+
+#ifdef DISTORTOS_CHIP_TIM5_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| TIM5
++---------------------------------------------------------------------------------------------------------------------*/
+
+namespace
+{
+
+/**
+ * \brief Low-level chip initializer for TIM5
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void tim5LowLevelInitializer()
+{
+#if defined(RCC_APB1ENR_TIM5EN)
+	RCC->APB1ENR |= RCC_APB1ENR_TIM5EN;
+#elif defined(RCC_APB2ENR_TIM5EN)
+	RCC->APB2ENR |= RCC_APB2ENR_TIM5EN;
+#else
+	#error "Unsupported bus for TIM5!"
+#endif
+}
+
+BIND_LOW_LEVEL_INITIALIZER(50, tim5LowLevelInitializer);
+
+}	// namespace
+
+ChipCompareTimerLowLevel tim5 {TIM5_BASE, DISTORTOS_CHIP_TIM5_PRESCALER};
+
+/**
+ * \brief TIM5 interrupt handler
+ */
+
+extern "C" void TIM5_IRQHandler()
+{
+	tim5.interruptHandler();
+}
+
+#endif	// def DISTORTOS_CHIP_TIM5_ENABLE
+
+}	// namespace chip
+
+}	// namespace distortos
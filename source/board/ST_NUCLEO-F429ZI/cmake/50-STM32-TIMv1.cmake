@@ -0,0 +1,52 @@
+#
+# file: cmake/50-STM32-TIMv1.cmake
+#
+# author: Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+#
+# Automatically generated file - do not edit!
+#
+
+distortosSetConfiguration(BOOLEAN
+		distortos_Peripherals_TIM2
+		OFF
+		HELP "Enable TIM2 low-level compare timer driver."
+		OUTPUT_NAME DISTORTOS_CHIP_TIM2_ENABLE)
+
+if(distortos_Peripherals_TIM2)
+
+	distortosSetConfiguration(INTEGER
+			distortos_Peripherals_TIM2_00_Prescaler
+			1
+			MIN 1
+			MAX 65536
+			HELP "Value by which the clock of TIM2 is divided."
+			OUTPUT_NAME DISTORTOS_CHIP_TIM2_PRESCALER)
+
+	set(ARCHITECTURE_NVIC_TIM2_ENABLE ON)
+
+endif(distortos_Peripherals_TIM2)
+
+distortosSetConfiguration(BOOLEAN
+		distortos_Peripherals_TIM5
+		OFF
+		HELP "Enable TIM5 low-level compare timer driver."
+		OUTPUT_NAME DISTORTOS_CHIP_TIM5_ENABLE)
+
+if(distortos_Peripherals_TIM5)
+
+	distortosSetConfiguration(INTEGER
+			distortos_Peripherals_TIM5_00_Prescaler
+			1
+			MIN 1
+			MAX 65536
+			HELP "Value by which the clock of TIM5 is divided."
+			OUTPUT_NAME DISTORTOS_CHIP_TIM5_PRESCALER)
+
+	set(ARCHITECTURE_NVIC_TIM5_ENABLE ON)
+
+endif(distortos_Peripherals_TIM5)
+
+include("${CMAKE_CURRENT_SOURCE_DIR}/source/chip/STM32/peripherals/TIMv1/distortos-sources.cmake")
@@ -22,8 +22,10 @@ target_include_directories(distortos PUBLIC
 
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-buttons.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-compareTimers.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F429ZI-uarts.cpp
@@ -35,6 +37,7 @@ include(${CMAKE_CURRENT_LIST_DIR}/cmake/10-buttons.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/cmake/10-leds.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/cmake/50-STM32-SDMMCv1.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/cmake/50-STM32-SPIv1.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/cmake/50-STM32-TIMv1.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/cmake/50-STM32-USARTv1.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/cmake/60-STM32-GPIOv2.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/cmake/60-STM32-device-electronic-signature.cmake)
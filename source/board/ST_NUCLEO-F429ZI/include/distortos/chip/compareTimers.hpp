@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief Declarations of low-level compare timer drivers for TIMv1 in ST,NUCLEO-F429ZI (ST,STM32F429ZI chip)
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ * \warning
+ * Automatically generated file - do not edit!
+ */
+
+#ifndef SOURCE_BOARD_ST_NUCLEO_F429ZI_INCLUDE_DISTORTOS_CHIP_COMPARETIMERS_HPP_
+#define SOURCE_BOARD_ST_NUCLEO_F429ZI_INCLUDE_DISTORTOS_CHIP_COMPARETIMERS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+namespace distortos
+{
+
+namespace chip
+{
+
+class ChipCompareTimerLowLevel;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef DISTORTOS_CHIP_TIM2_ENABLE
+
+/// compare timer low-level driver for TIM2
+extern ChipCompareTimerLowLevel tim2;
+
+#endif	// def DISTORTOS_CHIP_TIM2_ENABLE
+
+#ifdef DISTORTOS_CHIP_TIM5_ENABLE
+
+/// compare timer low-level driver for TIM5
+extern ChipCompareTimerLowLevel tim5;
+
+#endif	// def DISTORTOS_CHIP_TIM5_ENABLE
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// SOURCE_BOARD_ST_NUCLEO_F429ZI_INCLUDE_DISTORTOS_CHIP_COMPARETIMERS_HPP_
@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F446RE-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F446RE-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F446RE-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F446RE-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F446RE-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F446RE-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F446RE-uarts.cpp
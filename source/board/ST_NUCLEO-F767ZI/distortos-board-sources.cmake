@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F767ZI-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F767ZI-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F767ZI-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F767ZI-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F767ZI-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F767ZI-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-F767ZI-uarts.cpp
@@ -23,6 +23,7 @@ target_include_directories(distortos PUBLIC
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-G0B1RE-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-G0B1RE-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-G0B1RE-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-G0B1RE-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-G0B1RE-vectorTable.cpp)
 
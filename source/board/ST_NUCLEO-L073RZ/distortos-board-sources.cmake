@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L073RZ-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L073RZ-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L073RZ-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L073RZ-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L073RZ-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L073RZ-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L073RZ-vectorTable.cpp)
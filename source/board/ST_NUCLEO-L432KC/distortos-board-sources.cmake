@@ -23,6 +23,7 @@ target_include_directories(distortos PUBLIC
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L432KC-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L432KC-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L432KC-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L432KC-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L432KC-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L432KC-vectorTable.cpp)
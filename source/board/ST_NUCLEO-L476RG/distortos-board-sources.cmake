@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L476RG-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L476RG-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L476RG-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L476RG-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L476RG-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L476RG-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-L476RG-vectorTable.cpp)
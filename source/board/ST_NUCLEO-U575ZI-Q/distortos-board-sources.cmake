@@ -23,6 +23,7 @@ target_include_directories(distortos PUBLIC
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-U575ZI-Q-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-U575ZI-Q-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-U575ZI-Q-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-U575ZI-Q-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_NUCLEO-U575ZI-Q-vectorTable.cpp)
 
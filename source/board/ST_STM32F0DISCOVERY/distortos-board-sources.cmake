@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F0DISCOVERY-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F0DISCOVERY-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F0DISCOVERY-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F0DISCOVERY-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F0DISCOVERY-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F0DISCOVERY-uarts.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F0DISCOVERY-vectorTable.cpp)
@@ -24,6 +24,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F4DISCOVERY-buttons.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F4DISCOVERY-dmas.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F4DISCOVERY-leds.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F4DISCOVERY-memoryRegions.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F4DISCOVERY-sdmmcs.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F4DISCOVERY-spis.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ST_STM32F4DISCOVERY-uarts.cpp
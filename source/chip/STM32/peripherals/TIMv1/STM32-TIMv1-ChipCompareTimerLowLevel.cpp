@@ -0,0 +1,146 @@
+/**
+ * \file
+ * \brief ChipCompareTimerLowLevel class implementation for TIMv1 in STM32
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/chip/ChipCompareTimerLowLevel.hpp"
+
+#include "distortos/chip/getBusFrequency.hpp"
+
+#include "distortos/devices/timers/CompareTimerBase.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace chip
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max value of prescaler
+constexpr uint32_t maxPrescaler {65536};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Returns frequency of clock of timer.
+ *
+ * Timers are clocked with frequency of the bus to which they are connected if the bus clock is not divided, otherwise
+ * they are clocked with doubled frequency of the bus.
+ *
+ * \param [in] timBase is a base address of TIM peripheral
+ *
+ * \return frequency of clock of timer, Hz
+ */
+
+uint32_t getTimerFrequency(const uintptr_t timBase)
+{
+#if defined(DISTORTOS_CHIP_RCC_PPRE1) && defined(DISTORTOS_CHIP_RCC_PPRE2)
+	const auto divider = timBase >= APB2PERIPH_BASE ? DISTORTOS_CHIP_RCC_PPRE2 : DISTORTOS_CHIP_RCC_PPRE1;
+#elif defined(DISTORTOS_CHIP_RCC_PPRE)
+	const auto divider = DISTORTOS_CHIP_RCC_PPRE;
+#else
+	#error "Unknown divider of bus clock for timers!"
+#endif
+	const auto busFrequency = getBusFrequency(timBase);
+	return divider == 1 ? busFrequency : busFrequency * 2;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+ChipCompareTimerLowLevel::~ChipCompareTimerLowLevel()
+{
+	if (compareTimerBase_ == nullptr)
+		return;
+
+	stop();
+}
+
+void ChipCompareTimerLowLevel::generateEvent()
+{
+	getTim().EGR = TIM_EGR_CC1G;
+}
+
+uint32_t ChipCompareTimerLowLevel::getCounter() const
+{
+	return getTim().CNT;
+}
+
+void ChipCompareTimerLowLevel::interruptHandler()
+{
+	auto& tim = getTim();
+	if ((tim.SR & TIM_SR_CC1IF) == 0)
+		return;
+
+	// flags in SR register are cleared by writing 0, writing 1 has no effect
+	tim.SR = ~TIM_SR_CC1IF;
+
+	if (compareTimerBase_ != nullptr)
+		compareTimerBase_->compareMatchEvent();
+}
+
+void ChipCompareTimerLowLevel::setCompare(const uint32_t value)
+{
+	getTim().CCR1 = value;
+}
+
+std::pair<int, uint32_t> ChipCompareTimerLowLevel::start(devices::CompareTimerBase& compareTimerBase)
+{
+	if (compareTimerBase_ != nullptr)
+		return {EBADF, {}};
+
+	if (prescaler_ == 0 || prescaler_ > maxPrescaler)
+		return {EINVAL, {}};
+
+	auto& tim = getTim();
+	tim.CR1 = {};
+	tim.DIER = {};
+	tim.PSC = prescaler_ - 1;
+	tim.ARR = UINT32_MAX;
+	tim.CCMR1 = {};	// channel 1 in "frozen" output compare mode, without preload
+	tim.CCR1 = UINT32_MAX;
+	tim.CNT = {};
+	tim.EGR = TIM_EGR_UG;	// load prescaler
+	tim.SR = {};
+
+	compareTimerBase_ = &compareTimerBase;
+	tim.DIER = TIM_DIER_CC1IE;
+	tim.CR1 = TIM_CR1_CEN;
+	return {{}, getTimerFrequency(timBase_) / prescaler_};
+}
+
+int ChipCompareTimerLowLevel::stop()
+{
+	if (compareTimerBase_ == nullptr)
+		return EBADF;
+
+	auto& tim = getTim();
+	tim.CR1 = {};
+	tim.DIER = {};
+	tim.SR = {};
+	compareTimerBase_ = {};
+	return 0;
+}
+
+}	// namespace chip
+
+}	// namespace distortos
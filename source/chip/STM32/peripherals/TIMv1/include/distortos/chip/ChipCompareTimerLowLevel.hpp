@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \brief ChipCompareTimerLowLevel class header for TIMv1 in STM32
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_CHIP_STM32_PERIPHERALS_TIMV1_INCLUDE_DISTORTOS_CHIP_CHIPCOMPARETIMERLOWLEVEL_HPP_
+#define SOURCE_CHIP_STM32_PERIPHERALS_TIMV1_INCLUDE_DISTORTOS_CHIP_CHIPCOMPARETIMERLOWLEVEL_HPP_
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/devices/timers/CompareTimerLowLevel.hpp"
+
+namespace distortos
+{
+
+namespace chip
+{
+
+/**
+ * \brief ChipCompareTimerLowLevel class is a low-level driver of free-running hardware timer with compare channel for
+ * general-purpose timers with 32-bit counter (TIMv1) in STM32.
+ *
+ * The counter counts up through the whole 32-bit range and channel 1 is used as compare channel, in "frozen" output
+ * compare mode, so no pin is affected.
+ *
+ * \ingroup devices
+ */
+
+class ChipCompareTimerLowLevel : public devices::CompareTimerLowLevel
+{
+public:
+
+	/**
+	 * \brief ChipCompareTimerLowLevel's constructor
+	 *
+	 * \param [in] timBase is a base address of TIM peripheral, its counter must be 32-bit wide
+	 * \param [in] prescaler is the value by which the clock of the timer will be divided, [1; 65536]
+	 */
+
+	constexpr ChipCompareTimerLowLevel(const uintptr_t timBase, const uint32_t prescaler) :
+			compareTimerBase_{},
+			timBase_{timBase},
+			prescaler_{prescaler}
+	{
+
+	}
+
+	/**
+	 * \brief ChipCompareTimerLowLevel's destructor
+	 *
+	 * Does nothing if driver is already stopped. If it's not, performs forced stop of operation.
+	 */
+
+	~ChipCompareTimerLowLevel() override;
+
+	/**
+	 * \brief Generates "compare match" event by software.
+	 *
+	 * CompareTimerBase::compareMatchEvent() will be executed from interrupt context as soon as possible.
+	 *
+	 * \note This function can be used from interrupt context.
+	 */
+
+	void generateEvent() override;
+
+	/**
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \return current value of counter
+	 */
+
+	uint32_t getCounter() const override;
+
+	/**
+	 * \brief Interrupt handler
+	 *
+	 * \note this must not be called by user code
+	 */
+
+	void interruptHandler();
+
+	/**
+	 * \brief Sets the value of compare channel.
+	 *
+	 * When the counter reaches \a value, CompareTimerBase::compareMatchEvent() will be executed. If \a value was
+	 * already passed, the event will not be generated before the counter wraps. Previously set value is overwritten.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] value is the new value of compare channel
+	 */
+
+	void setCompare(uint32_t value) override;
+
+	/**
+	 * \brief Starts low-level driver of hardware timer.
+	 *
+	 * The counter is reset to 0 and starts counting with frequency of timer's clock divided by prescaler.
+	 *
+	 * \param [in] compareTimerBase is a reference to CompareTimerBase object that will be associated with this one
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and frequency of counter, Hz; error codes:
+	 * - EBADF - the driver is not stopped;
+	 * - EINVAL - prescaler is not in [1; 65536] range;
+	 */
+
+	std::pair<int, uint32_t> start(devices::CompareTimerBase& compareTimerBase) override;
+
+	/**
+	 * \brief Stops low-level driver of hardware timer.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - the driver is not started;
+	 */
+
+	int stop() override;
+
+private:
+
+	/**
+	 * \return reference to TIM_TypeDef object
+	 */
+
+	TIM_TypeDef& getTim() const
+	{
+		return *reinterpret_cast<TIM_TypeDef*>(timBase_);
+	}
+
+	/// pointer to CompareTimerBase object associated with this one, nullptr if the driver is stopped
+	devices::CompareTimerBase* compareTimerBase_;
+
+	/// base address of TIM peripheral
+	uintptr_t timBase_;
+
+	/// value by which the clock of the timer is divided
+	uint32_t prescaler_;
+};
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// SOURCE_CHIP_STM32_PERIPHERALS_TIMV1_INCLUDE_DISTORTOS_CHIP_CHIPCOMPARETIMERLOWLEVEL_HPP_
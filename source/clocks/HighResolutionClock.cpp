@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief HighResolutionClock class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/HighResolutionClock.hpp"
+
+#include "distortos/architecture/getTickTimerCounter.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+HighResolutionClock::time_point HighResolutionClock::now()
+{
+	const auto& scheduler = internal::getScheduler();
+	uint64_t tickCount;
+	architecture::TickTimerCounter counter;
+	// retry if tick interrupt was handled between reads of tick count and counter of tick timer
+	do
+	{
+		tickCount = scheduler.getTickCount();
+		counter = architecture::getTickTimerCounter();
+	} while (tickCount != scheduler.getTickCount());
+
+	if (counter.pendingTick == true)
+		++tickCount;
+
+	// both parts are rounded down separately, so the sum never exceeds the value for the start of next tick
+	const auto ticks = std::chrono::duration_cast<duration>(TickClock::duration{tickCount});
+	const auto subtick = duration{static_cast<rep>(uint64_t{counter.elapsed} * std::nano::den /
+			(uint64_t{DISTORTOS_TICK_FREQUENCY} * counter.period))};
+	return time_point{ticks + subtick};
+}
+
+}	// namespace distortos
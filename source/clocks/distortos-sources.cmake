@@ -8,4 +8,5 @@
 #
 
 target_sources(distortos PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/HighResolutionClock.cpp
 		${CMAKE_CURRENT_LIST_DIR}/TickClock.cpp)
@@ -0,0 +1,77 @@
+/**
+ * \file
+ * \brief CoroutineFramePool class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/CoroutineFramePool.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+CoroutineFramePool::CoroutineFramePool(void* const storage, const size_t storageSize, const size_t blockSize) :
+		freeList_{},
+		blockSize_{(std::max(blockSize, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) /
+				alignof(std::max_align_t) * alignof(std::max_align_t)},
+		capacity_{storageSize / blockSize_},
+		freeBlocks_{capacity_}
+{
+	// link blocks in reverse order, so that the first allocation returns the first block of storage
+	for (size_t i {capacity_}; i != 0; --i)
+	{
+		const auto freeBlock = reinterpret_cast<FreeBlock*>(static_cast<uint8_t*>(storage) + (i - 1) * blockSize_);
+		freeBlock->next = freeList_;
+		freeList_ = freeBlock;
+	}
+}
+
+void* CoroutineFramePool::allocate(const size_t size)
+{
+	if (size > blockSize_)
+		return {};
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto freeBlock = freeList_;
+	if (freeBlock == nullptr)
+		return {};
+
+	freeList_ = freeBlock->next;
+	--freeBlocks_;
+	return freeBlock;
+}
+
+void CoroutineFramePool::deallocate(void* const block)
+{
+	if (block == nullptr)
+		return;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto freeBlock = static_cast<FreeBlock*>(block);
+	freeBlock->next = freeList_;
+	freeList_ = freeBlock;
+	++freeBlocks_;
+}
+
+size_t CoroutineFramePool::getFreeBlocks() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return freeBlocks_;
+}
+
+}	// namespace distortos
@@ -19,6 +19,14 @@
 
 #endif	// !def DISTORTOS_UNIT_TEST
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/internal/memory/allocateFromMemoryRegions.hpp"
+
+#include "distortos/memoryRegions.hpp"
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 #include <mutex>
 
 #include <cassert>
@@ -34,9 +42,42 @@ namespace devices
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+BufferingBlockDevice::BufferingBlockDevice(BlockDevice& blockDevice, const size_t readBufferSize,
+		const size_t writeBufferSize, const MemoryCapabilities capabilities) :
+				readBufferAddress_{},
+				writeBufferAddress_{},
+				blockDevice_{blockDevice},
+				readBuffer_{internal::allocateFromMemoryRegions(capabilities, readBufferSize,
+						DISTORTOS_BLOCKDEVICE_BUFFER_ALIGNMENT)},
+				readBufferSize_{readBufferSize},
+				writeBuffer_{internal::allocateFromMemoryRegions(capabilities, writeBufferSize,
+						DISTORTOS_BLOCKDEVICE_BUFFER_ALIGNMENT)},
+				writeBufferSize_{writeBufferSize},
+				writeBufferValidSize_{},
+				ownsBuffers_{true},
+				openCount_{},
+				readBufferValid_{}
+{
+
+}
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 BufferingBlockDevice::~BufferingBlockDevice()
 {
 	assert(openCount_ == 0);
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+	if (ownsBuffers_ == true)
+	{
+		memoryRegions::deallocate(readBuffer_);
+		memoryRegions::deallocate(writeBuffer_);
+	}
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
 }
 
 int BufferingBlockDevice::close()
@@ -42,6 +42,7 @@ target_sources(distortos PRIVATE
 doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR}/fatalErrorHandler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/C-API
 		${CMAKE_CURRENT_LIST_DIR}/clocks
+		${CMAKE_CURRENT_LIST_DIR}/coroutines
 		${CMAKE_CURRENT_LIST_DIR}/devices
 		${CMAKE_CURRENT_LIST_DIR}/FileSystem
 		${CMAKE_CURRENT_LIST_DIR}/gcc
@@ -53,6 +54,7 @@ doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR}/fatalErrorHandler.cpp
 
 include(${CMAKE_CURRENT_LIST_DIR}/C-API/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/clocks/distortos-sources.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/coroutines/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/devices/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/FileSystem/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/gcc/distortos-sources.cmake)
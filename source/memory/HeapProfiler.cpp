@@ -0,0 +1,194 @@
+/**
+ * \file
+ * \brief HeapProfiler class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/HeapProfiler.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Calculates "home" index of pointer in hash table.
+ *
+ * \param [in] pointer is the hashed pointer
+ * \param [in] size is the size of hash table, must not be 0
+ *
+ * \return "home" index of \a pointer in hash table
+ */
+
+size_t getHashIndex(const void* const pointer, const size_t size)
+{
+	// Fibonacci hashing, three least significant bits are skipped as they are usually zero due to alignment
+	return static_cast<uint32_t>((reinterpret_cast<uintptr_t>(pointer) >> 3) * UINT32_C(2654435761)) % size;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void HeapProfiler::recordAllocation(const void* const memory, const size_t size, const void* const caller,
+		const void* const thread, const uint64_t timestamp)
+{
+	pushEvent({timestamp, caller, memory, thread, size, HeapProfilerEvent::Type::allocation});
+
+	const auto callSite = findOrAddCallSite(caller);
+	if (callSite != nullptr)
+		++callSite->allocations;
+
+	const auto index = findTrackedBlock(memory);
+	if (callSite == nullptr || index == trackedBlocks_.size())
+	{
+		++untrackedAllocations_;
+		return;
+	}
+
+	trackedBlocks_[index] = {memory, callSite, size};
+	++callSite->liveBlocks;
+	callSite->liveSize += size;
+	callSite->peakLiveSize = std::max(callSite->peakLiveSize, callSite->liveSize);
+}
+
+void HeapProfiler::recordDeallocation(const void* const memory, const size_t size, const void* const caller,
+		const void* const thread, const uint64_t timestamp)
+{
+	pushEvent({timestamp, caller, memory, thread, size, HeapProfilerEvent::Type::deallocation});
+
+	const auto index = findTrackedBlock(memory);
+	if (index == trackedBlocks_.size() || trackedBlocks_[index].memory == nullptr)	// block is not tracked?
+		return;
+
+	const auto& trackedBlock = trackedBlocks_[index];
+	--trackedBlock.callSite->liveBlocks;
+	trackedBlock.callSite->liveSize -= trackedBlock.size;
+	removeTrackedBlock(index);
+}
+
+HeapProfilerSnapshot HeapProfiler::takeSnapshot(const EventsRange events, const CallSitesRange callSites) const
+{
+	const auto capacity = events_.size();
+	const auto availableEvents = std::min(recordedEvents_, capacity);
+	const auto copiedEvents = std::min(availableEvents, events.size());
+	for (size_t i {}; i < copiedEvents; ++i)
+		events[i] = events_[(nextEvent_ + capacity - copiedEvents + i) % capacity];
+
+	size_t copiedCallSites {};
+	for (const auto& callSite : callSites_)
+	{
+		if (copiedCallSites == callSites.size())
+			break;
+
+		if (callSite.caller != nullptr)
+			callSites[copiedCallSites++] = callSite;
+	}
+
+	return {copiedCallSites, copiedEvents, recordedEvents_ - availableEvents, untrackedAllocations_};
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+HeapProfilerCallSite* HeapProfiler::findOrAddCallSite(const void* const caller)
+{
+	const auto size = callSites_.size();
+	if (size == 0)
+		return {};
+
+	auto index = getHashIndex(caller, size);
+	for (size_t i {}; i < size; ++i)
+	{
+		auto& callSite = callSites_[index];
+		if (callSite.caller == caller)
+			return &callSite;
+
+		if (callSite.caller == nullptr)
+		{
+			callSite = {caller, {}, {}, {}, {}};
+			return &callSite;
+		}
+
+		index = (index + 1) % size;
+	}
+
+	return {};
+}
+
+size_t HeapProfiler::findTrackedBlock(const void* const memory) const
+{
+	const auto size = trackedBlocks_.size();
+	if (size == 0)
+		return size;
+
+	auto index = getHashIndex(memory, size);
+	for (size_t i {}; i < size; ++i)
+	{
+		const auto trackedMemory = trackedBlocks_[index].memory;
+		if (trackedMemory == memory || trackedMemory == nullptr)
+			return index;
+
+		index = (index + 1) % size;
+	}
+
+	return size;
+}
+
+void HeapProfiler::pushEvent(const HeapProfilerEvent& event)
+{
+	const auto capacity = events_.size();
+	if (capacity == 0)
+		return;
+
+	events_[nextEvent_] = event;
+	nextEvent_ = (nextEvent_ + 1) % capacity;
+	++recordedEvents_;
+}
+
+void HeapProfiler::removeTrackedBlock(const size_t index)
+{
+	const auto size = trackedBlocks_.size();
+	auto hole = index;
+	auto next = index;
+	for (size_t i {1}; i < size; ++i)
+	{
+		next = (next + 1) % size;
+		const auto memory = trackedBlocks_[next].memory;
+		if (memory == nullptr)
+			break;
+
+		// entry may be moved to the hole only if its "home" index is not cyclically in (hole; next]
+		const auto home = getHashIndex(memory, size);
+		const auto homeInRange = hole <= next ? hole < home && home <= next : hole < home || home <= next;
+		if (homeInRange == true)
+			continue;
+
+		trackedBlocks_[hole] = trackedBlocks_[next];
+		hole = next;
+	}
+
+	trackedBlocks_[hole] = {};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
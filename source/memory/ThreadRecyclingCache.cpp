@@ -0,0 +1,193 @@
+/**
+ * \file
+ * \brief ThreadRecyclingCache class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/ThreadRecyclingCache.hpp"
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/internal/memory/allocateFromMemoryRegions.hpp"
+
+#include "distortos/memoryRegions.hpp"
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include <new>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Allocates block of memory.
+ *
+ * \param [in] size is the size of block of memory, bytes
+ * \param [in] capabilities are the required capabilities of memory region, relevant only if memory regions are enabled
+ * \param [in] noThrow selects whether failure of allocation is reported by returning nullptr (true) or is a fatal
+ * error (false)
+ *
+ * \return pointer to allocated block of memory, nullptr if allocation failed and \a noThrow is true
+ */
+
+uint8_t* allocateBlock(const size_t size, const MemoryCapabilities capabilities, const bool noThrow)
+{
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+	if (noThrow == true)
+		return static_cast<uint8_t*>(memoryRegions::allocate(capabilities, size));
+
+	return static_cast<uint8_t*>(allocateFromMemoryRegions(capabilities, size));
+
+#else	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
+
+	static_cast<void>(capabilities);
+
+	if (noThrow == true)
+		return new (std::nothrow) uint8_t[size];
+
+	return new uint8_t[size];
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
+}
+
+/**
+ * \brief Deallocates block of memory allocated with allocateBlock().
+ *
+ * \param [in] block is a pointer to block of memory
+ */
+
+void deallocateBlock(void* const block)
+{
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+	memoryRegions::deallocate(block);
+#else	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
+	delete[] static_cast<uint8_t*>(block);
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* ThreadRecyclingCache::allocate(const size_t size, const MemoryCapabilities capabilities)
+{
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		// blocks are searched while interrupts are masked, but the cache is small, so this is short
+		for (auto previous = &list_; *previous != nullptr; previous = &(*previous)->next)
+		{
+			const auto header = *previous;
+			if (header->size != size || header->capabilities != capabilities)
+				continue;
+
+			*previous = header->next;
+			--size_;
+			++hitCount_;
+			return reinterpret_cast<uint8_t*>(header) + headerSize;
+		}
+
+		++missCount_;
+	}
+
+	auto block = allocateBlock(headerSize + size, capabilities, true);
+	if (block == nullptr)
+	{
+		trim();
+		block = allocateBlock(headerSize + size, capabilities, false);
+	}
+
+	const auto header = new (block) Header{nullptr, size, capabilities};
+	return reinterpret_cast<uint8_t*>(header) + headerSize;
+}
+
+void ThreadRecyclingCache::deallocate(void* const pointer)
+{
+	const auto header = reinterpret_cast<Header*>(static_cast<uint8_t*>(pointer) - headerSize);
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		if (size_ < maxSize_)
+		{
+			header->next = list_;
+			list_ = header;
+			++size_;
+			return;
+		}
+	}
+
+	deallocateBlock(header);
+}
+
+size_t ThreadRecyclingCache::getHitCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return hitCount_;
+}
+
+size_t ThreadRecyclingCache::getMissCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return missCount_;
+}
+
+size_t ThreadRecyclingCache::getSize() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return size_;
+}
+
+size_t ThreadRecyclingCache::trim()
+{
+	Header* list;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		list = list_;
+		list_ = {};
+		size_ = {};
+	}
+
+	size_t count {};
+	while (list != nullptr)
+	{
+		const auto header = list;
+		list = header->next;
+		deallocateBlock(header);
+		++count;
+	}
+
+	return count;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
@@ -0,0 +1,394 @@
+/**
+ * \file
+ * \brief TlsfHeap class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \param [in] value is a value which will be aligned
+ * \param [in] alignment is the alignment, must be a power of 2
+ *
+ * \return \a value rounded up to a multiple of \a alignment
+ */
+
+constexpr size_t alignUp(const size_t value, const size_t alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * \param [in] value is a value which will be checked, must not be 0
+ *
+ * \return index of the least significant bit which is set in \a value
+ */
+
+size_t findFirstSet(const uint32_t value)
+{
+	return __builtin_ctz(value);
+}
+
+/**
+ * \param [in] value is a value which will be checked, must not be 0
+ *
+ * \return index of the most significant bit which is set in \a value
+ */
+
+size_t findLastSet(const size_t value)
+{
+	return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* TlsfHeap::allocate(const size_t size)
+{
+	if (size > maxBlockSize)
+		return {};
+
+	const auto adjustedSize = std::max(alignUp(size, alignment), minBlockSize);
+	const auto block = findFreeBlock(adjustedSize);
+	if (block == nullptr)
+		return {};
+
+	split(*block, adjustedSize);
+	return markUsed(*block);
+}
+
+void* TlsfHeap::allocateAligned(const size_t requiredAlignment, const size_t size)
+{
+	if (requiredAlignment == 0 || (requiredAlignment & (requiredAlignment - 1)) != 0)
+		return {};
+
+	if (requiredAlignment <= alignment)
+		return allocate(size);
+
+	// gap in front of aligned memory must be either 0 or large enough to form a free block
+	constexpr auto minGap = blockOverhead + minBlockSize;
+	if (size > maxBlockSize - requiredAlignment - minGap)
+		return {};
+
+	const auto adjustedSize = std::max(alignUp(size, alignment), minBlockSize);
+	const auto block = findFreeBlock(adjustedSize + requiredAlignment + minGap);
+	if (block == nullptr)
+		return {};
+
+	const auto memory = reinterpret_cast<uintptr_t>(getMemory(*block));
+	auto alignedMemory = alignUp(memory, requiredAlignment);
+	if (alignedMemory != memory && alignedMemory - memory < minGap)
+		alignedMemory = alignUp(memory + minGap, requiredAlignment);
+
+	auto alignedBlock = block;
+	const auto gap = alignedMemory - memory;
+	if (gap != 0)
+	{
+		// front part of the block becomes a free block, flags of original block are preserved
+		alignedBlock = &getBlock(reinterpret_cast<void*>(alignedMemory));
+		alignedBlock->previousPhysical = block;
+		alignedBlock->size = (getSize(*block) - gap) | previousFreeFlag;
+		getNextPhysical(*alignedBlock).previousPhysical = alignedBlock;
+		setSize(*block, gap - blockOverhead);
+		block->size |= freeFlag;
+		insertFreeBlock(*block);
+	}
+
+	split(*alignedBlock, adjustedSize);
+	return markUsed(*alignedBlock);
+}
+
+void TlsfHeap::deallocate(void* const pointer)
+{
+	if (pointer == nullptr)
+		return;
+
+	auto block = &getBlock(pointer);
+	--usedBlocks_;
+	usedSize_ -= getSize(*block);
+
+	if ((block->size & previousFreeFlag) != 0 &&
+			getSize(*block->previousPhysical) + blockOverhead + getSize(*block) <= maxBlockSize)
+	{
+		const auto previous = block->previousPhysical;
+		removeFreeBlock(*previous);
+		setSize(*previous, getSize(*previous) + blockOverhead + getSize(*block));
+		block = previous;
+	}
+
+	auto& next = getNextPhysical(*block);
+	if ((next.size & freeFlag) != 0 && getSize(*block) + blockOverhead + getSize(next) <= maxBlockSize)
+	{
+		removeFreeBlock(next);
+		setSize(*block, getSize(*block) + blockOverhead + getSize(next));
+	}
+
+	block->size |= freeFlag;
+	auto& newNext = getNextPhysical(*block);
+	newNext.previousPhysical = block;
+	newNext.size |= previousFreeFlag;
+	insertFreeBlock(*block);
+}
+
+HeapStatistics TlsfHeap::getStatistics() const
+{
+	size_t largestFreeBlockSize {};
+	if (firstLevelBitmap_ != 0)
+	{
+		// the largest free block is on the last non-empty list, but blocks on this list may differ in size
+		const auto firstLevelIndex = findLastSet(firstLevelBitmap_);
+		const auto secondLevelIndex = findLastSet(secondLevelBitmaps_[firstLevelIndex]);
+		for (auto block = freeLists_[firstLevelIndex][secondLevelIndex]; block != nullptr; block = block->nextFree)
+			largestFreeBlockSize = std::max(largestFreeBlockSize, getSize(*block));
+	}
+
+	return {freeBlocks_, freeSize_, largestFreeBlockSize, totalSize_, usedBlocks_, usedSize_};
+}
+
+int TlsfHeap::initialize(void* const storage, const size_t size)
+{
+	const auto storageBegin = reinterpret_cast<uintptr_t>(storage);
+	const auto storageEnd = storageBegin + size;
+	// first block is placed so that its memory is aligned, last block is a sentinel with size 0
+	const auto begin = alignUp(storageBegin + blockOverhead, alignment) - blockOverhead;
+	if (storageEnd < begin + 2 * blockOverhead + minBlockSize)
+		return EINVAL;
+
+	auto remainingSize = (storageEnd - begin - 2 * blockOverhead) & ~(alignment - 1);
+	if (remainingSize < minBlockSize)
+		return EINVAL;
+
+	totalSize_ = remainingSize + 2 * blockOverhead;
+
+	// heap larger than max size of block is split into several free blocks
+	auto block = reinterpret_cast<Block*>(begin);
+	block->previousPhysical = {};
+	block->size = freeFlag;
+	while (1)
+	{
+		auto blockSize = remainingSize;
+		if (blockSize > maxBlockSize)
+		{
+			blockSize = maxBlockSize;
+			if (remainingSize - blockSize < blockOverhead + minBlockSize)
+				blockSize = remainingSize - blockOverhead - minBlockSize;
+		}
+
+		setSize(*block, blockSize);
+		insertFreeBlock(*block);
+		remainingSize -= blockSize;
+		if (remainingSize == 0)
+			break;
+
+		remainingSize -= blockOverhead;
+		const auto next = &getNextPhysical(*block);
+		next->previousPhysical = block;
+		next->size = freeFlag | previousFreeFlag;
+		block = next;
+	}
+
+	auto& sentinel = getNextPhysical(*block);
+	sentinel.previousPhysical = block;
+	sentinel.size = previousFreeFlag;
+	return 0;
+}
+
+void* TlsfHeap::reallocate(void* const pointer, const size_t size)
+{
+	if (pointer == nullptr)
+		return allocate(size);
+
+	if (size == 0)
+	{
+		deallocate(pointer);
+		return {};
+	}
+
+	if (size > maxBlockSize)
+		return {};
+
+	auto& block = getBlock(pointer);
+	const auto blockSize = getSize(block);
+	const auto adjustedSize = std::max(alignUp(size, alignment), minBlockSize);
+	auto& next = getNextPhysical(block);
+	const auto nextFree = (next.size & freeFlag) != 0;
+	if (adjustedSize <= blockSize || (nextFree == true && blockSize + blockOverhead + getSize(next) >= adjustedSize))
+	{
+		// block is resized in place
+		if (adjustedSize > blockSize)
+		{
+			removeFreeBlock(next);
+			setSize(block, blockSize + blockOverhead + getSize(next));
+			auto& newNext = getNextPhysical(block);
+			newNext.previousPhysical = &block;
+			newNext.size &= ~previousFreeFlag;
+		}
+
+		split(block, adjustedSize);
+		usedSize_ = usedSize_ - blockSize + getSize(block);
+		return pointer;
+	}
+
+	const auto newPointer = allocate(size);
+	if (newPointer == nullptr)
+		return {};
+
+	memcpy(newPointer, pointer, blockSize);
+	deallocate(pointer);
+	return newPointer;
+}
+
+size_t TlsfHeap::getUsableSize(const void* const pointer)
+{
+	return getSize(getBlock(pointer));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TlsfHeap::Block* TlsfHeap::findFreeBlock(size_t size)
+{
+	// size is rounded up to the next list, so that any block from the found list is large enough
+	if (size >= (size_t{1} << firstLevelIndexShift))
+		size += (size_t{1} << (findLastSet(size) - secondLevelIndexLog2)) - 1;
+
+	size_t firstLevelIndex;
+	size_t secondLevelIndex;
+	std::tie(firstLevelIndex, secondLevelIndex) = map(size);
+	if (firstLevelIndex >= firstLevelIndexCount)
+		return {};
+
+	auto secondLevelBitmap = secondLevelBitmaps_[firstLevelIndex] & (~uint32_t{} << secondLevelIndex);
+	if (secondLevelBitmap == 0)
+	{
+		const auto firstLevelBitmap = firstLevelBitmap_ & (~uint32_t{} << (firstLevelIndex + 1));
+		if (firstLevelBitmap == 0)
+			return {};
+
+		firstLevelIndex = findFirstSet(firstLevelBitmap);
+		secondLevelBitmap = secondLevelBitmaps_[firstLevelIndex];
+	}
+
+	const auto block = freeLists_[firstLevelIndex][findFirstSet(secondLevelBitmap)];
+	removeFreeBlock(*block);
+	return block;
+}
+
+void TlsfHeap::insertFreeBlock(Block& block)
+{
+	size_t firstLevelIndex;
+	size_t secondLevelIndex;
+	std::tie(firstLevelIndex, secondLevelIndex) = map(getSize(block));
+
+	auto& head = freeLists_[firstLevelIndex][secondLevelIndex];
+	block.previousFree = {};
+	block.nextFree = head;
+	if (head != nullptr)
+		head->previousFree = &block;
+	head = &block;
+
+	firstLevelBitmap_ |= uint32_t{1} << firstLevelIndex;
+	secondLevelBitmaps_[firstLevelIndex] |= uint32_t{1} << secondLevelIndex;
+	++freeBlocks_;
+	freeSize_ += getSize(block);
+}
+
+void* TlsfHeap::markUsed(Block& block)
+{
+	block.size &= ~freeFlag;
+	getNextPhysical(block).size &= ~previousFreeFlag;
+	++usedBlocks_;
+	usedSize_ += getSize(block);
+	return getMemory(block);
+}
+
+void TlsfHeap::removeFreeBlock(Block& block)
+{
+	size_t firstLevelIndex;
+	size_t secondLevelIndex;
+	std::tie(firstLevelIndex, secondLevelIndex) = map(getSize(block));
+
+	if (block.nextFree != nullptr)
+		block.nextFree->previousFree = block.previousFree;
+	if (block.previousFree != nullptr)
+		block.previousFree->nextFree = block.nextFree;
+	else
+	{
+		freeLists_[firstLevelIndex][secondLevelIndex] = block.nextFree;
+		if (block.nextFree == nullptr)
+		{
+			secondLevelBitmaps_[firstLevelIndex] &= ~(uint32_t{1} << secondLevelIndex);
+			if (secondLevelBitmaps_[firstLevelIndex] == 0)
+				firstLevelBitmap_ &= ~(uint32_t{1} << firstLevelIndex);
+		}
+	}
+
+	--freeBlocks_;
+	freeSize_ -= getSize(block);
+}
+
+void TlsfHeap::split(Block& block, const size_t size)
+{
+	const auto blockSize = getSize(block);
+	if (blockSize < size + blockOverhead + minBlockSize)
+		return;
+
+	setSize(block, size);
+	auto& remainder = getNextPhysical(block);
+	remainder.previousPhysical = &block;
+	remainder.size = (blockSize - size - blockOverhead) | freeFlag;
+
+	auto& next = getNextPhysical(remainder);
+	if ((next.size & freeFlag) != 0 && getSize(remainder) + blockOverhead + getSize(next) <= maxBlockSize)
+	{
+		removeFreeBlock(next);
+		setSize(remainder, getSize(remainder) + blockOverhead + getSize(next));
+	}
+
+	auto& newNext = getNextPhysical(remainder);
+	newNext.previousPhysical = &remainder;
+	newNext.size |= previousFreeFlag;
+	insertFreeBlock(remainder);
+}
+
+std::pair<size_t, size_t> TlsfHeap::map(const size_t size)
+{
+	if (size < (size_t{1} << firstLevelIndexShift))
+		return {0, size / alignment};
+
+	const auto log2Size = findLastSet(size);
+	return {log2Size - firstLevelIndexShift + 1,
+			(size >> (log2Size - secondLevelIndexLog2)) ^ (size_t{1} << secondLevelIndexLog2)};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -9,4 +9,13 @@
 
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/DeferredThreadDeleter.cpp
-		${CMAKE_CURRENT_LIST_DIR}/getDeferredThreadDeleter.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/getDeferredThreadDeleter.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getHeapProfiler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getThreadRecyclingCache.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getTlsfHeap.cpp
+		${CMAKE_CURRENT_LIST_DIR}/HeapProfiler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/heapProfiler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/memoryRegions.cpp
+		${CMAKE_CURRENT_LIST_DIR}/profiledOperatorNew.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadRecyclingCache.cpp
+		${CMAKE_CURRENT_LIST_DIR}/TlsfHeap.cpp)
@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief getHeapProfiler() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/getHeapProfiler.hpp"
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#include "distortos/internal/memory/HeapProfiler.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for hash table of call sites of main instance of HeapProfiler
+HeapProfilerCallSite callSites[DISTORTOS_HEAP_PROFILER_CALL_SITES];
+
+/// storage for ring buffer of events of main instance of HeapProfiler
+HeapProfilerEvent events[DISTORTOS_HEAP_PROFILER_EVENTS];
+
+/// storage for hash table of live blocks of main instance of HeapProfiler
+HeapProfiler::TrackedBlock trackedBlocks[DISTORTOS_HEAP_PROFILER_TRACKED_BLOCKS];
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of HeapProfiler
+HeapProfiler heapProfilerInstance {HeapProfiler::EventsRange{events}, HeapProfiler::CallSitesRange{callSites},
+		HeapProfiler::TrackedBlocksRange{trackedBlocks}};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
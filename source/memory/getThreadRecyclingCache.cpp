@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief getThreadRecyclingCache() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/getThreadRecyclingCache.hpp"
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+
+#include "distortos/internal/memory/ThreadRecyclingCache.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of ThreadRecyclingCache
+ThreadRecyclingCache threadRecyclingCacheInstance {DISTORTOS_THREAD_RECYCLING_CACHE_SIZE};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief getTlsfHeap() definition and low-level initializer of main instance of TlsfHeap
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Low-level initializer of main instance of TlsfHeap
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER(). Whole
+ * area between __heap_start and __heap_end symbols from linker script is given to the heap.
+ */
+
+void tlsfHeapLowLevelInitializer()
+{
+	extern char __heap_start[];	// imported from linker script
+	extern char __heap_end[];	// imported from linker script
+
+	getTlsfHeap().initialize(__heap_start, __heap_end - __heap_start);
+}
+
+BIND_LOW_LEVEL_INITIALIZER(0, tlsfHeapLowLevelInitializer);
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of TlsfHeap
+TlsfHeap tlsfHeapInstance;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief heapProfiler namespace implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/heapProfiler.hpp"
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#include "distortos/internal/memory/getHeapProfiler.hpp"
+#include "distortos/internal/memory/HeapProfiler.hpp"
+#include "distortos/internal/memory/TlsfHeapLock.hpp"
+
+namespace distortos
+{
+
+namespace heapProfiler
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void clearEvents()
+{
+	const internal::TlsfHeapLock tlsfHeapLock;
+	internal::getHeapProfiler().clearEvents();
+}
+
+HeapProfilerSnapshot takeSnapshot(const estd::ContiguousRange<HeapProfilerEvent> events,
+		const estd::ContiguousRange<HeapProfilerCallSite> callSites)
+{
+	const internal::TlsfHeapLock tlsfHeapLock;
+	return internal::getHeapProfiler().takeSnapshot(events, callSites);
+}
+
+}	// namespace heapProfiler
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
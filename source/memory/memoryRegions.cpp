@@ -0,0 +1,162 @@
+/**
+ * \file
+ * \brief Implementation of functions for allocation from memory regions
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/memoryRegions.hpp"
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#include "distortos/internal/memory/allocateFromMemoryRegions.hpp"
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+#include "distortos/internal/memory/MemoryRegion.hpp"
+#include "distortos/internal/memory/TlsfHeap.hpp"
+#include "distortos/internal/memory/TlsfHeapLock.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/FATAL_ERROR.h"
+
+#include <cassert>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tries to allocate memory from matching regions, either the one with main heap or all other ones.
+ *
+ * \pre Heaps are locked.
+ *
+ * \param [in] capabilities are the required capabilities, MemoryCapabilities::none matches any region
+ * \param [in] size is the size of memory, bytes
+ * \param [in] alignment is the required alignment of memory, must be a power of 2
+ * \param [in] mainHeap selects whether only the region with main heap (true) or only all other regions (false) will be
+ * tried
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise
+ */
+
+void* tryAllocate(const MemoryCapabilities capabilities, const size_t size, const size_t alignment,
+		const bool mainHeap)
+{
+	for (auto& region : internal::getMemoryRegions())
+	{
+		if ((&region.getHeap() == &internal::getTlsfHeap()) != mainHeap)
+			continue;
+		if ((region.getCapabilities() & capabilities) != capabilities)
+			continue;
+
+		const auto memory = region.getHeap().allocateAligned(alignment, size);
+		if (memory != nullptr)
+			return memory;
+	}
+
+	return {};
+}
+
+/**
+ * \brief Low-level initializer of memory regions
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER(). Heaps of
+ * all regions - except the one with main heap, which is initialized separately - are initialized.
+ */
+
+void memoryRegionsLowLevelInitializer()
+{
+	for (auto& region : internal::getMemoryRegions())
+		if (&region.getHeap() != &internal::getTlsfHeap())
+			region.getHeap().initialize(region.getBegin(), region.getEnd() - region.getBegin());
+}
+
+BIND_LOW_LEVEL_INITIALIZER(0, memoryRegionsLowLevelInitializer);
+
+}	// namespace
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* allocateFromMemoryRegions(const MemoryCapabilities capabilities, const size_t size, const size_t alignment)
+{
+	const auto memory = memoryRegions::allocate(capabilities, size, alignment);
+	if (memory == nullptr)
+		FATAL_ERROR("Allocation from memory regions failed!");
+
+	return memory;
+}
+
+}	// namespace internal
+
+namespace memoryRegions
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* allocate(const MemoryCapabilities capabilities, const size_t size, const size_t alignment)
+{
+	const internal::TlsfHeapLock tlsfHeapLock;
+
+	const auto memory = tryAllocate(capabilities, size, alignment, true);
+	if (memory != nullptr)
+		return memory;
+
+	return tryAllocate(capabilities, size, alignment, false);
+}
+
+void deallocate(void* const memory)
+{
+	if (memory == nullptr)
+		return;
+
+	for (auto& region : internal::getMemoryRegions())
+		if (region.contains(memory) == true)
+		{
+			const internal::TlsfHeapLock tlsfHeapLock;
+			region.getHeap().deallocate(memory);
+			return;
+		}
+
+	FATAL_ERROR("Memory is not in any region!");
+}
+
+MemoryCapabilities getCapabilities(const size_t index)
+{
+	const auto regions = internal::getMemoryRegions();
+	assert(index < regions.size());
+	return regions[index].getCapabilities();
+}
+
+size_t getCount()
+{
+	return internal::getMemoryRegions().size();
+}
+
+const char* getName(const size_t index)
+{
+	const auto regions = internal::getMemoryRegions();
+	assert(index < regions.size());
+	return regions[index].getName();
+}
+
+}	// namespace memoryRegions
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
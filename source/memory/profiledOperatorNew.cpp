@@ -0,0 +1,192 @@
+/**
+ * \file
+ * \brief Replacements of global operator new and operator delete used with heap profiler
+ *
+ * libstdc++'s operator new calls malloc(), so return address seen by heap profiler would always point into libstdc++.
+ * These replacements pass return address of their own caller to heap profiler.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/profiledMalloc.hpp"
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#include <new>
+
+#include <cstdlib>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Allocates memory for operator new.
+ *
+ * Allocation is retried as long as new-handler is installed, just like in libstdc++.
+ *
+ * \param [in] size is the size of memory, bytes
+ * \param [in] caller is the return address of the function which called operator new
+ * \param [in] noThrow selects whether failure of allocation is reported by returning nullptr (true) or by calling
+ * abort() (false)
+ *
+ * \return pointer to allocated memory, nullptr if allocation failed and \a noThrow is true
+ */
+
+void* allocate(const size_t size, const void* const caller, const bool noThrow)
+{
+	while (1)
+	{
+		const auto memory = distortos::internal::profiledMalloc(size != 0 ? size : 1, caller);
+		if (memory != nullptr)
+			return memory;
+
+		const auto newHandler = std::get_new_handler();
+		if (newHandler == nullptr)
+		{
+			if (noThrow == true)
+				return {};
+
+			abort();
+		}
+
+		newHandler();
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Replacement of global operator new, which passes return address of its caller to heap profiler.
+ *
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory
+ */
+
+void* operator new(const size_t size)
+{
+	return allocate(size, __builtin_return_address(0), false);
+}
+
+/**
+ * \brief Replacement of global operator new, which passes return address of its caller to heap profiler.
+ *
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory, nullptr if allocation failed
+ */
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size, __builtin_return_address(0), true);
+}
+
+/**
+ * \brief Replacement of global operator new[], which passes return address of its caller to heap profiler.
+ *
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory
+ */
+
+void* operator new[](const size_t size)
+{
+	return allocate(size, __builtin_return_address(0), false);
+}
+
+/**
+ * \brief Replacement of global operator new[], which passes return address of its caller to heap profiler.
+ *
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory, nullptr if allocation failed
+ */
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size, __builtin_return_address(0), true);
+}
+
+/**
+ * \brief Replacement of global operator delete, which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void operator delete(void* const memory) noexcept
+{
+	distortos::internal::profiledFree(memory, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of global operator delete, which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void operator delete(void* const memory, const std::nothrow_t&) noexcept
+{
+	distortos::internal::profiledFree(memory, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of global operator delete[], which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void operator delete[](void* const memory) noexcept
+{
+	distortos::internal::profiledFree(memory, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of global operator delete[], which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void operator delete[](void* const memory, const std::nothrow_t&) noexcept
+{
+	distortos::internal::profiledFree(memory, __builtin_return_address(0));
+}
+
+#ifdef __cpp_sized_deallocation
+
+/**
+ * \brief Replacement of global sized operator delete, which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void operator delete(void* const memory, size_t) noexcept
+{
+	distortos::internal::profiledFree(memory, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of global sized operator delete[], which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void operator delete[](void* const memory, size_t) noexcept
+{
+	distortos::internal::profiledFree(memory, __builtin_return_address(0));
+}
+
+#endif	// def __cpp_sized_deallocation
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
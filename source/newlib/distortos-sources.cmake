@@ -14,6 +14,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/isatty_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/locking.cpp
 		${CMAKE_CURRENT_LIST_DIR}/lseek_r.cpp
+		${CMAKE_CURRENT_LIST_DIR}/malloc_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/open_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/read_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/sbrk_r.cpp
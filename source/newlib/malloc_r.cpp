@@ -0,0 +1,486 @@
+/**
+ * \file
+ * \brief _malloc_r(), _free_r(), _realloc_r(), _calloc_r(), _memalign_r(), _malloc_usable_size_r() and _mallinfo_r()
+ * implementation using TLSF heap, optionally recorded by heap profiler
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+#include "distortos/internal/memory/TlsfHeap.hpp"
+#include "distortos/internal/memory/TlsfHeapLock.hpp"
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#include "distortos/internal/memory/getHeapProfiler.hpp"
+#include "distortos/internal/memory/HeapProfiler.hpp"
+#include "distortos/internal/memory/profiledMalloc.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/isInInterruptContext.hpp"
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+#include <malloc.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+/**
+ * \return pointer to current thread, nullptr if called from interrupt or before initialization of scheduler
+ */
+
+const void* getCurrentThread()
+{
+	const auto& scheduler = getScheduler();
+	if (architecture::isInInterruptContext() == true || scheduler.isInitialized() == false)
+		return {};
+
+	return &scheduler.getCurrentThreadControlBlock().getOwner();
+}
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+/**
+ * \brief Records allocation of block of memory in heap profiler.
+ *
+ * \pre TLSF heap is locked.
+ *
+ * \param [in] memory is a pointer to allocated block of memory, nullptr is ignored
+ * \param [in] caller is the return address of the function which called allocation function
+ */
+
+void recordAllocation(const void* const memory, const void* const caller)
+{
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+	if (memory == nullptr)
+		return;
+
+	getHeapProfiler().recordAllocation(memory, TlsfHeap::getUsableSize(memory), caller, getCurrentThread(),
+			getScheduler().getTickCount());
+
+#else	// DISTORTOS_HEAP_PROFILER_ENABLE != 1
+
+	static_cast<void>(memory);
+	static_cast<void>(caller);
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE != 1
+}
+
+/**
+ * \brief Records deallocation of block of memory in heap profiler.
+ *
+ * \pre TLSF heap is locked.
+ *
+ * \param [in] memory is a pointer to block of memory which will be deallocated, nullptr is ignored, must be called
+ * before the block is actually deallocated
+ * \param [in] caller is the return address of the function which called deallocation function
+ */
+
+void recordDeallocation(const void* const memory, const void* const caller)
+{
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+	if (memory == nullptr)
+		return;
+
+	getHeapProfiler().recordDeallocation(memory, TlsfHeap::getUsableSize(memory), caller, getCurrentThread(),
+			getScheduler().getTickCount());
+
+#else	// DISTORTOS_HEAP_PROFILER_ENABLE != 1
+
+	static_cast<void>(memory);
+	static_cast<void>(caller);
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE != 1
+}
+
+/**
+ * \brief Implementation of _calloc_r() and calloc()
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread, its errno is set on failure
+ * \param [in] count is the number of elements
+ * \param [in] size is the size of each element, bytes
+ * \param [in] caller is the return address of the function which called allocation function
+ *
+ * \return pointer to allocated and zero-initialized memory on success, nullptr otherwise (errno in \a reent is set to
+ * ENOMEM)
+ */
+
+void* callocImplementation(_reent* const reent, const size_t count, const size_t size, const void* const caller)
+{
+	const auto totalSize = count * size;
+	if (size != 0 && totalSize / size != count)
+	{
+		reent->_errno = ENOMEM;
+		return {};
+	}
+
+	void* memory;
+
+	{
+		const TlsfHeapLock tlsfHeapLock;
+		memory = getTlsfHeap().allocate(totalSize);
+		recordAllocation(memory, caller);
+	}
+
+	if (memory == nullptr)
+	{
+		reent->_errno = ENOMEM;
+		return {};
+	}
+
+	memset(memory, 0, totalSize);
+	return memory;
+}
+
+/**
+ * \brief Implementation of _free_r() and free()
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ * \param [in] caller is the return address of the function which called deallocation function
+ */
+
+void freeImplementation(void* const memory, const void* const caller)
+{
+	const TlsfHeapLock tlsfHeapLock;
+	recordDeallocation(memory, caller);
+	getTlsfHeap().deallocate(memory);
+}
+
+/**
+ * \brief Implementation of _malloc_r() and malloc()
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread, its errno is set on failure
+ * \param [in] size is the size of memory, bytes
+ * \param [in] caller is the return address of the function which called allocation function
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise (errno in \a reent is set to ENOMEM)
+ */
+
+void* mallocImplementation(_reent* const reent, const size_t size, const void* const caller)
+{
+	void* memory;
+
+	{
+		const TlsfHeapLock tlsfHeapLock;
+		memory = getTlsfHeap().allocate(size);
+		recordAllocation(memory, caller);
+	}
+
+	if (memory == nullptr)
+		reent->_errno = ENOMEM;
+
+	return memory;
+}
+
+/**
+ * \brief Implementation of _memalign_r() and memalign()
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread, its errno is set on failure
+ * \param [in] alignment is the required alignment of memory, must be a power of 2
+ * \param [in] size is the size of memory, bytes
+ * \param [in] caller is the return address of the function which called allocation function
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise (errno in \a reent is set to ENOMEM)
+ */
+
+void* memalignImplementation(_reent* const reent, const size_t alignment, const size_t size, const void* const caller)
+{
+	void* memory;
+
+	{
+		const TlsfHeapLock tlsfHeapLock;
+		memory = getTlsfHeap().allocateAligned(alignment, size);
+		recordAllocation(memory, caller);
+	}
+
+	if (memory == nullptr)
+		reent->_errno = ENOMEM;
+
+	return memory;
+}
+
+/**
+ * \brief Implementation of _realloc_r() and realloc()
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread, its errno is set on failure
+ * \param [in] memory is a pointer to memory which will be reallocated, nullptr to allocate new memory
+ * \param [in] size is the new size of memory, bytes, 0 to deallocate \a memory
+ * \param [in] caller is the return address of the function which called reallocation function
+ *
+ * \return pointer to reallocated memory on success, nullptr otherwise (errno in \a reent is set to ENOMEM and
+ * \a memory is left intact)
+ */
+
+void* reallocImplementation(_reent* const reent, void* const memory, const size_t size, const void* const caller)
+{
+	void* newMemory;
+
+	{
+		const TlsfHeapLock tlsfHeapLock;
+		// old block is no longer valid after successful reallocation, so its deallocation is recorded before
+		recordDeallocation(memory, caller);
+		newMemory = getTlsfHeap().reallocate(memory, size);
+		// if reallocation failed, old block is left intact and is recorded as allocated again
+		recordAllocation(newMemory == nullptr && size != 0 ? memory : newMemory, caller);
+	}
+
+	if (newMemory == nullptr && size != 0)
+		reent->_errno = ENOMEM;
+
+	return newMemory;
+}
+
+}	// namespace
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void profiledFree(void* const memory, const void* const caller)
+{
+	freeImplementation(memory, caller);
+}
+
+void* profiledMalloc(const size_t size, const void* const caller)
+{
+	return mallocImplementation(_REENT, size, caller);
+}
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Allocates zero-initialized memory for an array.
+ *
+ * See [calloc()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/calloc.html)
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread
+ * \param [in] count is the number of elements
+ * \param [in] size is the size of each element, bytes
+ *
+ * \return pointer to allocated and zero-initialized memory on success, nullptr otherwise (errno is set to ENOMEM)
+ */
+
+void* _calloc_r(_reent* const reent, const size_t count, const size_t size)
+{
+	return callocImplementation(reent, count, size, __builtin_return_address(0));
+}
+
+/**
+ * \brief Deallocates memory.
+ *
+ * See [free()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/free.html)
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void _free_r(_reent*, void* const memory)
+{
+	freeImplementation(memory, __builtin_return_address(0));
+}
+
+/**
+ * \return snapshot of usage of heap - only `arena`, `ordblks`, `uordblks` and `fordblks` fields are filled
+ */
+
+struct mallinfo _mallinfo_r(_reent*)
+{
+	HeapStatistics heapStatistics;
+
+	{
+		const TlsfHeapLock tlsfHeapLock;
+		heapStatistics = getTlsfHeap().getStatistics();
+	}
+
+	struct mallinfo mallinfoStruct {};
+	mallinfoStruct.arena = heapStatistics.totalSize;
+	mallinfoStruct.ordblks = heapStatistics.freeBlocks;
+	mallinfoStruct.uordblks = heapStatistics.usedSize;
+	mallinfoStruct.fordblks = heapStatistics.freeSize;
+	return mallinfoStruct;
+}
+
+/**
+ * \brief Allocates memory.
+ *
+ * See [malloc()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/malloc.html)
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise (errno is set to ENOMEM)
+ */
+
+void* _malloc_r(_reent* const reent, const size_t size)
+{
+	return mallocImplementation(reent, size, __builtin_return_address(0));
+}
+
+/**
+ * \param [in] memory is a pointer to memory returned by one of allocation functions, must not be nullptr
+ *
+ * \return number of usable bytes in block of memory pointed by \a memory
+ */
+
+size_t _malloc_usable_size_r(_reent*, void* const memory)
+{
+	return TlsfHeap::getUsableSize(memory);
+}
+
+/**
+ * \brief Allocates aligned memory.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread
+ * \param [in] alignment is the required alignment of memory, must be a power of 2
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise (errno is set to ENOMEM)
+ */
+
+void* _memalign_r(_reent* const reent, const size_t alignment, const size_t size)
+{
+	return memalignImplementation(reent, alignment, size, __builtin_return_address(0));
+}
+
+/**
+ * \brief Reallocates memory.
+ *
+ * See [realloc()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/realloc.html)
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure of calling thread
+ * \param [in] memory is a pointer to memory which will be reallocated, nullptr to allocate new memory
+ * \param [in] size is the new size of memory, bytes, 0 to deallocate \a memory
+ *
+ * \return pointer to reallocated memory on success, nullptr otherwise (errno is set to ENOMEM and \a memory is left
+ * intact)
+ */
+
+void* _realloc_r(_reent* const reent, void* const memory, const size_t size)
+{
+	return reallocImplementation(reent, memory, size, __builtin_return_address(0));
+}
+
+#if DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions replacing newlib's wrappers
++---------------------------------------------------------------------------------------------------------------------*/
+
+/*
+ * newlib's calloc(), free(), malloc(), memalign() and realloc() just call their reentrant variants, so return address
+ * seen by the reentrant variant would always point into newlib. These replacements pass return address of their own
+ * caller to heap profiler.
+ */
+
+/**
+ * \brief Replacement of newlib's calloc(), which passes return address of its caller to heap profiler.
+ *
+ * \param [in] count is the number of elements
+ * \param [in] size is the size of each element, bytes
+ *
+ * \return pointer to allocated and zero-initialized memory on success, nullptr otherwise (errno is set to ENOMEM)
+ */
+
+void* calloc(const size_t count, const size_t size)
+{
+	return callocImplementation(_REENT, count, size, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of newlib's free(), which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void free(void* const memory)
+{
+	freeImplementation(memory, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of newlib's malloc(), which passes return address of its caller to heap profiler.
+ *
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise (errno is set to ENOMEM)
+ */
+
+void* malloc(const size_t size)
+{
+	return mallocImplementation(_REENT, size, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of newlib's memalign(), which passes return address of its caller to heap profiler.
+ *
+ * \param [in] alignment is the required alignment of memory, must be a power of 2
+ * \param [in] size is the size of memory, bytes
+ *
+ * \return pointer to allocated memory on success, nullptr otherwise (errno is set to ENOMEM)
+ */
+
+void* memalign(const size_t alignment, const size_t size)
+{
+	return memalignImplementation(_REENT, alignment, size, __builtin_return_address(0));
+}
+
+/**
+ * \brief Replacement of newlib's realloc(), which passes return address of its caller to heap profiler.
+ *
+ * \param [in] memory is a pointer to memory which will be reallocated, nullptr to allocate new memory
+ * \param [in] size is the new size of memory, bytes, 0 to deallocate \a memory
+ *
+ * \return pointer to reallocated memory on success, nullptr otherwise (errno is set to ENOMEM and \a memory is left
+ * intact)
+ */
+
+void* realloc(void* const memory, const size_t size)
+{
+	return reallocImplementation(_REENT, memory, size, __builtin_return_address(0));
+}
+
+#endif	// DISTORTOS_HEAP_PROFILER_ENABLE == 1
+
+}	// extern "C"
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
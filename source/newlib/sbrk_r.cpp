@@ -9,6 +9,8 @@
  * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "distortos/distortosConfiguration.h"
+
 #include <cerrno>
 #include <cstdint>
 
@@ -23,7 +25,7 @@ extern "C"
  * \brief Increase program data space.
  *
  * This version of _sbrk_r() requires the heap area to be defined explicitly in linker script with symbols __heap_start
- * and __heap_end.
+ * and __heap_end. If TLSF heap is enabled, whole heap area is managed by it, so _sbrk_r() always fails.
  *
  * \param [in] size is the requested data space size
  *
@@ -32,6 +34,14 @@ extern "C"
 
 void* _sbrk_r(_reent*, const intptr_t size)
 {
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+	static_cast<void>(size);
+	errno = ENOMEM;
+	return reinterpret_cast<void*>(-1);
+
+#else	// DISTORTOS_TLSF_HEAP_ENABLE != 1
+
 	extern char __heap_start[];						// imported from linker script
 	extern char __heap_end[];						// imported from linker script
 	static auto currentHeapEnd_ = __heap_start;
@@ -46,6 +56,8 @@ void* _sbrk_r(_reent*, const intptr_t size)
 	currentHeapEnd_ += size;
 
 	return previousHeapEnd;
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE != 1
 }
 
 }	// extern "C"
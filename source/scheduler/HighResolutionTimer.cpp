@@ -0,0 +1,70 @@
+/**
+ * \file
+ * \brief HighResolutionTimer class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/HighResolutionTimer.hpp"
+
+#include "distortos/HighResolutionTimerSupervisor.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+HighResolutionTimer::~HighResolutionTimer()
+{
+	stop();
+}
+
+HighResolutionTimer::time_point HighResolutionTimer::getTimePoint() const
+{
+	return time_point{supervisor_.ticksToDuration(getDeadline())};
+}
+
+int HighResolutionTimer::start(const duration delay)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (supervisor_.getFrequency() == 0)
+		return EBADF;
+
+	node.unlink();
+	setDeadline(supervisor_.getCounter() + supervisor_.durationToTicks(delay));
+	supervisor_.add(*this);
+	return 0;
+}
+
+int HighResolutionTimer::start(const time_point timePoint)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (supervisor_.getFrequency() == 0)
+		return EBADF;
+
+	node.unlink();
+	setDeadline(supervisor_.durationToTicks(timePoint.time_since_epoch()));
+	supervisor_.add(*this);
+	return 0;
+}
+
+int HighResolutionTimer::stop()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	node.unlink();
+	return 0;
+}
+
+}	// namespace distortos
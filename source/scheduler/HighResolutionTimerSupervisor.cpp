@@ -0,0 +1,164 @@
+/**
+ * \file
+ * \brief HighResolutionTimerSupervisor class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/HighResolutionTimerSupervisor.hpp"
+
+#include "distortos/devices/timers/CompareTimerLowLevel.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max distance between consecutive reads of the counter of hardware timer which guarantees detection of its wrap-around
+constexpr uint64_t maxCompareDistance {UINT64_C(1) << 31};
+
+/// number of nanoseconds in one second
+constexpr uint64_t nanosecondsPerSecond {std::nano::den};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+HighResolutionTimerSupervisor::~HighResolutionTimerSupervisor()
+{
+	if (frequency_ != 0)
+		compareTimerLowLevel_.stop();
+}
+
+HighResolutionTimerSupervisor::time_point HighResolutionTimerSupervisor::now() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return time_point{ticksToDuration(getCounter())};
+}
+
+int HighResolutionTimerSupervisor::start()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (frequency_ != 0)
+		return EBADF;
+
+	const auto ret = compareTimerLowLevel_.start(*this);
+	if (ret.first != 0)
+		return ret.first;
+
+	frequency_ = ret.second;
+	counter_ = compareTimerLowLevel_.getCounter();
+	programCompare();
+	return 0;
+}
+
+int HighResolutionTimerSupervisor::stop()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (frequency_ == 0)
+		return EBADF;
+
+	if (timersList_.empty() == false)
+		return EBUSY;
+
+	const auto ret = compareTimerLowLevel_.stop();
+	if (ret != 0)
+		return ret;
+
+	frequency_ = {};
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void HighResolutionTimerSupervisor::add(HighResolutionTimer& timer)
+{
+	timersList_.insert(timer);
+
+	// compare channel needs to be reprogrammed only if the new timer is the first one to expire
+	if (&*timersList_.begin() == &timer)
+		programCompare();
+}
+
+void HighResolutionTimerSupervisor::compareMatchEvent()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (frequency_ == 0)
+		return;
+
+	// execute all timers that reached their deadlines
+	const auto counter = getCounter();
+	decltype(timersList_.begin()) iterator;
+	while (iterator = timersList_.begin(), iterator != timersList_.end() && iterator->getDeadline() <= counter)
+	{
+		auto& timer = *iterator;
+		internal::HighResolutionTimerList::erase(iterator);
+		timer.run();
+	}
+
+	programCompare();
+}
+
+uint64_t HighResolutionTimerSupervisor::durationToTicks(const duration value) const
+{
+	if (value.count() <= 0)
+		return {};
+
+	// split into seconds and remainder to avoid overflow of intermediate results
+	const auto nanoseconds = static_cast<uint64_t>(value.count());
+	const auto seconds = nanoseconds / nanosecondsPerSecond;
+	const auto remainder = nanoseconds % nanosecondsPerSecond;
+	return seconds * frequency_ + (remainder * frequency_ + nanosecondsPerSecond - 1) / nanosecondsPerSecond;
+}
+
+uint64_t HighResolutionTimerSupervisor::getCounter() const
+{
+	const auto counter = compareTimerLowLevel_.getCounter();
+	counter_ += static_cast<uint32_t>(counter - static_cast<uint32_t>(counter_));
+	return counter_;
+}
+
+void HighResolutionTimerSupervisor::programCompare()
+{
+	auto compare = getCounter() + maxCompareDistance;
+	if (timersList_.empty() == false)
+		compare = std::min(compare, timersList_.begin()->getDeadline());
+
+	compareTimerLowLevel_.setCompare(static_cast<uint32_t>(compare));
+
+	// the match was missed if the counter passed the compare value before the compare channel was programmed
+	if (getCounter() >= compare)
+		compareTimerLowLevel_.generateEvent();
+}
+
+HighResolutionTimerSupervisor::duration HighResolutionTimerSupervisor::ticksToDuration(const uint64_t ticks) const
+{
+	// split into seconds and remainder to avoid overflow of intermediate results
+	const auto seconds = ticks / frequency_;
+	const auto remainder = ticks % frequency_;
+	return duration{static_cast<rep>(seconds * nanosecondsPerSecond + remainder * nanosecondsPerSecond / frequency_)};
+}
+
+}	// namespace distortos
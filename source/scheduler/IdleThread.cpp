@@ -12,6 +12,9 @@
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
 
+#include "distortos/internal/scheduler/getStackMonitor.hpp"
+#include "distortos/internal/scheduler/StackMonitor.hpp"
+
 #include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
 #include "distortos/StaticThread.hpp"
 
@@ -30,11 +33,18 @@ void idleThreadFunction();
 | local objects
 +---------------------------------------------------------------------------------------------------------------------*/
 
+/// additional size of idle thread's stack needed by stack monitor - stackUsageWarningHook() is called from idle thread
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+constexpr size_t stackMonitorStackSize {256};
+#else	// DISTORTOS_STACK_MONITOR_ENABLE != 1
+constexpr size_t stackMonitorStackSize {};
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE != 1
+
 /// size of idle thread's stack, bytes
 #ifdef DISTORTOS_THREAD_DETACH_ENABLE
-constexpr size_t idleThreadStackSize {320};
+constexpr size_t idleThreadStackSize {320 + stackMonitorStackSize};
 #else	// !def DISTORTOS_THREAD_DETACH_ENABLE
-constexpr size_t idleThreadStackSize {128};
+constexpr size_t idleThreadStackSize {128 + stackMonitorStackSize};
 #endif	// !def DISTORTOS_THREAD_DETACH_ENABLE
 
 /// type of idle thread
@@ -64,6 +74,12 @@ void idleThreadFunction()
 		getDeferredThreadDeleter().tryCleanup();	/// \todo error handling?
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+		getStackMonitor().step();
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
 	}
 }
 
@@ -14,6 +14,9 @@
 #include "distortos/architecture/requestContextSwitch.hpp"
 
 #include "distortos/internal/scheduler/forceContextSwitch.hpp"
+#include "distortos/internal/scheduler/getStackMonitor.hpp"
+#include "distortos/internal/scheduler/recordTraceEvent.hpp"
+#include "distortos/internal/scheduler/StackMonitor.hpp"
 
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
@@ -22,6 +25,7 @@
 
 #include "distortos/FATAL_ERROR.h"
 
+#include <atomic>
 #include <cerrno>
 
 namespace distortos
@@ -122,27 +126,7 @@ int Scheduler::block(ThreadList& container, const ThreadState state, const Unblo
 int Scheduler::block(ThreadList& container, const ThreadList::iterator iterator, const ThreadState state,
 		const UnblockFunctor* const unblockFunctor)
 {
-	UnblockReason unblockReason {};
-	const UnblockReasonUnblockFunctorWrapper unblockReasonUnblockFunctorWrapper {unblockFunctor, unblockReason};
-	const auto blockingCurrentThread = iterator == currentThreadControlBlock_;
-
-	{
-		const InterruptMaskingLock interruptMaskingLock;
-
-		// if blocking current thread, use unblockReasonUnblockFunctorWrapper, otherwise use provided unblockFunctor
-		const auto ret = blockInternal(container, iterator, state, blockingCurrentThread == true ?
-				&unblockReasonUnblockFunctorWrapper : unblockFunctor);
-		if (ret != 0)
-			return ret;
-
-		if (blockingCurrentThread == false)	// blocked thread is not current thread - no forced switch required
-			return 0;
-	}
-
-	forceContextSwitch();
-
-	return unblockReason == UnblockReason::unblockRequest ? 0 :
-			unblockReason == UnblockReason::timeout ? ETIMEDOUT : EINTR;
+	return blockImplementation(container, iterator, state, unblockFunctor);
 }
 
 int Scheduler::blockUntil(ThreadList& container, const ThreadState state, const TickClock::time_point timePoint,
@@ -150,30 +134,29 @@ int Scheduler::blockUntil(ThreadList& container, const ThreadState state, const
 {
 	CHECK_FUNCTION_CONTEXT();
 
-	const InterruptMaskingLock interruptMaskingLock;
+	return blockUntilImplementation(container, state, timePoint, unblockFunctor);
+}
 
-	const auto iterator = currentThreadControlBlock_;
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
 
-	if (timePoint <= TickClock::now())
-	{
-		if (unblockFunctor != nullptr)
-			(*unblockFunctor)(*iterator, UnblockReason::timeout);
-		return ETIMEDOUT;
-	}
+int Scheduler::block(ThreadPriorityQueue& container, const ThreadState state,
+		const UnblockFunctor* const unblockFunctor)
+{
+	CHECK_FUNCTION_CONTEXT();
 
-	// This lambda unblocks the thread only if it wasn't already unblocked - this is necessary because double unblock
-	// should be avoided (it could mess the order of threads of the same priority). In that case it also sets
-	// UnblockReason::timeout.
-	auto softwareTimer = makeStaticSoftwareTimer([this, iterator]()
-			{
-				if (iterator->getList() != &runnableList_)
-					unblockInternal(iterator, UnblockReason::timeout);
-			});
-	softwareTimer.start(timePoint);
+	return blockImplementation(container, currentThreadControlBlock_, state, unblockFunctor);
+}
+
+int Scheduler::blockUntil(ThreadPriorityQueue& container, const ThreadState state,
+		const TickClock::time_point timePoint, const UnblockFunctor* const unblockFunctor)
+{
+	CHECK_FUNCTION_CONTEXT();
 
-	return block(container, state, unblockFunctor);
+	return blockUntilImplementation(container, state, timePoint, unblockFunctor);
 }
 
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
 uint64_t Scheduler::getContextSwitchCount() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -182,8 +165,17 @@ uint64_t Scheduler::getContextSwitchCount() const
 
 uint64_t Scheduler::getTickCount() const
 {
-	const InterruptMaskingLock interruptMaskingLock;
-	return tickCount_;
+	uint32_t sequence;
+	uint64_t tickCount;
+	do
+	{
+		sequence = tickCountSequence_;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		tickCount = tickCounts_[sequence % 2];
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	} while (sequence != tickCountSequence_);	// retry only if tick interrupt preempted the read
+
+	return tickCount;
 }
 
 int Scheduler::initialize(ThreadControlBlock& mainThreadControlBlock)
@@ -212,7 +204,7 @@ int Scheduler::remove()
 	if (ret != 0)
 		return ret;
 
-	currentThreadControlBlock_->setList(nullptr);
+	currentThreadControlBlock_->setList(static_cast<ThreadList*>(nullptr));
 
 	return 0;
 }
@@ -254,6 +246,8 @@ void* Scheduler::switchContext(void* const stackPointer)
 #endif	// def DISTORTOS_CHECK_STACK_GUARD_CONTEXT_SWITCH_ENABLE
 
 	stack.setStackPointer(stackPointer);
+	recordTraceEvent(TraceRecord::Type::threadSwitch, &runnableList_.begin()->getOwner(),
+			runnableList_.begin()->getEffectivePriority());
 	currentThreadControlBlock_ = runnableList_.begin();
 	getCurrentThreadControlBlock().switchedToHook();
 	return getCurrentThreadControlBlock().getStack().getStackPointer();
@@ -270,7 +264,16 @@ bool Scheduler::tickInterruptHandler()
 
 #endif	// def DISTORTOS_CHECK_STACK_GUARD_SYSTEM_TICK_ENABLE
 
-	++tickCount_;
+	// "latch" variant of sequence lock - while one copy of tick count is modified, readers use the other one, so they
+	// never wait for completion of the update, even if they preempted tick interrupt
+	const auto tickCount = tickCounts_[0] + 1;
+	++tickCountSequence_;	// odd - readers use tickCounts_[1]
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	tickCounts_[0] = tickCount;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	++tickCountSequence_;	// even - readers use tickCounts_[0]
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	tickCounts_[1] = tickCount;
 
 	getCurrentThreadControlBlock().getRoundRobinQuantum().decrement();
 
@@ -285,7 +288,7 @@ bool Scheduler::tickInterruptHandler()
 		runnableList_.splice(currentThreadControlBlock_);
 	}
 
-	softwareTimerSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount_}});
+	softwareTimerSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount}});
 
 	return isContextSwitchRequired();
 }
@@ -320,10 +323,44 @@ int Scheduler::addInternal(ThreadControlBlock& threadControlBlock)
 	threadControlBlock.setList(&runnableList_);
 	threadControlBlock.setState(ThreadState::runnable);
 
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	getStackMonitor().add(threadControlBlock);
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
 	return 0;
 }
 
-int Scheduler::blockInternal(ThreadList& container, const ThreadList::iterator iterator, const ThreadState state,
+template<typename Container>
+int Scheduler::blockImplementation(Container& container, const ThreadList::iterator iterator, const ThreadState state,
+		const UnblockFunctor* const unblockFunctor)
+{
+	UnblockReason unblockReason {};
+	const UnblockReasonUnblockFunctorWrapper unblockReasonUnblockFunctorWrapper {unblockFunctor, unblockReason};
+	const auto blockingCurrentThread = iterator == currentThreadControlBlock_;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		// if blocking current thread, use unblockReasonUnblockFunctorWrapper, otherwise use provided unblockFunctor
+		const auto ret = blockInternal(container, iterator, state, blockingCurrentThread == true ?
+				&unblockReasonUnblockFunctorWrapper : unblockFunctor);
+		if (ret != 0)
+			return ret;
+
+		if (blockingCurrentThread == false)	// blocked thread is not current thread - no forced switch required
+			return 0;
+	}
+
+	forceContextSwitch();
+
+	return unblockReason == UnblockReason::unblockRequest ? 0 :
+			unblockReason == UnblockReason::timeout ? ETIMEDOUT : EINTR;
+}
+
+template<typename Container>
+int Scheduler::blockInternal(Container& container, const ThreadList::iterator iterator, const ThreadState state,
 		const UnblockFunctor* const unblockFunctor)
 {
 	auto& threadControlBlock = *iterator;
@@ -335,10 +372,40 @@ int Scheduler::blockInternal(ThreadList& container, const ThreadList::iterator i
 	threadControlBlock.setList(&container);
 	threadControlBlock.setState(state);
 	threadControlBlock.blockHook(unblockFunctor);
+	recordTraceEvent(TraceRecord::Type::threadBlock, &threadControlBlock.getOwner(), static_cast<uint32_t>(state));
 
 	return 0;
 }
 
+template<typename Container>
+int Scheduler::blockUntilImplementation(Container& container, const ThreadState state,
+		const TickClock::time_point timePoint, const UnblockFunctor* const unblockFunctor)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto iterator = currentThreadControlBlock_;
+
+	if (timePoint <= TickClock::now())
+	{
+		if (unblockFunctor != nullptr)
+			(*unblockFunctor)(*iterator, UnblockReason::timeout);
+		return ETIMEDOUT;
+	}
+
+	// This lambda unblocks the thread only if it wasn't already unblocked - this is necessary because double unblock
+	// should be avoided (it could mess the order of threads of the same priority). In that case it also sets
+	// UnblockReason::timeout.
+	auto softwareTimer = makeStaticSoftwareTimer([this, iterator]()
+			{
+				if (iterator->getList() != &runnableList_)
+					unblockInternal(iterator, UnblockReason::timeout);
+			});
+	softwareTimer.setSlack(iterator->getTimerSlack());
+	softwareTimer.start(timePoint);
+
+	return blockImplementation(container, iterator, state, unblockFunctor);
+}
+
 bool Scheduler::isContextSwitchRequired() const
 {
 	if (getCurrentThreadControlBlock().getList() != &runnableList_)
@@ -357,6 +424,8 @@ void Scheduler::unblockInternal(const ThreadList::iterator iterator, const Unblo
 	threadControlBlock.setList(&runnableList_);
 	threadControlBlock.setState(ThreadState::runnable);
 	threadControlBlock.unblockHook(unblockReason);
+	recordTraceEvent(TraceRecord::Type::threadUnblock, &threadControlBlock.getOwner(),
+			static_cast<uint32_t>(unblockReason));
 }
 
 }	// namespace internal
@@ -26,11 +26,39 @@ SoftwareTimerCommon::~SoftwareTimerCommon()
 
 }
 
+TickClock::duration SoftwareTimerCommon::getSlack() const
+{
+	return softwareTimerControlBlock_.getSlack();
+}
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+bool SoftwareTimerCommon::isDeferred() const
+{
+	return softwareTimerControlBlock_.isDeferred();
+}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 bool SoftwareTimerCommon::isRunning() const
 {
 	return softwareTimerControlBlock_.isRunning();
 }
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+void SoftwareTimerCommon::setDeferred(const bool deferred)
+{
+	softwareTimerControlBlock_.setDeferred(deferred);
+}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+void SoftwareTimerCommon::setSlack(const TickClock::duration slack)
+{
+	softwareTimerControlBlock_.setSlack(slack);
+}
+
 int SoftwareTimerCommon::start(const TickClock::time_point timePoint, const TickClock::duration period)
 {
 	softwareTimerControlBlock_.start(internal::getScheduler().getSoftwareTimerSupervisor(), timePoint, period);
@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerControlBlock class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,7 +12,9 @@
 #include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/getSoftwareTimerDaemon.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerDaemon.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
 
@@ -30,6 +32,13 @@ void SoftwareTimerControlBlock::run(SoftwareTimerSupervisor& supervisor)
 {
 	functionRunner_(owner_);
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	// function may be executed by SoftwareTimerDaemon with interrupts unmasked
+	const InterruptMaskingLock interruptMaskingLock;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 	// was timer restarted in timer's function or is this a one-shot timer?
 	if (node.isLinked() == true || period_ == decltype(period_){})
 		return;
@@ -37,6 +46,13 @@ void SoftwareTimerControlBlock::run(SoftwareTimerSupervisor& supervisor)
 	startInternal(supervisor, getTimePoint() + period_);	// this is a periodic timer, so restart it
 }
 
+void SoftwareTimerControlBlock::setSlack(const TickClock::duration slack)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	slack_ = slack > decltype(slack){} ? slack : decltype(slack){};
+}
+
 void SoftwareTimerControlBlock::start(SoftwareTimerSupervisor& supervisor, const TickClock::time_point timePoint,
 		const TickClock::duration period)
 {
@@ -49,19 +65,36 @@ void SoftwareTimerControlBlock::start(SoftwareTimerSupervisor& supervisor, const
 
 void SoftwareTimerControlBlock::stop()
 {
-	const InterruptMaskingLock interruptMaskingLock;
+	{
+		const InterruptMaskingLock interruptMaskingLock;
 
-	stopInternal();
+		stopInternal();
+	}
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	getSoftwareTimerDaemon().waitForExecution(*this);
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+bool SoftwareTimerControlBlock::isExecutedByDaemon() const
+{
+	return getSoftwareTimerDaemon().isExecuting(*this);
+}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 void SoftwareTimerControlBlock::startInternal(SoftwareTimerSupervisor& supervisor,
 		const TickClock::time_point timePoint)
 {
-	setTimePoint(timePoint);
+	setTimePoint(timePoint, slack_);
 	supervisor.add(*this);
 }
 
@@ -0,0 +1,169 @@
+/**
+ * \file
+ * \brief SoftwareTimerDaemon class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/SoftwareTimerDaemon.hpp"
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/getSoftwareTimerDaemon.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/isInInterruptContext.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/StaticThread.hpp"
+
+#include <mutex>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+void softwareTimerDaemonThreadFunction();
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of daemon thread
+using SoftwareTimerDaemonThread = decltype(makeStaticThread<DISTORTOS_SOFTWARE_TIMER_DAEMON_STACK_SIZE>(
+		DISTORTOS_SOFTWARE_TIMER_DAEMON_PRIORITY, SchedulingPolicy::fifo, softwareTimerDaemonThreadFunction));
+
+/// storage for daemon thread instance
+std::aligned_storage<sizeof(SoftwareTimerDaemonThread), alignof(SoftwareTimerDaemonThread)>::type
+		softwareTimerDaemonThreadStorage;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Daemon thread's function
+ */
+
+void softwareTimerDaemonThreadFunction()
+{
+	getSoftwareTimerDaemon().run();
+}
+
+/**
+ * \brief Low-level initializer of daemon thread
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void softwareTimerDaemonLowLevelInitializer()
+{
+	auto& softwareTimerDaemonThread = *new (&softwareTimerDaemonThreadStorage) SoftwareTimerDaemonThread
+			{DISTORTOS_SOFTWARE_TIMER_DAEMON_PRIORITY, SchedulingPolicy::fifo, softwareTimerDaemonThreadFunction};
+	softwareTimerDaemonThread.start();
+}
+
+BIND_LOW_LEVEL_INITIALIZER(20, softwareTimerDaemonLowLevelInitializer);
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerDaemon::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	softwareTimerControlBlock.setExpiryTimePoint(HighResolutionClock::now());
+	readyList_.push_back(softwareTimerControlBlock);
+	semaphore_.post();	// may fail with EOVERFLOW if the daemon was already woken, which is not a problem
+}
+
+uint64_t SoftwareTimerDaemon::getExecutionCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return executionCount_;
+}
+
+HighResolutionClock::duration SoftwareTimerDaemon::getMaxQueueingDelay() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return maxQueueingDelay_;
+}
+
+HighResolutionClock::duration SoftwareTimerDaemon::getTotalQueueingDelay() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return totalQueueingDelay_;
+}
+
+void SoftwareTimerDaemon::run()
+{
+	auto& scheduler = getScheduler();
+	auto& supervisor = scheduler.getSoftwareTimerSupervisor();
+	threadControlBlock_ = &scheduler.getCurrentThreadControlBlock();
+
+	while (1)
+	{
+		semaphore_.wait();
+
+		while (1)
+		{
+			const std::lock_guard<Mutex> lockGuard {executionMutex_};
+			SoftwareTimerControlBlock* softwareTimerControlBlock;
+
+			{
+				const InterruptMaskingLock interruptMaskingLock;
+
+				if (readyList_.empty() == true)
+					break;
+
+				softwareTimerControlBlock = &readyList_.front();
+				readyList_.pop_front();
+
+				const auto queueingDelay = HighResolutionClock::now() - softwareTimerControlBlock->getExpiryTimePoint();
+				++executionCount_;
+				if (queueingDelay > maxQueueingDelay_)
+					maxQueueingDelay_ = queueingDelay;
+				totalQueueingDelay_ += queueingDelay;
+
+				// mark the timer before interrupts are unmasked, so that it cannot be stopped unnoticed
+				executedSoftwareTimerControlBlock_ = softwareTimerControlBlock;
+			}
+
+			softwareTimerControlBlock->run(supervisor);
+			executedSoftwareTimerControlBlock_ = {};
+		}
+	}
+}
+
+void SoftwareTimerDaemon::waitForExecution(const SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	if (isExecuting(softwareTimerControlBlock) == false)
+		return;
+
+	// daemon cannot wait for itself and interrupt handlers cannot wait at all
+	if (architecture::isInInterruptContext() == true ||
+			&getScheduler().getCurrentThreadControlBlock() == threadControlBlock_)
+		return;
+
+	// execution mutex is released by the daemon only after execution of timer's function is finished
+	executionMutex_.lock();
+	executionMutex_.unlock();
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
@@ -11,7 +11,10 @@
 
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
+#include "distortos/internal/scheduler/getSoftwareTimerDaemon.hpp"
+#include "distortos/internal/scheduler/recordTraceEvent.hpp"
 #include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerDaemon.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
 
@@ -30,14 +33,46 @@ void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerContro
 	activeList_.insert(softwareTimerControlBlock);
 }
 
+uint64_t SoftwareTimerSupervisor::getExecutionCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return executionCount_;
+}
+
+uint64_t SoftwareTimerSupervisor::getExpiryTickCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return expiryTickCount_;
+}
+
 void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
 {
-	// execute all software timers that reached their time point
+	recordTraceEvent(TraceRecord::Type::tick, {}, static_cast<uint32_t>(timePoint.time_since_epoch().count()));
+
+	// list is sorted by latest time points, so no software timer must be executed yet if the first one can wait
+	if (activeList_.empty() == true || activeList_.begin()->getLatestTimePoint() > timePoint)
+		return;
+
+	++expiryTickCount_;
+
+	// execute all software timers from the front of the list that reached their time point
 	decltype(activeList_.begin()) iterator;
 	while (iterator = activeList_.begin(), iterator != activeList_.end() && iterator->getTimePoint() <= timePoint)
 	{
 		auto& softwareTimer = *iterator;
 		SoftwareTimerList::erase(iterator);
+		++executionCount_;
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+		if (softwareTimer.isDeferred() == true)
+		{
+			getSoftwareTimerDaemon().add(softwareTimer);
+			continue;
+		}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
 		softwareTimer.run(*this);
 	}
 }
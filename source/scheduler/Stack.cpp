@@ -40,6 +40,13 @@ constexpr size_t stackAlignment {DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT};
 /// sentinel used for stack usage/overflow detection
 constexpr uint32_t stackSentinel {0xed419f25};
 
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+/// number of elements of stack which are filled or scanned in one step of lazy painting or incremental scan
+constexpr size_t stackMonitorChunkLength {16};
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions' declarations
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -86,7 +93,14 @@ Stack::Stack(StorageUniquePointer&& storageUniquePointer, const size_t size) :
 		storageUniquePointer_{std::move(storageUniquePointer)},
 		adjustedStorage_{adjustStorage(storageUniquePointer_.get(), stackAlignment)},
 		adjustedSize_{adjustSize(storageUniquePointer_.get(), size, adjustedStorage_, stackAlignment)},
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+		stackPointer_{},
+		highWaterPointer_{static_cast<uint8_t*>(adjustedStorage_) + adjustedSize_},
+		paintFrontier_{highWaterPointer_},
+		scanPosition_{static_cast<uint8_t*>(adjustedStorage_) + stackGuardSize}
+#else	// DISTORTOS_STACK_MONITOR_ENABLE != 1
 		stackPointer_{}
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE != 1
 {
 
 }
@@ -95,7 +109,15 @@ Stack::Stack(void* const storage, const size_t size) :
 		storageUniquePointer_{storage, dummyDeleter<void*>},
 		adjustedStorage_{storage},
 		adjustedSize_{size},
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+		stackPointer_{},
+		highWaterPointer_{static_cast<uint8_t*>(adjustedStorage_) + adjustedSize_},
+		// adopted stack is not painted lazily, it is just scanned
+		paintFrontier_{static_cast<uint8_t*>(adjustedStorage_) + stackGuardSize},
+		scanPosition_{paintFrontier_}
+#else	// DISTORTOS_STACK_MONITOR_ENABLE != 1
 		stackPointer_{}
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE != 1
 {
 	/// \todo implement minimal size check
 }
@@ -117,6 +139,12 @@ bool Stack::checkStackGuard() const
 
 size_t Stack::getHighWaterMark() const
 {
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	return static_cast<uint8_t*>(adjustedStorage_) + adjustedSize_ - static_cast<uint8_t*>(highWaterPointer_);
+
+#else	// DISTORTOS_STACK_MONITOR_ENABLE != 1
+
 	const auto begin =
 			static_cast<decltype(&stackSentinel)>(adjustedStorage_) + stackGuardSize / sizeof(stackSentinel);
 	const auto end = static_cast<decltype(&stackSentinel)>(adjustedStorage_) + adjustedSize_ / sizeof(stackSentinel);
@@ -126,19 +154,78 @@ size_t Stack::getHighWaterMark() const
 				return element == stackSentinel;
 			});
 	return (end - usedElement) * sizeof(*begin);
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE != 1
 }
 
 int Stack::initialize(RunnableThread& runnableThread)
 {
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	std::fill_n(static_cast<std::decay<decltype(stackSentinel)>::type*>(adjustedStorage_),
+			stackGuardSize / sizeof(stackSentinel), stackSentinel);
+
+#else	// DISTORTOS_STACK_MONITOR_ENABLE != 1
+
 	std::fill_n(static_cast<std::decay<decltype(stackSentinel)>::type*>(adjustedStorage_),
 			adjustedSize_ / sizeof(stackSentinel), stackSentinel);
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE != 1
+
 	int ret;
 	std::tie(ret, stackPointer_) =
 			architecture::initializeStack(static_cast<uint8_t*>(adjustedStorage_) + stackGuardSize, getSize(),
 					runnableThread);
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	// initial stack frame is used, the rest of stack is painted lazily
+	highWaterPointer_ = stackPointer_;
+	paintFrontier_ = stackPointer_;
+	scanPosition_ = static_cast<uint8_t*>(adjustedStorage_) + stackGuardSize;
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
 	return ret;
 }
 
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+void Stack::updateHighWaterMark()
+{
+	using Element = std::decay<decltype(stackSentinel)>::type;
+
+	const auto begin = static_cast<Element*>(adjustedStorage_) + stackGuardSize / sizeof(stackSentinel);
+	// memory which is known to be used is neither painted nor scanned
+	const auto highWaterPointer = std::max(static_cast<Element*>(highWaterPointer_), begin);
+	const auto paintFrontier = static_cast<Element*>(paintFrontier_);
+
+	if (paintFrontier > begin)	// lazy painting is not finished yet?
+	{
+		const auto end = std::min(paintFrontier, highWaterPointer);
+		const auto paintBegin = end - begin > static_cast<ptrdiff_t>(stackMonitorChunkLength) ?
+				end - stackMonitorChunkLength : begin;
+		std::fill(paintBegin, end, stackSentinel);
+		paintFrontier_ = paintBegin;
+		return;
+	}
+
+	// scan from "stack guard" up, the first element which is not a sentinel is the new "high water mark"
+	const auto scanPosition = std::min(static_cast<Element*>(scanPosition_), highWaterPointer);
+	const auto end = highWaterPointer - scanPosition > static_cast<ptrdiff_t>(stackMonitorChunkLength) ?
+			scanPosition + stackMonitorChunkLength : highWaterPointer;
+	const auto usedElement = std::find_if_not(scanPosition, end,
+			[](const Element element) -> bool
+			{
+				return element == stackSentinel;
+			});
+	if (usedElement != end)
+		highWaterPointer_ = usedElement;
+	scanPosition_ = usedElement != end || end == highWaterPointer ? begin : end;
+}
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \brief StackMonitor class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/StackMonitor.hpp"
+
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/Stack.hpp"
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/stackUsageWarningHook.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void StackMonitor::add(ThreadControlBlock& threadControlBlock)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	threadControlBlock.stackUsageWarningReported = false;
+	list_.push_back(threadControlBlock);
+}
+
+void StackMonitor::step()
+{
+	ThreadIdentifier threadIdentifier;
+	size_t highWaterMark {};
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		if (list_.empty() == true)
+			return;
+
+		auto& threadControlBlock = list_.front();
+		list_.pop_front();
+
+		if (threadControlBlock.getState() == ThreadState::terminated)
+			return;
+
+		list_.push_back(threadControlBlock);
+
+		if (&threadControlBlock == &getScheduler().getCurrentThreadControlBlock())
+			return;
+
+		auto& stack = threadControlBlock.getStack();
+		stack.updateHighWaterMark();
+
+		if (threadControlBlock.stackUsageWarningReported == true)
+			return;
+
+		highWaterMark = stack.getHighWaterMark();
+		if (highWaterMark * 100 < stack.getSize() * DISTORTOS_STACK_USAGE_WARNING_THRESHOLD)
+			return;
+
+		threadControlBlock.stackUsageWarningReported = true;
+		threadIdentifier = {threadControlBlock, threadControlBlock.getSequenceNumber()};
+	}
+
+	// the hook is called with interrupts unmasked, so the thread may be deleted in the meantime - that's why only its
+	// identifier is passed
+	if (stackUsageWarningHook != nullptr)
+		stackUsageWarningHook(threadIdentifier, highWaterMark);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
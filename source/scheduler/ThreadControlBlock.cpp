@@ -15,12 +15,16 @@
 #include "distortos/internal/scheduler/RunnableThread.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 #include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
+#include "distortos/internal/scheduler/ThreadPriorityQueue.hpp"
 
 #include "distortos/internal/synchronization/MutexControlBlock.hpp"
+#include "distortos/internal/synchronization/ReadWriteMutexControlBlock.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/SignalsReceiver.hpp"
 
+#include <new>
+
 #include <cerrno>
 #include <cstring>
 
@@ -53,10 +57,22 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 		SignalsReceiver* const signalsReceiver, RunnableThread& owner) :
 				ThreadListNode{priority},
 				ownedProtocolMutexList_{},
+				ownedReadWriteMutexList_{},
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+				reent_{_global_impure_ptr},
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
 				stack_{std::move(stack)},
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+				threadLocalStorage_{},
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+				timerSlack_{},
 				list_{},
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+				priorityQueue_{},
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
 				owner_{owner},
 				priorityInheritanceMutexControlBlock_{},
+				priorityInheritanceReadWriteMutexControlBlock_{},
 				signalsReceiverControlBlock_{signalsReceiver != nullptr ?
 						&signalsReceiver->signalsReceiverControlBlock_ : nullptr},
 				threadGroupControlBlock_{threadGroupControlBlock},
@@ -65,8 +81,12 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
 {
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 	_REENT_INIT_PTR(&reent_);
 
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 	sequenceNumber_ = nextSequenceNumber++;
 }
@@ -78,18 +98,34 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 		SignalsReceiver*, RunnableThread& owner) :
 				ThreadListNode{priority},
 				ownedProtocolMutexList_{},
+				ownedReadWriteMutexList_{},
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+				reent_{_global_impure_ptr},
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
 				stack_{std::move(stack)},
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+				threadLocalStorage_{},
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+				timerSlack_{},
 				list_{},
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+				priorityQueue_{},
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
 				owner_{owner},
 				priorityInheritanceMutexControlBlock_{},
+				priorityInheritanceReadWriteMutexControlBlock_{},
 				threadGroupControlBlock_{threadGroupControlBlock},
 				unblockFunctor_{},
 				roundRobinQuantum_{},
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
 {
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 	_REENT_INIT_PTR(&reent_);
 
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 	sequenceNumber_ = nextSequenceNumber++;
 }
@@ -102,7 +138,25 @@ ThreadControlBlock::~ThreadControlBlock()
 
 	const InterruptMaskingLock interruptMaskingLock;
 
+#if DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+	stackMonitorNode.unlink();
+
+#endif	// DISTORTOS_STACK_MONITOR_ENABLE == 1
+
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+	if (reent_ != _global_impure_ptr)
+	{
+		_reclaim_reent(reent_);
+		delete reent_;
+	}
+
+#else	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+
 	_reclaim_reent(&reent_);
+
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
 }
 
 int ThreadControlBlock::addHook()
@@ -119,6 +173,28 @@ int ThreadControlBlock::addHook()
 	return 0;
 }
 
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+int ThreadControlBlock::enablePrivateReent()
+{
+	if (reent_ != _global_impure_ptr)	// already enabled?
+		return 0;
+
+	const auto reent = new (std::nothrow) _reent;
+	if (reent == nullptr)
+		return ENOMEM;
+
+	_REENT_INIT_PTR(reent);
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	reent_ = reent;
+	_impure_ptr = reent_;
+	return 0;
+}
+
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
 void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -139,6 +215,8 @@ void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBe
 
 	if (priorityInheritanceMutexControlBlock_ != nullptr)
 		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	else if (priorityInheritanceReadWriteMutexControlBlock_ != nullptr)
+		priorityInheritanceReadWriteMutexControlBlock_->updateOwnersBoostedPriority();
 }
 
 void ThreadControlBlock::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
@@ -168,6 +246,13 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 		newBoostedPriority = std::max(newBoostedPriority, mutexBoostedPriority);
 	}
 
+	for (const auto& readWriteMutexOwnership : ownedReadWriteMutexList_)
+	{
+		const auto readWriteMutexBoostedPriority =
+				readWriteMutexOwnership.getReadWriteMutexControlBlock().getBoostedPriority();
+		newBoostedPriority = std::max(newBoostedPriority, readWriteMutexBoostedPriority);
+	}
+
 	if (boostedPriority_ == newBoostedPriority)
 		return;
 
@@ -187,6 +272,8 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 	// memory usage of threads.
 	if (priorityInheritanceMutexControlBlock_ != nullptr)
 		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	else if (priorityInheritanceReadWriteMutexControlBlock_ != nullptr)
+		priorityInheritanceReadWriteMutexControlBlock_->updateOwnersBoostedPriority();
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -195,6 +282,17 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 
 void ThreadControlBlock::reposition(const bool loweringBefore)
 {
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+	if (priorityQueue_ != nullptr)
+	{
+		priorityQueue_->splice(ThreadList::iterator{*this}, loweringBefore);
+		getScheduler().maybeRequestContextSwitch();
+		return;
+	}
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
 	const auto oldPriority = priority_;
 
 	if (loweringBefore == true)
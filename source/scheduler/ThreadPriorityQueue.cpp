@@ -0,0 +1,129 @@
+/**
+ * \file
+ * \brief ThreadPriorityQueue class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/ThreadPriorityQueue.hpp"
+
+#if DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts effective priority of thread to index of bucket.
+ *
+ * \param [in] priority is the effective priority of thread
+ *
+ * \return index of bucket for \a priority
+ */
+
+constexpr size_t getBucketIndex(const uint8_t priority)
+{
+	return priority * ThreadPriorityQueue::bucketsCount / (UINT8_MAX + 1);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+ThreadPriorityQueue::iterator ThreadPriorityQueue::begin()
+{
+	return findFirstBucket()->begin();
+}
+
+ThreadPriorityQueue::reference ThreadPriorityQueue::front()
+{
+	return findFirstBucket()->front();
+}
+
+ThreadPriorityQueue::const_reference ThreadPriorityQueue::front() const
+{
+	return findFirstBucket()->front();
+}
+
+void ThreadPriorityQueue::splice(const iterator splicedElement, const bool atFront)
+{
+	auto& element = *splicedElement;
+	Bucket::erase(splicedElement);
+	insertInternal(element, atFront);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+ThreadPriorityQueue::Bucket* ThreadPriorityQueue::findFirstBucket() const
+{
+	for (size_t wordIndex {bitmapWords}; wordIndex != 0; --wordIndex)
+	{
+		auto& word = bitmap_[wordIndex - 1];
+		while (word != 0)
+		{
+			const auto bit = bitmapWordBits - 1 - __builtin_clz(word);
+			auto& bucket = getBucket((wordIndex - 1) * bitmapWordBits + bit);
+			if (bucket.empty() == false)
+				return &bucket;
+
+			// all threads were unlinked from this bucket without access to the queue - clear the stale bit now
+			word &= ~(BitmapWord{1} << bit);
+		}
+	}
+
+	return {};
+}
+
+ThreadPriorityQueue::iterator ThreadPriorityQueue::insertInternal(reference newElement, const bool atFront)
+{
+	const auto priority = newElement.getEffectivePriority();
+	const auto bucketIndex = getBucketIndex(priority);
+	auto& word = bitmap_[bucketIndex / bitmapWordBits];
+	const auto mask = BitmapWord{1} << bucketIndex % bitmapWordBits;
+	if ((word & mask) == 0)	// bucket with cleared bit is empty, but it may be not constructed yet
+		new (&bucketsStorage_[bucketIndex]) Bucket;
+	word |= mask;
+	auto& bucket = getBucket(bucketIndex);
+
+	// if one bucket holds just one priority, these searches stop at the first checked element
+	auto position = bucket.end();
+	if (atFront == true)
+		position = std::find_if(bucket.begin(), bucket.end(),
+				[priority](const_reference element) -> bool
+				{
+					return element.getEffectivePriority() <= priority;
+				});
+	else
+		while (position != bucket.begin() && std::prev(position)->getEffectivePriority() < priority)
+			--position;
+
+	return Bucket::insert(position, newElement);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_WAIT_QUEUES_ENABLE == 1
@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \brief TraceRecorder class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/TraceRecorder.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t TraceRecorder::read(const RecordsRange records)
+{
+	if (records.size() == 0)
+		return 0;
+
+	size_t copiedRecords {};
+	if (lostRecords_ != 0)
+	{
+		// records are lost only when the ring buffer is full, so the oldest record surely exists
+		const auto lostRecords = std::min<size_t>(lostRecords_, UINT32_MAX);
+		records[copiedRecords++] = {records_[readPosition_].timestamp, {}, {}, static_cast<uint32_t>(lostRecords),
+				TraceRecord::Type::lostRecords, {}};
+		lostRecords_ = {};
+	}
+
+	const auto capacity = records_.size();
+	while (copiedRecords < records.size() && storedRecords_ != 0)
+	{
+		records[copiedRecords++] = records_[readPosition_];
+		readPosition_ = (readPosition_ + 1) % capacity;
+		--storedRecords_;
+	}
+
+	return copiedRecords;
+}
+
+void TraceRecorder::record(const TraceRecord& record)
+{
+	const auto capacity = records_.size();
+	if (capacity == 0)
+		return;
+
+	records_[(readPosition_ + storedRecords_) % capacity] = record;
+
+	if (storedRecords_ != capacity)
+	{
+		++storedRecords_;
+		return;
+	}
+
+	// the oldest record was overwritten
+	readPosition_ = (readPosition_ + 1) % capacity;
+	++lostRecords_;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -11,15 +11,26 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/DynamicSoftwareTimer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/forceContextSwitch.cpp
 		${CMAKE_CURRENT_LIST_DIR}/getScheduler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getSoftwareTimerDaemon.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getStackMonitor.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getTraceRecorder.cpp
+		${CMAKE_CURRENT_LIST_DIR}/HighResolutionTimer.cpp
+		${CMAKE_CURRENT_LIST_DIR}/HighResolutionTimerSupervisor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/IdleThread.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MainThread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/recordTraceEvent.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RoundRobinQuantum.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Scheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerCommon.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerDaemon.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerSupervisor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Stack.cpp
+		${CMAKE_CURRENT_LIST_DIR}/StackMonitor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/statistics.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadControlBlock.cpp
-		${CMAKE_CURRENT_LIST_DIR}/ThreadGroupControlBlock.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/ThreadGroupControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadPriorityQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/trace.cpp
+		${CMAKE_CURRENT_LIST_DIR}/TraceRecorder.cpp)
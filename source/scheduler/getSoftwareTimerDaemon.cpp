@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief getSoftwareTimerDaemon() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/getSoftwareTimerDaemon.hpp"
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#include "distortos/internal/scheduler/SoftwareTimerDaemon.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of SoftwareTimerDaemon
+SoftwareTimerDaemon softwareTimerDaemonInstance;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief getTraceRecorder() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/getTraceRecorder.hpp"
+
+#if DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+#include "distortos/internal/scheduler/TraceRecorder.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for ring buffer of records of main instance of TraceRecorder
+TraceRecord traceRecords[DISTORTOS_TRACE_RECORDER_RECORDS];
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of TraceRecorder
+TraceRecorder traceRecorderInstance {TraceRecorder::RecordsRange{traceRecords}};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TRACE_RECORDER_ENABLE == 1
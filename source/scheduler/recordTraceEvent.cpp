@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief recordTraceEvent() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/recordTraceEvent.hpp"
+
+#if DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+#include "distortos/architecture/getTickTimerCounter.hpp"
+#include "distortos/architecture/isInInterruptContext.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/getTraceRecorder.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/TraceRecorder.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void recordTraceEvent(const TraceRecord::Type type, const void* const object, const uint32_t argument)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto& scheduler = getScheduler();
+	// with interrupts masked tick count cannot change, tick which already started is indicated by pending flag
+	const auto counter = architecture::getTickTimerCounter();
+	const auto tickCount = scheduler.getTickCount() + (counter.pendingTick == true ? 1 : 0);
+	const auto thread = scheduler.isInitialized() == true ? &scheduler.getCurrentThreadControlBlock().getOwner() :
+			nullptr;
+	getTraceRecorder().record({tickCount * counter.period + counter.elapsed, thread, object, argument, type,
+			architecture::isInInterruptContext()});
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TRACE_RECORDER_ENABLE == 1
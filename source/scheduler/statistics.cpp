@@ -11,8 +11,23 @@
 
 #include "distortos/statistics.hpp"
 
+#include "distortos/internal/memory/getThreadRecyclingCache.hpp"
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+#include "distortos/internal/memory/MemoryRegion.hpp"
+#include "distortos/internal/memory/ThreadRecyclingCache.hpp"
+#include "distortos/internal/memory/TlsfHeap.hpp"
+#include "distortos/internal/memory/TlsfHeapLock.hpp"
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/getSoftwareTimerDaemon.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerDaemon.hpp"
+
+#include "distortos/internal/synchronization/getProfiledMutexList.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cassert>
 
 namespace distortos
 {
@@ -29,6 +44,94 @@ uint64_t getContextSwitchCount()
 	return internal::getScheduler().getContextSwitchCount();
 }
 
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+HeapStatistics getHeapStatistics()
+{
+	const internal::TlsfHeapLock tlsfHeapLock;
+	return internal::getTlsfHeap().getStatistics();
+}
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+HeapStatistics getMemoryRegionStatistics(const size_t index)
+{
+	const auto regions = internal::getMemoryRegions();
+	assert(index < regions.size());
+	const internal::TlsfHeapLock tlsfHeapLock;
+	return regions[index].getHeap().getStatistics();
+}
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+size_t getMutexStatistics(const estd::ContiguousRange<MutexStatistics> statistics)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	size_t count {};
+	for (const auto& mutexControlBlock : internal::getProfiledMutexList())
+	{
+		if (count < statistics.size())
+			statistics[count] = mutexControlBlock.getStatistics();
+		++count;
+	}
+	return count;
+}
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+uint64_t getSoftwareTimerDaemonExecutionCount()
+{
+	return internal::getSoftwareTimerDaemon().getExecutionCount();
+}
+
+HighResolutionClock::duration getSoftwareTimerDaemonMaxQueueingDelay()
+{
+	return internal::getSoftwareTimerDaemon().getMaxQueueingDelay();
+}
+
+HighResolutionClock::duration getSoftwareTimerDaemonTotalQueueingDelay()
+{
+	return internal::getSoftwareTimerDaemon().getTotalQueueingDelay();
+}
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+uint64_t getSoftwareTimerExecutionCount()
+{
+	return internal::getScheduler().getSoftwareTimerSupervisor().getExecutionCount();
+}
+
+uint64_t getSoftwareTimerExpiryTickCount()
+{
+	return internal::getScheduler().getSoftwareTimerSupervisor().getExpiryTickCount();
+}
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+
+size_t getThreadRecyclingCacheHitCount()
+{
+	return internal::getThreadRecyclingCache().getHitCount();
+}
+
+size_t getThreadRecyclingCacheMissCount()
+{
+	return internal::getThreadRecyclingCache().getMissCount();
+}
+
+size_t getThreadRecyclingCacheSize()
+{
+	return internal::getThreadRecyclingCache().getSize();
+}
+
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
 }	// namespace statistics
 
 }	// namespace distortos
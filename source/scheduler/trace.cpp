@@ -0,0 +1,75 @@
+/**
+ * \file
+ * \brief trace namespace implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/trace.hpp"
+
+#if DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+#include "distortos/architecture/getTickTimerCounter.hpp"
+
+#include "distortos/internal/scheduler/getTraceRecorder.hpp"
+#include "distortos/internal/scheduler/recordTraceEvent.hpp"
+#include "distortos/internal/scheduler/TraceRecorder.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+namespace trace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void clear()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	internal::getTraceRecorder().clear();
+}
+
+uint64_t getTimestampFrequency()
+{
+	return uint64_t{DISTORTOS_TICK_FREQUENCY} * architecture::getTickTimerCounter().period;
+}
+
+size_t read(const estd::ContiguousRange<TraceRecord> records)
+{
+	size_t copiedRecords {};
+	while (copiedRecords < records.size())
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+		const auto ret = internal::getTraceRecorder().read({records.begin() + copiedRecords, 1});
+		if (ret == 0)
+			break;
+
+		copiedRecords += ret;
+	}
+
+	return copiedRecords;
+}
+
+void recordInterruptEntry(const uint32_t number)
+{
+	internal::recordTraceEvent(TraceRecord::Type::interruptEntry, {}, number);
+}
+
+void recordInterruptExit(const uint32_t number)
+{
+	internal::recordTraceEvent(TraceRecord::Type::interruptExit, {}, number);
+}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TRACE_RECORDER_ENABLE == 1
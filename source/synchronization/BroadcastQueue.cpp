@@ -0,0 +1,170 @@
+/**
+ * \file
+ * \brief BroadcastQueue class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/BroadcastQueue.hpp"
+
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cstring>
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| BroadcastQueue::Subscriber public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+BroadcastQueue::Subscriber::Subscriber(BroadcastQueue& broadcastQueue) :
+		node_{},
+		broadcastQueue_{broadcastQueue},
+		semaphore_{0, 1},
+		lagCount_{},
+		readSequence_{}
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	readSequence_ = broadcastQueue_.writeSequence_;
+	broadcastQueue_.subscribers_.push_back(*this);
+}
+
+BroadcastQueue::Subscriber::~Subscriber()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	node_.unlink();
+}
+
+size_t BroadcastQueue::Subscriber::getLagCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return lagCount_;
+}
+
+size_t BroadcastQueue::Subscriber::getPendingCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto pendingCount = broadcastQueue_.writeSequence_ - readSequence_;
+	return pendingCount < broadcastQueue_.maxElements_ ? pendingCount : broadcastQueue_.maxElements_;
+}
+
+int BroadcastQueue::Subscriber::pop(void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popInternal(semaphoreWaitFunctor, buffer, size);
+}
+
+int BroadcastQueue::Subscriber::tryPop(void* const buffer, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popInternal(semaphoreTryWaitFunctor, buffer, size);
+}
+
+int BroadcastQueue::Subscriber::tryPopFor(const TickClock::duration duration, void* const buffer, const size_t size)
+{
+	// waiting for new element may be repeated, so relative timeout must be converted to absolute one
+	return tryPopUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size);
+}
+
+int BroadcastQueue::Subscriber::tryPopUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popInternal(semaphoreTryWaitUntilFunctor, buffer, size);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| BroadcastQueue::Subscriber private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int BroadcastQueue::Subscriber::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		void* const buffer, const size_t size)
+{
+	if (size != broadcastQueue_.elementSize_)
+		return EMSGSIZE;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	size_t pendingCount;
+	// semaphore may be left posted by elements which were already received, so the wait may need to be repeated
+	while ((pendingCount = updatePendingCount()) == 0)
+	{
+		const auto ret = waitSemaphoreFunctor(semaphore_);
+		if (ret != 0)
+			return ret;
+	}
+
+	const auto maxElements = broadcastQueue_.maxElements_;
+	const auto index = (broadcastQueue_.writeIndex_ + maxElements - pendingCount) % maxElements;
+	memcpy(buffer, static_cast<const uint8_t*>(broadcastQueue_.storageUniquePointer_.get()) + index * size, size);
+	++readSequence_;
+	return 0;
+}
+
+size_t BroadcastQueue::Subscriber::updatePendingCount()
+{
+	const auto maxElements = broadcastQueue_.maxElements_;
+	const auto pendingCount = broadcastQueue_.writeSequence_ - readSequence_;
+	if (pendingCount <= maxElements)
+		return pendingCount;
+
+	// the oldest elements were already overwritten, skip to the oldest one which is still available
+	lagCount_ += pendingCount - maxElements;
+	readSequence_ = broadcastQueue_.writeSequence_ - maxElements;
+	return maxElements;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+BroadcastQueue::BroadcastQueue(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
+		const size_t maxElements) :
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		subscribers_{},
+		elementSize_{elementSize},
+		maxElements_{maxElements},
+		writeIndex_{},
+		writeSequence_{}
+{
+
+}
+
+int BroadcastQueue::push(const void* const data, const size_t size)
+{
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	memcpy(static_cast<uint8_t*>(storageUniquePointer_.get()) + writeIndex_ * size, data, size);
+	writeIndex_ = writeIndex_ + 1 < maxElements_ ? writeIndex_ + 1 : 0;
+	++writeSequence_;
+
+	for (auto& subscriber : subscribers_)
+		if (subscriber.semaphore_.getValue() == 0)
+			subscriber.semaphore_.post();
+
+	return 0;
+}
+
+}	// namespace distortos
@@ -0,0 +1,146 @@
+/**
+ * \file
+ * \brief BufferLoanQueue class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/BufferLoanQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
+#include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitForFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+BufferLoanQueue::BufferLoanQueue(StorageUniquePointer&& buffersStorageUniquePointer,
+		StorageUniquePointer&& handlesStorageUniquePointer, const size_t bufferSize, const size_t buffersCount) :
+				buffersStorageUniquePointer_{std::move(buffersStorageUniquePointer)},
+				sentQueue_{{static_cast<void**>(handlesStorageUniquePointer.get()) + buffersCount,
+						internal::dummyDeleter<void*>}, sizeof(void*), buffersCount},
+				freeQueue_{std::move(handlesStorageUniquePointer), sizeof(void*), buffersCount},
+				bufferSize_{bufferSize}
+{
+	const auto buffers = static_cast<uint8_t*>(buffersStorageUniquePointer_.get());
+	for (size_t i {}; i < buffersCount; ++i)
+		pushInternal(freeQueue_, buffers + i * bufferSize_);
+}
+
+int BufferLoanQueue::acquire(void*& buffer)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popInternal(freeQueue_, semaphoreWaitFunctor, buffer);
+}
+
+int BufferLoanQueue::receive(void*& buffer)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popInternal(sentQueue_, semaphoreWaitFunctor, buffer);
+}
+
+int BufferLoanQueue::release(void* const buffer)
+{
+	return pushInternal(freeQueue_, buffer);
+}
+
+int BufferLoanQueue::send(void* const buffer)
+{
+	return pushInternal(sentQueue_, buffer);
+}
+
+int BufferLoanQueue::tryAcquire(void*& buffer)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popInternal(freeQueue_, semaphoreTryWaitFunctor, buffer);
+}
+
+int BufferLoanQueue::tryAcquireFor(const TickClock::duration duration, void*& buffer)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popInternal(freeQueue_, semaphoreTryWaitForFunctor, buffer);
+}
+
+int BufferLoanQueue::tryAcquireUntil(const TickClock::time_point timePoint, void*& buffer)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popInternal(freeQueue_, semaphoreTryWaitUntilFunctor, buffer);
+}
+
+int BufferLoanQueue::tryReceive(void*& buffer)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popInternal(sentQueue_, semaphoreTryWaitFunctor, buffer);
+}
+
+int BufferLoanQueue::tryReceiveFor(const TickClock::duration duration, void*& buffer)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popInternal(sentQueue_, semaphoreTryWaitForFunctor, buffer);
+}
+
+int BufferLoanQueue::tryReceiveUntil(const TickClock::time_point timePoint, void*& buffer)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popInternal(sentQueue_, semaphoreTryWaitUntilFunctor, buffer);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool BufferLoanQueue::isValidBuffer(const void* const buffer) const
+{
+	const auto buffers = static_cast<const uint8_t*>(buffersStorageUniquePointer_.get());
+	const auto offset = static_cast<const uint8_t*>(buffer) - buffers;
+	return offset >= 0 && static_cast<size_t>(offset) < bufferSize_ * getCapacity() &&
+			static_cast<size_t>(offset) % bufferSize_ == 0;
+}
+
+int BufferLoanQueue::popInternal(internal::FifoQueueBase& fifoQueueBase,
+		const internal::SemaphoreFunctor& waitSemaphoreFunctor, void*& buffer)
+{
+	const internal::MemcpyPopQueueFunctor memcpyPopQueueFunctor {&buffer, sizeof(buffer)};
+	return fifoQueueBase.pop(waitSemaphoreFunctor, memcpyPopQueueFunctor);
+}
+
+int BufferLoanQueue::pushInternal(internal::FifoQueueBase& fifoQueueBase, void* const buffer)
+{
+	if (isValidBuffer(buffer) == false)
+		return EINVAL;
+
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	const internal::MemcpyPushQueueFunctor memcpyPushQueueFunctor {&buffer, sizeof(buffer)};
+	return fifoQueueBase.push(semaphoreTryWaitFunctor, memcpyPushQueueFunctor);
+}
+
+}	// namespace distortos
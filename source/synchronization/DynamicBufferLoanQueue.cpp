@@ -0,0 +1,30 @@
+/**
+ * \file
+ * \brief DynamicBufferLoanQueue class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/DynamicBufferLoanQueue.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DynamicBufferLoanQueue::DynamicBufferLoanQueue(const size_t bufferSize, const size_t buffersCount) :
+		BufferLoanQueue{{new uint8_t[bufferSize * buffersCount], internal::storageDeleter<uint8_t>},
+				{new void*[2 * buffersCount], internal::storageDeleter<void*>}, bufferSize, buffersCount}
+{
+
+}
+
+}	// namespace distortos
@@ -13,6 +13,7 @@
 
 #if DISTORTOS_SIGNALS_ENABLE == 1
 
+#include "distortos/internal/memory/dummyDeleter.hpp"
 #include "distortos/internal/memory/storageDeleter.hpp"
 
 namespace distortos
@@ -33,6 +34,17 @@ DynamicSignalsReceiver::DynamicSignalsReceiver(const size_t queuedSignals, const
 
 }
 
+DynamicSignalsReceiver::DynamicSignalsReceiver(SignalInformationQueueWrapper::Storage* const queuedSignalsStorage,
+		const size_t queuedSignals, SignalsCatcher::Storage* const signalActionsStorage, const size_t signalActions) :
+		SignalsReceiver{queuedSignals != 0 ? &signalInformationQueueWrapper_ : nullptr,
+				signalActions != 0 ? &signalsCatcher_ : nullptr},
+		signalInformationQueueWrapper_{{queuedSignalsStorage,
+				internal::dummyDeleter<SignalInformationQueueWrapper::Storage>}, queuedSignals},
+		signalsCatcher_{{signalActionsStorage, internal::dummyDeleter<SignalsCatcher::Storage>}, signalActions}
+{
+
+}
+
 }	// namespace distortos
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
@@ -0,0 +1,29 @@
+/**
+ * \file
+ * \brief DynamicStreamBuffer class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/DynamicStreamBuffer.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DynamicStreamBuffer::DynamicStreamBuffer(const size_t storageSize, const size_t triggerLevel) :
+		StreamBuffer{{new uint8_t[storageSize], internal::storageDeleter<uint8_t>}, storageSize, triggerLevel}
+{
+
+}
+
+}	// namespace distortos
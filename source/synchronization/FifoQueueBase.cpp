@@ -11,7 +11,7 @@
 
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
 
-#include "distortos/InterruptMaskingLock.hpp"
+#include <cerrno>
 
 namespace distortos
 {
@@ -31,7 +31,8 @@ FifoQueueBase::FifoQueueBase(StorageUniquePointer&& storageUniquePointer, const
 		storageEnd_{static_cast<uint8_t*>(storageUniquePointer_.get()) + elementSize * maxElements},
 		readPosition_{storageUniquePointer_.get()},
 		writePosition_{storageUniquePointer_.get()},
-		elementSize_{elementSize}
+		elementSize_{elementSize},
+		overrunCount_{}
 {
 
 }
@@ -41,6 +42,33 @@ FifoQueueBase::~FifoQueueBase()
 
 }
 
+size_t FifoQueueBase::getOverrunCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return overrunCount_;
+}
+
+int FifoQueueBase::pushOverwrite(const QueueFunctor& functor, const QueueFunctor& dropFunctor)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (pushSemaphore_.tryWait() != 0)	// queue is full?
+	{
+		// if all elements were already handed over to threads woken in pop(), none of them can be dropped
+		if (popSemaphore_.tryWait() != 0)
+			return EAGAIN;
+
+		dropFunctor(readPosition_);
+		advance(readPosition_);
+		++overrunCount_;
+	}
+
+	functor(writePosition_);
+	advance(writePosition_);
+	recordTraceEvent(TraceRecord::Type::queuePush, this);
+	return popSemaphore_.post();
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -55,11 +83,8 @@ int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const Q
 		return ret;
 
 	functor(storage);
-
-	storage = static_cast<uint8_t*>(storage) + elementSize_;
-	if (storage >= storageEnd_)
-		storage = storageUniquePointer_.get();
-
+	advance(storage);
+	recordTraceEvent(&storage == &writePosition_ ? TraceRecord::Type::queuePush : TraceRecord::Type::queuePop, this);
 	return postSemaphore.post();
 }
 
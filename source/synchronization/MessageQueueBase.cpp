@@ -11,8 +11,12 @@
 
 #include "distortos/internal/synchronization/MessageQueueBase.hpp"
 
+#include "distortos/internal/scheduler/recordTraceEvent.hpp"
+
 #include "distortos/InterruptMaskingLock.hpp"
 
+#include <iterator>
+
 namespace distortos
 {
 
@@ -64,7 +68,15 @@ public:
 
 		functor_(entry.storage);
 
+#if DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE == 1
+
+		entryList.spliceFront(freeEntryList);
+
+#else	// DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE != 1
+
 		MessageQueueBase::FreeEntryList::splice_after(freeEntryList.before_begin(), entryList.before_begin());
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE != 1
 	}
 
 private:
@@ -154,6 +166,38 @@ MessageQueueBase::~MessageQueueBase()
 
 }
 
+#if DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE == 1
+
+void MessageQueueBase::BucketedEntryList::spliceFront(FreeEntryList& other)
+{
+	auto& entry = list_.front();
+	if (tails_[entry.priority] == &entry)	// is this the last entry with this priority?
+		bitmap_[entry.priority / bitmapWordBits] &= ~(BitmapWord{1} << entry.priority % bitmapWordBits);
+
+	FreeEntryList::splice_after(other.before_begin(), list_.before_begin());
+}
+
+void MessageQueueBase::BucketedEntryList::splice_after(const FreeEntryList::iterator beforeSplicedElement)
+{
+	auto& entry = *std::next(beforeSplicedElement);
+	const auto priority = entry.priority;
+
+	// find the lowest priority that is higher than or equal to priority of new entry and has at least one entry
+	auto position = list_.before_begin();
+	auto wordIndex = priority / bitmapWordBits;
+	auto word = bitmap_[wordIndex] & ~BitmapWord{} << priority % bitmapWordBits;
+	while (word == 0 && ++wordIndex < sizeof(bitmap_) / sizeof(*bitmap_))
+		word = bitmap_[wordIndex];
+	if (word != 0)
+		position = FreeEntryList::iterator{*tails_[wordIndex * bitmapWordBits + __builtin_ctz(word)]};
+
+	FreeEntryList::splice_after(position, beforeSplicedElement);
+	tails_[priority] = &entry;
+	bitmap_[priority / bitmapWordBits] |= BitmapWord{1} << priority % bitmapWordBits;
+}
+
+#endif	// DISTORTOS_PRIORITY_BUCKETED_MESSAGE_QUEUES_ENABLE == 1
+
 int MessageQueueBase::pop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const QueueFunctor& functor)
 {
 	const PopInternalFunctor popInternalFunctor {priority, functor};
@@ -181,6 +225,8 @@ int MessageQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, cons
 		return ret;
 
 	internalFunctor(entryList_, freeEntryList_);
+	recordTraceEvent(&postSemaphore == &popSemaphore_ ? TraceRecord::Type::queuePush : TraceRecord::Type::queuePop,
+			this);
 
 	return postSemaphore.post();
 }
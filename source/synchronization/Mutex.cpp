@@ -29,6 +29,11 @@ namespace distortos
 
 int Mutex::lock()
 {
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryFastLock() == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -41,6 +46,11 @@ int Mutex::lock()
 
 int Mutex::tryLock()
 {
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryFastLock() == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 	const auto ret = tryLockInternal();
 	return ret != EDEADLK ? ret : EBUSY;
@@ -53,6 +63,11 @@ int Mutex::tryLockFor(const TickClock::duration duration)
 
 int Mutex::tryLockUntil(const TickClock::time_point timePoint)
 {
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryFastLock() == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -68,6 +83,9 @@ int Mutex::unlock()
 {
 	CHECK_FUNCTION_CONTEXT();
 
+	if (tryFastUnlock() == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	if (getType() != Type::normal)
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,19 @@
 #include "distortos/internal/synchronization/MutexControlBlock.hpp"
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/recordTraceEvent.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#include "distortos/internal/synchronization/getProfiledMutexList.hpp"
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+#include "distortos/architecture/compareAndSwap.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
 namespace distortos
 {
 
@@ -93,48 +104,114 @@ uint8_t MutexControlBlock::getBoostedPriority() const
 	return 0;
 }
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+MutexStatistics MutexControlBlock::getStatistics() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto statistics = profile_.getStatistics();
+	statistics.mutex = this;
+	return statistics;
+}
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | protected functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+MutexControlBlock::~MutexControlBlock()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (profiledMutexNode.isLinked() == true)
+		profiledMutexNode.unlink();
+}
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 int MutexControlBlock::doBlock()
 {
 	beforeBlock();
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	const auto waitStart = HighResolutionClock::now();
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 	const PriorityInheritanceMutexControlBlockUnblockFunctor unblockFunctor {*this};
-	return getScheduler().block(blockedList_, ThreadState::blockedOnMutex,
+	const auto ret = getScheduler().block(blockedList_, ThreadState::blockedOnMutex,
 			getProtocol() == Protocol::priorityInheritance ? &unblockFunctor : nullptr);
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	profile_.recordWait(HighResolutionClock::now() - waitStart);
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	if (ret == 0)	// lock was transferred to this thread
+		recordTraceEvent(TraceRecord::Type::mutexLock, this, true);
+	return ret;
 }
 
 int MutexControlBlock::doBlockUntil(const TickClock::time_point timePoint)
 {
 	beforeBlock();
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	const auto waitStart = HighResolutionClock::now();
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 	const PriorityInheritanceMutexControlBlockUnblockFunctor unblockFunctor {*this};
-	return getScheduler().blockUntil(blockedList_, ThreadState::blockedOnMutex, timePoint,
+	const auto ret = getScheduler().blockUntil(blockedList_, ThreadState::blockedOnMutex, timePoint,
 			getProtocol() == Protocol::priorityInheritance ? &unblockFunctor : nullptr);
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	profile_.recordWait(HighResolutionClock::now() - waitStart);
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	if (ret == 0)	// lock was transferred to this thread
+		recordTraceEvent(TraceRecord::Type::mutexLock, this, true);
+	return ret;
 }
 
 void MutexControlBlock::doLock()
 {
 	auto& scheduler = getScheduler();
-	owner_ = &scheduler.getCurrentThreadControlBlock();
+	owner_ = reinterpret_cast<uintptr_t>(&scheduler.getCurrentThreadControlBlock());
+	recordTraceEvent(TraceRecord::Type::mutexLock, this);
 
-	if (getProtocol() == Protocol::none)
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	profileLock(false);
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+	// mutex with priorityInheritance protocol is added to the list of owned mutexes only when some thread blocks on it
+	if (getProtocol() != Protocol::priorityProtect)
 		return;
 
+	owner_ |= slowUnlockFlag;
 	getOwner()->getOwnedProtocolMutexList().push_front(*this);
-
-	if (getProtocol() == Protocol::priorityProtect)
-		getOwner()->updateBoostedPriority();
+	getOwner()->updateBoostedPriority();
 }
 
 void MutexControlBlock::doUnlockOrTransferLock()
 {
 	auto& oldOwner = *getOwner();
+	recordTraceEvent(TraceRecord::Type::mutexUnlock, this);
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	profileUnlock();
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
 
 	if (blockedList_.empty() == false)
+	{
 		doTransferLock();
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+		// hold time of the thread which received the lock starts now
+		profileLock(true);
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	}
 	else
 		doUnlock();
 
@@ -149,26 +226,86 @@ void MutexControlBlock::doUnlockOrTransferLock()
 	getOwner()->updateBoostedPriority();
 }
 
+bool MutexControlBlock::tryFastLock()
+{
+	if (getProtocol() == Protocol::priorityProtect)
+		return false;
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1 || DISTORTOS_TRACE_RECORDER_ENABLE == 1
+	// change of owner and its recording must be atomic, otherwise events of other threads could be recorded between
+	// them
+	const InterruptMaskingLock interruptMaskingLock;
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1 || DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+	const auto locked = architecture::compareAndSwap(owner_, 0,
+			reinterpret_cast<uintptr_t>(&getScheduler().getCurrentThreadControlBlock()));
+	if (locked == true)
+	{
+		recordTraceEvent(TraceRecord::Type::mutexLock, this);
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+		profileLock(false);
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	}
+	return locked;
+}
+
+bool MutexControlBlock::tryFastUnlock()
+{
+	if (getProtocol() == Protocol::priorityProtect || recursiveLocksCount_ != 0)
+		return false;
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1 || DISTORTOS_TRACE_RECORDER_ENABLE == 1
+	// change of owner and its recording must be atomic, otherwise other thread could lock the mutex and record that
+	// before this unlock is recorded
+	const InterruptMaskingLock interruptMaskingLock;
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1 || DISTORTOS_TRACE_RECORDER_ENABLE == 1
+
+	const auto unlocked = architecture::compareAndSwap(owner_,
+			reinterpret_cast<uintptr_t>(&getScheduler().getCurrentThreadControlBlock()), 0);
+	if (unlocked == true)
+	{
+		recordTraceEvent(TraceRecord::Type::mutexUnlock, this);
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+		profileUnlock();
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	}
+	return unlocked;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-void MutexControlBlock::beforeBlock() const
+void MutexControlBlock::beforeBlock()
 {
+	// owner must release the mutex via slow path, which will unblock this thread
+	owner_ |= slowUnlockFlag;
+
 	if (getProtocol() != Protocol::priorityInheritance)
 		return;
 
+	if (node.isLinked() == false)
+		getOwner()->getOwnedProtocolMutexList().push_front(*this);
+
 	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
 
 	currentThreadControlBlock.setPriorityInheritanceMutexControlBlock(this);
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+	if (currentThreadControlBlock.getEffectivePriority() > getOwner()->getEffectivePriority())
+		profile_.recordBoost();
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 	// calling thread is not yet on the blocked list, that's why it's effective priority is given explicitly
 	getOwner()->updateBoostedPriority(currentThreadControlBlock.getEffectivePriority());
 }
 
 void MutexControlBlock::doTransferLock()
 {
-	owner_ = &blockedList_.front();	// pass ownership to the unblocked thread
+	// pass ownership to the unblocked thread, other threads may still be blocked, so it must unlock via slow path
+	owner_ = reinterpret_cast<uintptr_t>(&blockedList_.front()) | slowUnlockFlag;
 	getScheduler().unblock(blockedList_.begin());
 
 	if (node.isLinked() == false)
@@ -182,7 +319,7 @@ void MutexControlBlock::doTransferLock()
 
 void MutexControlBlock::doUnlock()
 {
-	owner_ = nullptr;
+	owner_ = {};
 
 	if (node.isLinked() == false)
 		return;
@@ -190,6 +327,27 @@ void MutexControlBlock::doUnlock()
 	node.unlink();
 }
 
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+void MutexControlBlock::profileLock(const bool contended)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	// the mutex is added to the list lazily, so its constructor can still be constexpr
+	if (profiledMutexNode.isLinked() == false)
+		getProfiledMutexList().push_back(*this);
+
+	profile_.recordLock(HighResolutionClock::now(), contended);
+}
+
+void MutexControlBlock::profileUnlock()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	profile_.recordUnlock(HighResolutionClock::now());
+}
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief MutexProfile class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/MutexProfile.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void MutexProfile::recordLock(const HighResolutionClock::time_point timePoint, const bool contended)
+{
+	++statistics_.acquisitions;
+	if (contended == true)
+		++statistics_.contendedAcquisitions;
+	lockTimePoint_ = timePoint;
+}
+
+void MutexProfile::recordUnlock(const HighResolutionClock::time_point timePoint)
+{
+	const auto holdTime = timePoint - lockTimePoint_;
+	statistics_.totalHoldTime += holdTime;
+	statistics_.maxHoldTime = std::max(statistics_.maxHoldTime, holdTime);
+}
+
+void MutexProfile::recordWait(const HighResolutionClock::duration waitTime)
+{
+	statistics_.totalWaitTime += waitTime;
+	statistics_.maxWaitTime = std::max(statistics_.maxWaitTime, waitTime);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
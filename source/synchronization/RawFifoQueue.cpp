@@ -11,6 +11,7 @@
 
 #include "distortos/RawFifoQueue.hpp"
 
+#include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
@@ -53,6 +54,21 @@ int RawFifoQueue::push(const void* const data, const size_t size)
 	return pushInternal(semaphoreWaitFunctor, data, size);
 }
 
+int RawFifoQueue::pushOverwrite(const void* const data, const size_t size)
+{
+	if (size != fifoQueueBase_.getElementSize())
+		return EMSGSIZE;
+
+	const internal::MemcpyPushQueueFunctor memcpyPushQueueFunctor {data, size};
+	// raw elements need no destruction, so dropping the oldest one only advances the read position
+	const auto dropFunctor = internal::makeBoundQueueFunctor(
+			[](void*)
+			{
+
+			});
+	return fifoQueueBase_.pushOverwrite(memcpyPushQueueFunctor, dropFunctor);
+}
+
 int RawFifoQueue::tryPop(void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
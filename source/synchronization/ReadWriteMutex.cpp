@@ -0,0 +1,131 @@
+/**
+ * \file
+ * \brief ReadWriteMutex class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/ReadWriteMutex.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int ReadWriteMutex::lock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	int ret;
+	// break the loop when one of following conditions is true:
+	// - lock successful or deadlock detected;
+	// - lock transferred successfully;
+	while ((ret = doTryLock()) == EBUSY && (ret = doBlock(true)) == EINTR);
+	return ret;
+}
+
+int ReadWriteMutex::lockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	int ret;
+	// break the loop when lock is successful, not possible or deadlock is detected - readers are only unblocked, so
+	// they need to retry
+	while ((ret = doTryLockShared()) == EBUSY && ((ret = doBlock(false)) == 0 || ret == EINTR));
+	return ret;
+}
+
+int ReadWriteMutex::tryLock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	const auto ret = doTryLock();
+	return ret != EDEADLK ? ret : EBUSY;
+}
+
+int ReadWriteMutex::tryLockFor(const TickClock::duration duration)
+{
+	return tryLockUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int ReadWriteMutex::tryLockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	const auto ret = doTryLockShared();
+	return ret != EDEADLK ? ret : EBUSY;
+}
+
+int ReadWriteMutex::tryLockSharedFor(const TickClock::duration duration)
+{
+	return tryLockSharedUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int ReadWriteMutex::tryLockSharedUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	int ret;
+	// break the loop when lock is successful, not possible, deadlock is detected or timeout expired - readers are only
+	// unblocked, so they need to retry
+	while ((ret = doTryLockShared()) == EBUSY && ((ret = doBlockUntil(false, timePoint)) == 0 || ret == EINTR));
+	return ret;
+}
+
+int ReadWriteMutex::tryLockUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	int ret;
+	// break the loop when one of following conditions is true:
+	// - lock successful or deadlock detected;
+	// - lock transferred successfully;
+	// - timeout expired;
+	while ((ret = doTryLock()) == EBUSY && (ret = doBlockUntil(true, timePoint)) == EINTR);
+
+	// readers may have been blocked only because this writer was waiting
+	if (ret == ETIMEDOUT)
+		doReleaseReaders();
+
+	return ret;
+}
+
+int ReadWriteMutex::unlock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return doUnlock();
+}
+
+int ReadWriteMutex::unlockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return doUnlockShared();
+}
+
+}	// namespace distortos
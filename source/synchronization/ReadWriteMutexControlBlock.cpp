@@ -0,0 +1,267 @@
+/**
+ * \file
+ * \brief ReadWriteMutexControlBlock class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/ReadWriteMutexControlBlock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ReadWriteMutexControlBlockUnblockFunctor is a functor executed when unblocking a thread that is blocked on a
+/// read-write mutex
+class ReadWriteMutexControlBlockUnblockFunctor : public UnblockFunctor
+{
+public:
+
+	/**
+	 * \brief ReadWriteMutexControlBlockUnblockFunctor's constructor
+	 *
+	 * \param [in] readWriteMutexControlBlock is a reference to ReadWriteMutexControlBlock that blocked the thread
+	 */
+
+	constexpr explicit ReadWriteMutexControlBlockUnblockFunctor(
+			const ReadWriteMutexControlBlock& readWriteMutexControlBlock) :
+					readWriteMutexControlBlock_{readWriteMutexControlBlock}
+	{
+
+	}
+
+	/**
+	 * \brief ReadWriteMutexControlBlockUnblockFunctor's function call operator
+	 *
+	 * Pointer to ReadWriteMutexControlBlock which caused the thread to block is reset to nullptr. If the wait for
+	 * read-write mutex was interrupted, requests update of boosted priority of all current owners of the read-write
+	 * mutex.
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
+	 * \param [in] unblockReason is the reason of thread unblocking
+	 */
+
+	void operator()(ThreadControlBlock& threadControlBlock, const UnblockReason unblockReason) const override
+	{
+		threadControlBlock.setPriorityInheritanceReadWriteMutexControlBlock(nullptr);
+
+		if (unblockReason != UnblockReason::unblockRequest)
+			readWriteMutexControlBlock_.updateOwnersBoostedPriority();
+	}
+
+private:
+
+	/// reference to ReadWriteMutexControlBlock that blocked the thread
+	const ReadWriteMutexControlBlock& readWriteMutexControlBlock_;
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint8_t ReadWriteMutexControlBlock::getBoostedPriority() const
+{
+	uint8_t boostedPriority {};
+
+	if (writersBlockedList_.empty() == false)
+		boostedPriority = writersBlockedList_.front().getEffectivePriority();
+
+	if (readersBlockedList_.empty() == false)
+		boostedPriority = std::max(boostedPriority, readersBlockedList_.front().getEffectivePriority());
+
+	return boostedPriority;
+}
+
+void ReadWriteMutexControlBlock::updateOwnersBoostedPriority(const uint8_t boostedPriority) const
+{
+	if (writer_.getOwner() != nullptr)
+	{
+		writer_.getOwner()->updateBoostedPriority(boostedPriority);
+		return;
+	}
+
+	for (size_t i {}; i < maxReaders_; ++i)
+		if (readers_[i].getOwner() != nullptr)
+			readers_[i].getOwner()->updateBoostedPriority(boostedPriority);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| protected functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int ReadWriteMutexControlBlock::doBlock(const bool writer)
+{
+	beforeBlock();
+
+	const ReadWriteMutexControlBlockUnblockFunctor unblockFunctor {*this};
+	return getScheduler().block(writer == true ? writersBlockedList_ : readersBlockedList_,
+			ThreadState::blockedOnReadWriteMutex, &unblockFunctor);
+}
+
+int ReadWriteMutexControlBlock::doBlockUntil(const bool writer, const TickClock::time_point timePoint)
+{
+	beforeBlock();
+
+	const ReadWriteMutexControlBlockUnblockFunctor unblockFunctor {*this};
+	return getScheduler().blockUntil(writer == true ? writersBlockedList_ : readersBlockedList_,
+			ThreadState::blockedOnReadWriteMutex, timePoint, &unblockFunctor);
+}
+
+void ReadWriteMutexControlBlock::doReleaseReaders()
+{
+	if (writer_.getOwner() != nullptr || writersBlockedList_.empty() == false)
+		return;
+
+	while (readersBlockedList_.empty() == false)
+		getScheduler().unblock(readersBlockedList_.begin());
+}
+
+int ReadWriteMutexControlBlock::doTryLock()
+{
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+
+	if (writer_.getOwner() == &currentThreadControlBlock || findReader(&currentThreadControlBlock) != nullptr)
+		return EDEADLK;
+
+	if (writer_.getOwner() != nullptr || readersCount_ != 0)
+		return EBUSY;
+
+	writer_.setOwner(*this, &currentThreadControlBlock);
+	currentThreadControlBlock.getOwnedReadWriteMutexList().push_front(writer_);
+	return 0;
+}
+
+int ReadWriteMutexControlBlock::doTryLockShared()
+{
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+
+	if (writer_.getOwner() == &currentThreadControlBlock)
+		return EDEADLK;
+
+	// recursive shared lock is always possible, otherwise the reader would deadlock with blocked writer
+	const auto reader = findReader(&currentThreadControlBlock);
+	if (reader != nullptr)
+	{
+		if (reader->getLocksCount() == std::numeric_limits<ReadWriteMutexOwnership::LocksCount>::max())
+			return EAGAIN;
+
+		++reader->getLocksCount();
+		return 0;
+	}
+
+	// writers are preferred, so shared lock is not possible if any of them waits for the read-write mutex
+	if (writer_.getOwner() != nullptr || writersBlockedList_.empty() == false)
+		return EBUSY;
+
+	const auto freeReader = findReader(nullptr);
+	if (freeReader == nullptr)
+		return EAGAIN;
+
+	freeReader->setOwner(*this, &currentThreadControlBlock);
+	currentThreadControlBlock.getOwnedReadWriteMutexList().push_front(*freeReader);
+	++readersCount_;
+	return 0;
+}
+
+int ReadWriteMutexControlBlock::doUnlock()
+{
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+
+	if (writer_.getOwner() != &currentThreadControlBlock)
+		return EPERM;
+
+	writer_.node.unlink();
+	writer_.setOwner(*this, nullptr);
+
+	if (writersBlockedList_.empty() == false)
+		doTransferLock();
+	else
+		while (readersBlockedList_.empty() == false)
+			getScheduler().unblock(readersBlockedList_.begin());
+
+	currentThreadControlBlock.updateBoostedPriority();
+	return 0;
+}
+
+int ReadWriteMutexControlBlock::doUnlockShared()
+{
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+
+	const auto reader = findReader(&currentThreadControlBlock);
+	if (reader == nullptr)
+		return EPERM;
+
+	if (--reader->getLocksCount() != 0)
+		return 0;
+
+	reader->node.unlink();
+	reader->setOwner(*this, nullptr);
+	--readersCount_;
+
+	if (readersCount_ == 0 && writersBlockedList_.empty() == false)
+		doTransferLock();
+
+	currentThreadControlBlock.updateBoostedPriority();
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ReadWriteMutexControlBlock::beforeBlock() const
+{
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+
+	currentThreadControlBlock.setPriorityInheritanceReadWriteMutexControlBlock(this);
+
+	// calling thread is not yet on the blocked list, that's why it's effective priority is given explicitly
+	updateOwnersBoostedPriority(currentThreadControlBlock.getEffectivePriority());
+}
+
+void ReadWriteMutexControlBlock::doTransferLock()
+{
+	auto& owner = writersBlockedList_.front();	// pass ownership to the unblocked thread
+	writer_.setOwner(*this, &owner);
+	owner.getOwnedReadWriteMutexList().push_front(writer_);
+	getScheduler().unblock(writersBlockedList_.begin());
+
+	// other threads may still be blocked on this read-write mutex
+	owner.updateBoostedPriority();
+}
+
+ReadWriteMutexOwnership* ReadWriteMutexControlBlock::findReader(const ThreadControlBlock* const owner) const
+{
+	for (size_t i {}; i < maxReaders_; ++i)
+		if (readers_[i].getOwner() == owner)
+			return &readers_[i];
+
+	return {};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \brief RecordBuffer class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/RecordBuffer.hpp"
+
+#include <cstring>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t RecordBuffer::getFirstRecordSize()
+{
+	auto readBlock = circularBuffer_.getReadBlock();
+	Header header;
+	memcpy(&header, readBlock.first, headerSize);
+	if (header != paddingHeader)
+		return header;
+
+	// padding always extends to the end of storage and is followed by a record at the beginning of storage
+	circularBuffer_.increaseReadPosition(readBlock.second);
+	readBlock = circularBuffer_.getReadBlock();
+	memcpy(&header, readBlock.first, headerSize);
+	return header;
+}
+
+size_t RecordBuffer::pop(void* const buffer)
+{
+	const auto size = getFirstRecordSize();
+	const auto readBlock = circularBuffer_.getReadBlock();
+	memcpy(buffer, static_cast<const uint8_t*>(readBlock.first) + headerSize, size);
+	circularBuffer_.increaseReadPosition(getFootprint(size));
+
+	if (circularBuffer_.isEmpty() == true)
+		circularBuffer_.clear();
+
+	return size;
+}
+
+bool RecordBuffer::tryPush(const void* const data, const size_t size)
+{
+	const auto footprint = getFootprint(size);
+	auto writeBlock = circularBuffer_.getWriteBlock();
+	if (writeBlock.second < footprint)
+	{
+		if (writeBlock.second == 0)	// buffer is full
+			return false;
+
+		// empty buffer always has write block spanning whole storage, so here read block is valid
+		const auto readBlock = circularBuffer_.getReadBlock();
+		// write block reaches the end of storage only if it doesn't precede read block
+		if (readBlock.first > writeBlock.first)
+			return false;
+
+		const auto storageBegin = static_cast<uint8_t*>(writeBlock.first) + writeBlock.second - getCapacity();
+		if (static_cast<size_t>(static_cast<const uint8_t*>(readBlock.first) - storageBegin) < footprint)
+			return false;
+
+		const Header header {paddingHeader};
+		memcpy(writeBlock.first, &header, headerSize);
+		circularBuffer_.increaseWritePosition(writeBlock.second);
+		writeBlock = circularBuffer_.getWriteBlock();
+	}
+
+	const Header header {size};
+	memcpy(writeBlock.first, &header, headerSize);
+	memcpy(static_cast<uint8_t*>(writeBlock.first) + headerSize, data, size);
+	circularBuffer_.increaseWritePosition(footprint);
+	return true;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
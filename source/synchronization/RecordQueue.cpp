@@ -0,0 +1,154 @@
+/**
+ * \file
+ * \brief RecordQueue class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/RecordQueue.hpp"
+
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitForFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RecordQueue::RecordQueue(StorageUniquePointer&& storageUniquePointer, const size_t storageSize) :
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		recordBuffer_{storageUniquePointer_.get(), storageSize},
+		popSemaphore_{0, recordBuffer_.getMaxRecords()},
+		pushSemaphore_{0, 1}
+{
+
+}
+
+int RecordQueue::pop(void* const buffer, const size_t size, size_t& recordSize)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popInternal(semaphoreWaitFunctor, buffer, size, recordSize);
+}
+
+int RecordQueue::push(const void* const data, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return pushInternal(semaphoreWaitFunctor, data, size);
+}
+
+int RecordQueue::tryPop(void* const buffer, const size_t size, size_t& recordSize)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popInternal(semaphoreTryWaitFunctor, buffer, size, recordSize);
+}
+
+int RecordQueue::tryPopFor(const TickClock::duration duration, void* const buffer, const size_t size,
+		size_t& recordSize)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popInternal(semaphoreTryWaitForFunctor, buffer, size, recordSize);
+}
+
+int RecordQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size,
+		size_t& recordSize)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popInternal(semaphoreTryWaitUntilFunctor, buffer, size, recordSize);
+}
+
+int RecordQueue::tryPush(const void* const data, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return pushInternal(semaphoreTryWaitFunctor, data, size);
+}
+
+int RecordQueue::tryPushFor(const TickClock::duration duration, const void* const data, const size_t size)
+{
+	// waiting for free space may be repeated, so relative timeout must be converted to absolute one
+	return tryPushUntil(TickClock::now() + duration + TickClock::duration{1}, data, size);
+}
+
+int RecordQueue::tryPushUntil(const TickClock::time_point timePoint, const void* const data, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return pushInternal(semaphoreTryWaitUntilFunctor, data, size);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int RecordQueue::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* const buffer,
+		const size_t size, size_t& recordSize)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	{
+		const auto ret = waitSemaphoreFunctor(popSemaphore_);
+		if (ret != 0)
+			return ret;
+	}
+
+	recordSize = recordBuffer_.getFirstRecordSize();
+	if (recordSize > size)
+	{
+		// the record stays in the queue, so give back the "pop" semaphore
+		const auto ret = popSemaphore_.post();
+		return ret != 0 ? ret : EMSGSIZE;
+	}
+
+	recordBuffer_.pop(buffer);
+	return pushSemaphore_.getValue() == 0 ? pushSemaphore_.post() : 0;
+}
+
+int RecordQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* const data,
+		const size_t size)
+{
+	if (size > recordBuffer_.getMaxRecordSize())
+		return EMSGSIZE;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (recordBuffer_.tryPush(data, size) == false)
+	{
+		const auto ret = waitSemaphoreFunctor(pushSemaphore_);
+		if (ret != 0)
+			return ret;
+	}
+
+	// some free space is left, so allow another waiting thread to check whether its record fits
+	if (recordBuffer_.isFull() == false && pushSemaphore_.getValue() == 0)
+	{
+		const auto ret = pushSemaphore_.post();
+		if (ret != 0)
+			return ret;
+	}
+
+	return popSemaphore_.post();
+}
+
+}	// namespace distortos
@@ -0,0 +1,234 @@
+/**
+ * \file
+ * \brief StreamBuffer class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/StreamBuffer.hpp"
+
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+
+#include <cstring>
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+StreamBuffer::StreamBuffer(StorageUniquePointer&& storageUniquePointer, const size_t storageSize,
+		const size_t triggerLevel) :
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		circularBuffer_{storageUniquePointer_.get(), storageSize},
+		readSemaphore_{0, 1},
+		writeSemaphore_{0, 1},
+		readThreshold_{},
+		writeThreshold_{},
+		triggerLevel_{std::min(std::max(triggerLevel, size_t{1}), storageSize)}
+{
+
+}
+
+void StreamBuffer::increaseReadPosition(const size_t size)
+{
+	circularBuffer_.increaseReadPosition(size);
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto writeThreshold = writeThreshold_;
+	if (writeThreshold != 0 && getCapacity() - circularBuffer_.getSize() >= writeThreshold &&
+			writeSemaphore_.getValue() == 0)
+		writeSemaphore_.post();
+}
+
+std::pair<int, size_t> StreamBuffer::read(void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return readInternal(semaphoreWaitFunctor, buffer, size);
+}
+
+int StreamBuffer::setTriggerLevel(const size_t triggerLevel)
+{
+	if (triggerLevel == 0 || triggerLevel > getCapacity())
+		return EINVAL;
+
+	triggerLevel_ = triggerLevel;
+	return 0;
+}
+
+std::pair<int, size_t> StreamBuffer::tryRead(void* const buffer, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return readInternal(semaphoreTryWaitFunctor, buffer, size);
+}
+
+std::pair<int, size_t> StreamBuffer::tryReadFor(const TickClock::duration duration, void* const buffer,
+		const size_t size)
+{
+	// waiting for data may be repeated, so relative timeout must be converted to absolute one
+	return tryReadUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size);
+}
+
+std::pair<int, size_t> StreamBuffer::tryReadUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return readInternal(semaphoreTryWaitUntilFunctor, buffer, size);
+}
+
+int StreamBuffer::tryWaitFor(const TickClock::duration duration)
+{
+	// waiting for data may be repeated, so relative timeout must be converted to absolute one
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int StreamBuffer::tryWaitUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return waitInternal(semaphoreTryWaitUntilFunctor, triggerLevel_);
+}
+
+std::pair<int, size_t> StreamBuffer::tryWrite(const void* const buffer, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	const auto ret = writeInternal(semaphoreTryWaitFunctor, buffer, size);
+	// non-blocking write fails only if nothing could be written
+	return {ret.second != 0 ? 0 : ret.first, ret.second};
+}
+
+std::pair<int, size_t> StreamBuffer::tryWriteFor(const TickClock::duration duration, const void* const buffer,
+		const size_t size)
+{
+	// waiting for free space may be repeated, so relative timeout must be converted to absolute one
+	return tryWriteUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size);
+}
+
+std::pair<int, size_t> StreamBuffer::tryWriteUntil(const TickClock::time_point timePoint, const void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return writeInternal(semaphoreTryWaitUntilFunctor, buffer, size);
+}
+
+int StreamBuffer::wait()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return waitInternal(semaphoreWaitFunctor, triggerLevel_);
+}
+
+std::pair<int, size_t> StreamBuffer::write(const void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return writeInternal(semaphoreWaitFunctor, buffer, size);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, size_t> StreamBuffer::readInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		void* const buffer, const size_t size)
+{
+	{
+		const auto ret = waitInternal(waitSemaphoreFunctor, std::min(triggerLevel_, size));
+		// when the wait fails, read whatever is available
+		if (ret != 0 && circularBuffer_.isEmpty() == true)
+			return {ret, {}};
+	}
+
+	const auto output = static_cast<uint8_t*>(buffer);
+	size_t bytesRead {};
+	decltype(getReadBlock()) readBlock;
+	while (bytesRead < size && (readBlock = getReadBlock()).second != 0)
+	{
+		const auto copySize = std::min(readBlock.second, size - bytesRead);
+		memcpy(output + bytesRead, readBlock.first, copySize);
+		increaseReadPosition(copySize);
+		bytesRead += copySize;
+	}
+
+	return {{}, bytesRead};
+}
+
+int StreamBuffer::waitInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const size_t size)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (circularBuffer_.getSize() < size)
+	{
+		readThreshold_ = size;
+		const auto ret = waitSemaphoreFunctor(readSemaphore_);
+		readThreshold_ = {};
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+std::pair<int, size_t> StreamBuffer::writeInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const void* const buffer, const size_t size)
+{
+	const auto input = static_cast<const uint8_t*>(buffer);
+	size_t bytesWritten {};
+	while (1)
+	{
+		decltype(circularBuffer_.getWriteBlock()) writeBlock;
+		while (bytesWritten < size && (writeBlock = circularBuffer_.getWriteBlock()).second != 0)
+		{
+			const auto copySize = std::min(writeBlock.second, size - bytesWritten);
+			memcpy(writeBlock.first, input + bytesWritten, copySize);
+			circularBuffer_.increaseWritePosition(copySize);
+			bytesWritten += copySize;
+		}
+
+		const InterruptMaskingLock interruptMaskingLock;
+
+		const auto readThreshold = readThreshold_;
+		if (readThreshold != 0 && circularBuffer_.getSize() >= readThreshold && readSemaphore_.getValue() == 0)
+			readSemaphore_.post();
+
+		if (bytesWritten == size)
+			return {{}, bytesWritten};
+
+		// wait until the rest of data fits, but don't require more than whole buffer
+		const auto writeThreshold = std::min(size - bytesWritten, getCapacity());
+		while (getCapacity() - circularBuffer_.getSize() < writeThreshold)
+		{
+			writeThreshold_ = writeThreshold;
+			const auto ret = waitSemaphoreFunctor(writeSemaphore_);
+			writeThreshold_ = {};
+			if (ret != 0)
+				return {ret, bytesWritten};
+		}
+	}
+}
+
+}	// namespace distortos
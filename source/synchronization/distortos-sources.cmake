@@ -8,18 +8,30 @@
 #
 
 target_sources(distortos PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/BroadcastQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/BufferLoanQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ConditionVariable.cpp
+		${CMAKE_CURRENT_LIST_DIR}/DynamicBroadcastQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/DynamicBufferLoanQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicRawFifoQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicRawMessageQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/DynamicRecordQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicSignalsReceiver.cpp
+		${CMAKE_CURRENT_LIST_DIR}/DynamicStreamBuffer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/FifoQueueBase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getProfiledMutexList.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MemcpyPopQueueFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MemcpyPushQueueFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MessageQueueBase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MutexControlBlock.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Mutex.cpp
+		${CMAKE_CURRENT_LIST_DIR}/MutexProfile.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RawFifoQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RawMessageQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ReadWriteMutexControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ReadWriteMutex.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RecordBuffer.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RecordQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Semaphore.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SemaphoreTryWaitForFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SemaphoreTryWaitFunctor.cpp
@@ -29,4 +41,5 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/SignalsCatcherControlBlock.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SignalSet.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SignalsReceiverControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/StreamBuffer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThisThread-Signals.cpp)
@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief getProfiledMutexList() definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/getProfiledMutexList.hpp"
+
+#if DISTORTOS_MUTEX_PROFILING_ENABLE == 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of ProfiledMutexList
+ProfiledMutexList profiledMutexListInstance;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_MUTEX_PROFILING_ENABLE == 1
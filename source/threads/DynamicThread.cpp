@@ -13,6 +13,9 @@
 
 #ifdef DISTORTOS_THREAD_DETACH_ENABLE
 
+#include "distortos/internal/memory/getThreadRecyclingCache.hpp"
+#include "distortos/internal/memory/ThreadRecyclingCache.hpp"
+
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
@@ -213,6 +216,15 @@ int DynamicThread::start()
 	return detachableThread_->start();
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t trimThreadRecyclingCache()
+{
+	return internal::getThreadRecyclingCache().trim();
+}
+
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThreadBase class implementation
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,7 +14,9 @@
 #if DISTORTOS_THREAD_DETACH_ENABLE == 1
 
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
+#include "distortos/internal/memory/getThreadRecyclingCache.hpp"
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
+#include "distortos/internal/memory/ThreadRecyclingCache.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/InterruptMaskingLock.hpp"
@@ -29,6 +31,102 @@ namespace distortos
 namespace internal
 {
 
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// Layout struct has sizes and offsets of elements placed in single block of memory
+struct Layout
+{
+	/// size of stack with size of "stack guard", adjusted to alignment requirements, bytes
+	size_t stackSize;
+
+#if DISTORTOS_SIGNALS_ENABLE == 1
+
+	/// offset of storage for queued signals, bytes
+	size_t queuedSignalsOffset;
+
+	/// max number of queued signals
+	size_t queuedSignals;
+
+	/// offset of storage for SignalAction associations, bytes
+	size_t signalActionsOffset;
+
+	/// max number of different SignalAction objects
+	size_t signalActions;
+
+#endif	// DISTORTOS_SIGNALS_ENABLE == 1
+
+	/// size of whole block, bytes
+	size_t blockSize;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Rounds value up to a multiple of alignment.
+ *
+ * \param [in] value is the value which will be rounded up
+ * \param [in] alignment is the required alignment
+ *
+ * \return \a value rounded up to a multiple of \a alignment
+ */
+
+constexpr size_t alignUp(const size_t value, const size_t alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * \brief Calculates layout of single block of memory for stack and storage for signals.
+ *
+ * \param [in] offset is the offset of stack in the block, bytes
+ * \param [in] stackSize is the size of stack, bytes
+ * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false)
+ * \param [in] queuedSignals is the max number of queued signals, relevant only if \a canReceiveSignals == true
+ * \param [in] signalActions is the max number of different SignalAction objects, relevant only if
+ * \a canReceiveSignals == true
+ *
+ * \return Layout struct for the block
+ */
+
+#if DISTORTOS_SIGNALS_ENABLE == 1
+
+Layout getLayout(const size_t offset, const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
+		const size_t signalActions)
+{
+	static_assert(alignof(max_align_t) >= alignof(SignalInformationQueueWrapper::Storage) &&
+			alignof(max_align_t) >= alignof(SignalsCatcher::Storage),
+			"Alignment of dynamically allocated memory is too low!");
+
+	const auto adjustedStackSize = alignUp(stackSize, DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT) + stackGuardSize;
+	const auto adjustedQueuedSignals = canReceiveSignals == true ? queuedSignals : 0;
+	const auto adjustedSignalActions = canReceiveSignals == true ? signalActions : 0;
+	const auto queuedSignalsOffset =
+			alignUp(offset + adjustedStackSize, alignof(SignalInformationQueueWrapper::Storage));
+	const auto signalActionsOffset = alignUp(queuedSignalsOffset +
+			adjustedQueuedSignals * sizeof(SignalInformationQueueWrapper::Storage), alignof(SignalsCatcher::Storage));
+	return {adjustedStackSize, queuedSignalsOffset, adjustedQueuedSignals, signalActionsOffset, adjustedSignalActions,
+			signalActionsOffset + adjustedSignalActions * sizeof(SignalsCatcher::Storage)};
+}
+
+#else	// DISTORTOS_SIGNALS_ENABLE != 1
+
+Layout getLayout(const size_t offset, const size_t stackSize, bool, size_t, size_t)
+{
+	const auto adjustedStackSize = alignUp(stackSize, DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT) + stackGuardSize;
+	return {adjustedStackSize, offset + adjustedStackSize};
+}
+
+#endif	// DISTORTOS_SIGNALS_ENABLE != 1
+
+}	// namespace
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -49,6 +147,11 @@ int DynamicThreadBase::detach()
 	return ret == EINVAL ? 0 : ret;
 }
 
+void DynamicThreadBase::operator delete(void* const pointer)
+{
+	getThreadRecyclingCache().deallocate(pointer);
+}
+
 #endif	// DISTORTOS_THREAD_DETACH_ENABLE == 1
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -81,6 +184,57 @@ void DynamicThreadBase::run()
 	boundFunction_ = {};
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#if DISTORTOS_THREAD_DETACH_ENABLE == 1
+
+uint8_t* DynamicThreadBase::allocateBlock(const size_t size, const MemoryCapabilities memoryCapabilities)
+{
+	// cleanup only lets this allocation reuse memory of detached threads which already terminated, so its failure is
+	// not an error - it fails only when one of its mutexes is locked by another thread, then the threads will be
+	// deleted by next allocation or by idle thread
+	static_cast<void>(getDeferredThreadDeleter().tryCleanup());
+	return static_cast<uint8_t*>(getThreadRecyclingCache().allocate(size, memoryCapabilities));
+}
+
+#endif	// DISTORTOS_THREAD_DETACH_ENABLE == 1
+
+size_t DynamicThreadBase::getBlockSize(const size_t offset, const size_t stackSize, const bool canReceiveSignals,
+		const size_t queuedSignals, const size_t signalActions)
+{
+	return getLayout(offset, stackSize, canReceiveSignals, queuedSignals, signalActions).blockSize;
+}
+
+DynamicThreadBase::Storage DynamicThreadBase::makeStorage(uint8_t* const block, const size_t offset,
+		void (& deleter)(void*), const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
+		const size_t signalActions)
+{
+	static_assert(alignof(max_align_t) >= DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT,
+			"Alignment of dynamically allocated memory is too low!");
+
+	const auto layout = getLayout(offset, stackSize, canReceiveSignals, queuedSignals, signalActions);
+
+#if DISTORTOS_SIGNALS_ENABLE == 1
+
+	return {{{block + offset, deleter}, layout.stackSize},
+			layout.queuedSignals != 0 ?
+					reinterpret_cast<SignalInformationQueueWrapper::Storage*>(block + layout.queuedSignalsOffset) :
+					nullptr,
+			layout.queuedSignals,
+			layout.signalActions != 0 ?
+					reinterpret_cast<SignalsCatcher::Storage*>(block + layout.signalActionsOffset) : nullptr,
+			layout.signalActions,
+			canReceiveSignals};
+
+#else	// DISTORTOS_SIGNALS_ENABLE != 1
+
+	return {{{block + offset, deleter}, layout.stackSize}};
+
+#endif	// DISTORTOS_SIGNALS_ENABLE != 1
+}
+
 }	// namespace internal
 
 }	// namespace distortos
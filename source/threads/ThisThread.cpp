@@ -41,6 +41,17 @@ int detach()
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
 
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+int enablePrivateReent()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().enablePrivateReent();
+}
+
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
 void exit()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -94,6 +105,13 @@ size_t getStackSize()
 	return get().getStackSize();
 }
 
+TickClock::duration getTimerSlack()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().getTimerSlack();
+}
+
 void setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -108,6 +126,13 @@ void setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 	internal::getScheduler().getCurrentThreadControlBlock().setSchedulingPolicy(schedulingPolicy);
 }
 
+void setTimerSlack(const TickClock::duration timerSlack)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	internal::getScheduler().getCurrentThreadControlBlock().setTimerSlack(timerSlack);
+}
+
 int sleepFor(const TickClock::duration duration)
 {
 	return sleepUntil(TickClock::now() + duration + TickClock::duration{1});
@@ -0,0 +1,86 @@
+/**
+ * \file
+ * \brief setThreadLocalDestructor() and runThreadLocalDestructors() definitions
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/ThreadLocal.hpp"
+
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+#include "distortos/internal/scheduler/runThreadLocalDestructors.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max number of passes over slots of thread-local storage when thread exits
+constexpr size_t destructorIterations {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// destructors of slots of thread-local storage
+void (* threadLocalDestructors[DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS])(void*);
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int setThreadLocalDestructor(const size_t slot, void (* const destructor)(void*))
+{
+	if (slot >= DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS)
+		return EINVAL;
+
+	threadLocalDestructors[slot] = destructor;
+	return 0;
+}
+
+namespace internal
+{
+
+void runThreadLocalDestructors(ThreadControlBlock& threadControlBlock)
+{
+	for (size_t iteration {}; iteration < destructorIterations; ++iteration)
+	{
+		bool executed {};
+
+		for (size_t slot {}; slot < DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS; ++slot)
+		{
+			auto& pointer = threadControlBlock.getThreadLocalSlot(slot);
+			const auto destructor = threadLocalDestructors[slot];
+			if (pointer == nullptr || destructor == nullptr)
+				continue;
+
+			const auto value = pointer;
+			pointer = nullptr;
+			destructor(value);
+			executed = true;
+		}
+
+		if (executed == false)
+			return;
+	}
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
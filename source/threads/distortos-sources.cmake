@@ -14,5 +14,6 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ThreadCommon.cpp
 		${CMAKE_CURRENT_LIST_DIR}/threadExiter.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadIdentifier.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadLocal.cpp
 		${CMAKE_CURRENT_LIST_DIR}/threadRunner.cpp
 		${CMAKE_CURRENT_LIST_DIR}/UndetachableThread.cpp)
@@ -14,6 +14,7 @@
 #include "distortos/internal/scheduler/forceContextSwitch.hpp"
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/RunnableThread.hpp"
+#include "distortos/internal/scheduler/runThreadLocalDestructors.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
@@ -30,6 +31,12 @@ namespace internal
 
 void threadExiter(RunnableThread& runnableThread)
 {
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+	runThreadLocalDestructors(getScheduler().getCurrentThreadControlBlock());
+
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
 	{
 		const InterruptMaskingLock interruptMaskingLock;
 
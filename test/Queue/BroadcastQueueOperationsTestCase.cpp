@@ -0,0 +1,191 @@
+/**
+ * \file
+ * \brief BroadcastQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "BroadcastQueueOperationsTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicBroadcastQueue.hpp"
+#include "distortos/StaticBroadcastQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of queues used in test
+constexpr size_t queueSize {4};
+
+/// number of elements which are overwritten before being received in test
+constexpr size_t lostElements {3};
+
+/// duration used in tests with timeout
+constexpr TickClock::duration singleDuration {1};
+
+/// duration after which software timer pushes the element
+constexpr TickClock::duration longDuration {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests operations on BroadcastQueue in thread context.
+ *
+ * \param [in] broadcastQueue is a reference to tested BroadcastQueue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testThreadContext(BroadcastQueue& broadcastQueue)
+{
+	if (broadcastQueue.getCapacity() != queueSize || broadcastQueue.getElementSize() != sizeof(uint32_t))
+		return false;
+
+	// elements pushed before subscriber was constructed are not received
+	if (broadcastQueue.push(uint32_t{0xffffffff}) != 0)
+		return false;
+
+	BroadcastQueue::Subscriber subscriberA {broadcastQueue};
+	BroadcastQueue::Subscriber subscriberB {broadcastQueue};
+
+	uint32_t value;
+
+	{
+		// subscriber has no pending elements, so tryPop() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = subscriberA.tryPop(value);
+		if (ret != EAGAIN || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// subscriber has no pending elements, so tryPopFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = subscriberA.tryPopFor(singleDuration, &value, sizeof(value));
+		if (ret != ETIMEDOUT || TickClock::now() - start != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		const uint8_t data {};
+		if (broadcastQueue.push(data) != EMSGSIZE || subscriberA.tryPop(&value, sizeof(data)) != EMSGSIZE)
+			return false;
+	}
+
+	for (uint32_t i {}; i < queueSize + lostElements; ++i)
+		if (broadcastQueue.push(i) != 0)
+			return false;
+
+	// subscriber A reads everything that is available, subscriber B lags behind
+	if (subscriberA.getPendingCount() != queueSize)
+		return false;
+	for (uint32_t i {lostElements}; i < queueSize + lostElements; ++i)
+		if (subscriberA.tryPop(value) != 0 || value != i)
+			return false;
+	if (subscriberA.getLagCount() != lostElements || subscriberA.getPendingCount() != 0)
+		return false;
+
+	if (broadcastQueue.push(uint32_t{0x12345678}) != 0)
+		return false;
+
+	if (subscriberA.pop(value) != 0 || value != 0x12345678 || subscriberA.getLagCount() != lostElements)
+		return false;
+
+	for (uint32_t i {lostElements + 1}; i < queueSize + lostElements; ++i)
+		if (subscriberB.pop(value) != 0 || value != i)
+			return false;
+	if (subscriberB.pop(value) != 0 || value != 0x12345678 || subscriberB.getLagCount() != lostElements + 1)
+		return false;
+
+	return subscriberA.tryPop(value) == EAGAIN && subscriberB.tryPop(value) == EAGAIN;
+}
+
+/**
+ * \brief Tests operations on BroadcastQueue unblocked from interrupt context.
+ *
+ * \param [in] broadcastQueue is a reference to tested BroadcastQueue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testInterruptContext(BroadcastQueue& broadcastQueue)
+{
+	BroadcastQueue::Subscriber subscriberA {broadcastQueue};
+	BroadcastQueue::Subscriber subscriberB {broadcastQueue};
+
+	int interruptRet {-1};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&broadcastQueue, &interruptRet]()
+			{
+				interruptRet = broadcastQueue.push(uint32_t{0x5a5a5a5a});
+			});
+
+	waitForNextTick();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer.start(wakeUpTimePoint);
+
+	// subscriber has no pending elements, but pop() should succeed at expected time
+	uint32_t value {};
+	const auto ret = subscriberA.pop(value);
+	if (ret != 0 || wakeUpTimePoint != TickClock::now() || interruptRet != 0 || value != 0x5a5a5a5a)
+		return false;
+
+	// the same element must also be received by other subscriber
+	value = {};
+	return subscriberB.tryPop(value) == 0 && value == 0x5a5a5a5a && subscriberB.getLagCount() == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool BroadcastQueueOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		StaticBroadcastQueue<sizeof(uint32_t), queueSize> staticBroadcastQueue;
+		if (testThreadContext(staticBroadcastQueue) != true || testInterruptContext(staticBroadcastQueue) != true)
+			return false;
+	}
+
+	{
+		DynamicBroadcastQueue dynamicBroadcastQueue {sizeof(uint32_t), queueSize};
+		if (testThreadContext(dynamicBroadcastQueue) != true || testInterruptContext(dynamicBroadcastQueue) != true)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief BroadcastQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_BROADCASTQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_BROADCASTQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various BroadcastQueue operations.
+ *
+ * Tests pushing (push(), also from interrupt context) and receiving (pop(), tryPop() and tryPopFor()) of elements by
+ * multiple subscribers of both "static" and "dynamic" BroadcastQueue - each subscriber must receive all elements pushed
+ * after it was constructed in FIFO order, subscriber which falls behind must be moved forward with correct lag count,
+ * waiting for elements must time-out at expected time and no memory may be leaked (in case of "dynamic" queue).
+ */
+
+class BroadcastQueueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_BROADCASTQUEUEOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,204 @@
+/**
+ * \file
+ * \brief BufferLoanQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "BufferLoanQueueOperationsTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicBufferLoanQueue.hpp"
+#include "distortos/StaticBufferLoanQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of single buffer used in test, bytes
+constexpr size_t bufferSize {32};
+
+/// number of buffers used in test
+constexpr size_t buffersCount {4};
+
+/// duration used in tests with timeout
+constexpr TickClock::duration singleDuration {1};
+
+/// duration after which software timer sends the buffer
+constexpr TickClock::duration longDuration {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests transfer of all buffers from the pool in thread context.
+ *
+ * \param [in] bufferLoanQueue is a reference to tested BufferLoanQueue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testThreadContext(BufferLoanQueue& bufferLoanQueue)
+{
+	if (bufferLoanQueue.getBufferSize() != bufferSize || bufferLoanQueue.getCapacity() != buffersCount)
+		return false;
+
+	void* buffers[buffersCount] {};
+	for (size_t i {}; i < buffersCount; ++i)
+	{
+		const auto ret = bufferLoanQueue.tryAcquire(buffers[i]);
+		if (ret != 0 || buffers[i] == nullptr)
+			return false;
+		for (size_t j {}; j < i; ++j)
+			if (buffers[j] == buffers[i])
+				return false;
+		memset(buffers[i], static_cast<int>(i + 1), bufferSize);
+	}
+
+	{
+		// pool is empty, so tryAcquire() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		void* buffer {};
+		const auto ret = bufferLoanQueue.tryAcquire(buffer);
+		if (ret != EAGAIN || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// pool is empty, so tryAcquireFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		void* buffer {};
+		const auto ret = bufferLoanQueue.tryAcquireFor(singleDuration, buffer);
+		if (ret != ETIMEDOUT || TickClock::now() - start != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// buffers which don't belong to the pool must be rejected
+		uint8_t foreignBuffer[bufferSize] {};
+		if (bufferLoanQueue.send(foreignBuffer) != EINVAL || bufferLoanQueue.send(nullptr) != EINVAL ||
+				bufferLoanQueue.send(static_cast<uint8_t*>(buffers[0]) + 1) != EINVAL ||
+				bufferLoanQueue.release(foreignBuffer) != EINVAL)
+			return false;
+	}
+
+	for (const auto buffer : buffers)
+		if (bufferLoanQueue.send(buffer) != 0)
+			return false;
+
+	for (size_t i {}; i < buffersCount; ++i)
+	{
+		void* buffer {};
+		const auto ret = bufferLoanQueue.tryReceive(buffer);
+		if (ret != 0 || buffer != buffers[i])
+			return false;
+		for (size_t j {}; j < bufferSize; ++j)
+			if (static_cast<const uint8_t*>(buffer)[j] != i + 1)
+				return false;
+	}
+
+	{
+		// queue is empty, so tryReceive() should fail immediately
+		void* buffer {};
+		if (bufferLoanQueue.tryReceive(buffer) != EAGAIN)
+			return false;
+	}
+
+	for (const auto buffer : buffers)
+		if (bufferLoanQueue.release(buffer) != 0)
+			return false;
+
+	// all buffers are back in the pool, so another release must fail
+	return bufferLoanQueue.release(buffers[0]) == EAGAIN;
+}
+
+/**
+ * \brief Tests transfer of buffer sent from interrupt context.
+ *
+ * \param [in] bufferLoanQueue is a reference to tested BufferLoanQueue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testInterruptContext(BufferLoanQueue& bufferLoanQueue)
+{
+	void* sentBuffer {};
+	int sendRet {-1};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&bufferLoanQueue, &sentBuffer, &sendRet]()
+			{
+				if (bufferLoanQueue.tryAcquire(sentBuffer) != 0)
+					return;
+				memset(sentBuffer, 0x5a, bufferSize);
+				sendRet = bufferLoanQueue.send(sentBuffer);
+			});
+
+	waitForNextTick();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer.start(wakeUpTimePoint);
+
+	// queue is currently empty, but receive() should succeed at expected time
+	void* buffer {};
+	const auto ret = bufferLoanQueue.receive(buffer);
+	if (ret != 0 || sendRet != 0 || wakeUpTimePoint != TickClock::now() || buffer != sentBuffer)
+		return false;
+	for (size_t i {}; i < bufferSize; ++i)
+		if (static_cast<const uint8_t*>(buffer)[i] != 0x5a)
+			return false;
+
+	return bufferLoanQueue.release(buffer) == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool BufferLoanQueueOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		StaticBufferLoanQueue<bufferSize, buffersCount> staticBufferLoanQueue;
+		if (testThreadContext(staticBufferLoanQueue) != true || testInterruptContext(staticBufferLoanQueue) != true)
+			return false;
+	}
+
+	{
+		DynamicBufferLoanQueue dynamicBufferLoanQueue {bufferSize, buffersCount};
+		if (testThreadContext(dynamicBufferLoanQueue) != true || testInterruptContext(dynamicBufferLoanQueue) != true)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
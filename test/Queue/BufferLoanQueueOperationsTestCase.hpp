@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief BufferLoanQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_BUFFERLOANQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_BUFFERLOANQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various BufferLoanQueue operations.
+ *
+ * Tests acquiring (tryAcquire() and tryAcquireFor()), sending (send()), receiving (receive() and tryReceive()) and
+ * releasing (release()) of buffers in both "static" and "dynamic" BufferLoanQueue, also with sending from interrupt
+ * context - these operations must return expected result, transfer the same buffers (which are never copied) in FIFO
+ * order, reject buffers which don't belong to the pool and leak no memory (in case of "dynamic" queue).
+ */
+
+class BufferLoanQueueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_BUFFERLOANQUEUEOPERATIONSTESTCASE_HPP_
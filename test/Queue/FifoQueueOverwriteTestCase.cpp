@@ -0,0 +1,280 @@
+/**
+ * \file
+ * \brief FifoQueueOverwriteTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "FifoQueueOverwriteTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/LatestValueMailbox.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of queues used in test
+constexpr size_t queueSize {4};
+
+/// number of elements pushed to full queues in test
+constexpr size_t overwrittenElements {3};
+
+/// duration after which software timer pushes the element or writes the value
+constexpr TickClock::duration longDuration {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// element of FifoQueue which counts its destructions
+class CountingElement
+{
+public:
+
+	/**
+	 * \brief CountingElement's constructor
+	 *
+	 * \param [in] value is the value held by element
+	 */
+
+	constexpr explicit CountingElement(const uint32_t value = {}) :
+			value_{value}
+	{
+
+	}
+
+	/**
+	 * \brief CountingElement's copy constructor
+	 *
+	 * \param [in] other is a reference to CountingElement object used as source of copy construction
+	 */
+
+	constexpr CountingElement(const CountingElement& other) :
+			value_{other.value_}
+	{
+
+	}
+
+	/**
+	 * \brief CountingElement's destructor
+	 *
+	 * Increments destructions counter.
+	 */
+
+	~CountingElement()
+	{
+		++destructions;
+	}
+
+	/**
+	 * \brief CountingElement's copy assignment
+	 *
+	 * \param [in] other is a reference to CountingElement object used as source of copy assignment
+	 *
+	 * \return reference to this
+	 */
+
+	CountingElement& operator=(const CountingElement& other)
+	{
+		value_ = other.value_;
+		return *this;
+	}
+
+	/**
+	 * \return value held by element
+	 */
+
+	uint32_t getValue() const
+	{
+		return value_;
+	}
+
+	/// number of destructions of CountingElement objects
+	static size_t destructions;
+
+private:
+
+	/// value held by element
+	uint32_t value_;
+};
+
+size_t CountingElement::destructions;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests FifoQueue::pushOverwrite().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testFifoQueue()
+{
+	StaticFifoQueue<CountingElement, queueSize> fifoQueue;
+
+	for (size_t i {}; i < queueSize + overwrittenElements; ++i)
+	{
+		const CountingElement element {static_cast<uint32_t>(i)};
+		const auto destructions = CountingElement::destructions;
+		if (fifoQueue.pushOverwrite(element) != 0)
+			return false;
+		// each push to full queue must destruct exactly one (the oldest) element
+		if (CountingElement::destructions - destructions != (i < queueSize ? 0 : 1))
+			return false;
+	}
+
+	if (fifoQueue.getOverrunCount() != overwrittenElements)
+		return false;
+
+	for (size_t i {overwrittenElements}; i < queueSize + overwrittenElements; ++i)
+	{
+		CountingElement element;
+		if (fifoQueue.tryPop(element) != 0 || element.getValue() != i)
+			return false;
+	}
+
+	{
+		CountingElement element;
+		if (fifoQueue.tryPop(element) != EAGAIN)
+			return false;
+	}
+
+	{
+		int interruptRet {-1};
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&fifoQueue, &interruptRet]()
+				{
+					interruptRet = fifoQueue.pushOverwrite(CountingElement{0x5a});
+				});
+
+		waitForNextTick();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// queue is currently empty, but pop() should succeed at expected time
+		CountingElement element;
+		const auto ret = fifoQueue.pop(element);
+		if (ret != 0 || wakeUpTimePoint != TickClock::now() || interruptRet != 0 || element.getValue() != 0x5a)
+			return false;
+	}
+
+	return fifoQueue.getOverrunCount() == overwrittenElements;
+}
+
+/**
+ * \brief Tests RawFifoQueue::pushOverwrite().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testRawFifoQueue()
+{
+	StaticRawFifoQueue<sizeof(uint32_t), queueSize> rawFifoQueue;
+
+	{
+		const uint8_t data {};
+		if (rawFifoQueue.pushOverwrite(data) != EMSGSIZE)
+			return false;
+	}
+
+	for (size_t i {}; i < queueSize + overwrittenElements; ++i)
+		if (rawFifoQueue.pushOverwrite(static_cast<uint32_t>(i)) != 0)
+			return false;
+
+	if (rawFifoQueue.getOverrunCount() != overwrittenElements)
+		return false;
+
+	for (size_t i {overwrittenElements}; i < queueSize + overwrittenElements; ++i)
+	{
+		uint32_t value;
+		if (rawFifoQueue.tryPop(value) != 0 || value != i)
+			return false;
+	}
+
+	uint32_t value;
+	return rawFifoQueue.tryPop(value) == EAGAIN;
+}
+
+/**
+ * \brief Tests LatestValueMailbox.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testLatestValueMailbox()
+{
+	LatestValueMailbox<uint64_t> latestValueMailbox {0x0123456789abcdef};
+
+	{
+		uint64_t value {};
+		if (latestValueMailbox.read(value) != 0 || value != 0x0123456789abcdef ||
+				latestValueMailbox.getWriteCount() != 0)
+			return false;
+	}
+
+	for (uint64_t i {1}; i <= overwrittenElements; ++i)
+		latestValueMailbox.write(i * 0x1111111111111111);
+
+	{
+		uint64_t value {};
+		if (latestValueMailbox.read(value) != overwrittenElements || value != overwrittenElements * 0x1111111111111111 ||
+				latestValueMailbox.getWriteCount() != overwrittenElements)
+			return false;
+	}
+
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&latestValueMailbox]()
+			{
+				latestValueMailbox.write(0xfedcba9876543210);
+			});
+
+	waitForNextTick();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer.start(wakeUpTimePoint);
+
+	// reader never blocks, so the value must be polled until it is changed by the interrupt
+	uint64_t value {};
+	uint32_t writeCount;
+	while ((writeCount = latestValueMailbox.read(value)) == overwrittenElements)
+		if (value != overwrittenElements * 0x1111111111111111)
+			return false;
+
+	return writeCount == overwrittenElements + 1 && value == 0xfedcba9876543210 && wakeUpTimePoint == TickClock::now();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueOverwriteTestCase::run_() const
+{
+	return testFifoQueue() == true && testRawFifoQueue() == true && testLatestValueMailbox() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief FifoQueueOverwriteTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_FIFOQUEUEOVERWRITETESTCASE_HPP_
+#define TEST_QUEUE_FIFOQUEUEOVERWRITETESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests overwriting push of FIFO queues and LatestValueMailbox.
+ *
+ * Tests pushOverwrite() of FifoQueue and RawFifoQueue - when the queue is full, the oldest element must be dropped (and
+ * destructed in case of FifoQueue), overrun count must be incremented and the remaining elements must be received in
+ * FIFO order. pushOverwrite() from interrupt context must wake up the thread waiting in pop(). LatestValueMailbox must
+ * always return the most recently written value - also written from interrupt context - with matching write count.
+ */
+
+class FifoQueueOverwriteTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_FIFOQUEUEOVERWRITETESTCASE_HPP_
@@ -13,14 +13,13 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/statistics.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -215,7 +214,7 @@ const std::array<Stage, 2> stages
 
 bool FifoQueuePriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 	std::remove_const<decltype(contextSwitchCount)>::type expectedContextSwitchCount {};
 	constexpr size_t fifoQueueTypes {4};
@@ -293,7 +292,7 @@ bool FifoQueuePriorityTestCase::run_() const
 					}
 
 					// dynamic memory must be deallocated after each test phase
-					if (mallinfo().uordblks != allocatedMemory)
+					if (getAllocatedMemory() != allocatedMemory)
 						return false;
 				}
 
@@ -13,6 +13,7 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
@@ -20,8 +21,6 @@
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -221,7 +220,7 @@ const std::array<Stage, 2> stages
 
 bool MessageQueuePriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 	std::remove_const<decltype(contextSwitchCount)>::type expectedContextSwitchCount {};
 	constexpr size_t messageQueueTypes {4};
@@ -305,7 +304,7 @@ bool MessageQueuePriorityTestCase::run_() const
 					}
 
 					// dynamic memory must be deallocated after each test phase
-					if (mallinfo().uordblks != allocatedMemory)
+					if (getAllocatedMemory() != allocatedMemory)
 						return false;
 				}
 
@@ -0,0 +1,273 @@
+/**
+ * \file
+ * \brief RecordQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "RecordQueueOperationsTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicRecordQueue.hpp"
+#include "distortos/StaticRecordQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of storage for records used in test, bytes
+constexpr size_t storageSize {16 * sizeof(size_t)};
+
+/// maximum size of single record used in test, bytes
+constexpr size_t maxRecordSize {storageSize - sizeof(size_t)};
+
+/// duration used in tests with timeout
+constexpr TickClock::duration singleDuration {1};
+
+/// duration after which software timer pushes or pops the record
+constexpr TickClock::duration longDuration {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Fills buffer with a pattern.
+ *
+ * \param [out] buffer is a pointer to buffer which will be filled
+ * \param [in] size is the size of \a buffer, bytes
+ * \param [in] seed is the value of first byte of pattern
+ */
+
+void fillPattern(uint8_t* const buffer, const size_t size, const uint8_t seed)
+{
+	for (size_t i {}; i < size; ++i)
+		buffer[i] = static_cast<uint8_t>(seed + i);
+}
+
+/**
+ * \brief Checks whether buffer contains a pattern.
+ *
+ * \param [in] buffer is a pointer to buffer which will be checked
+ * \param [in] size is the size of \a buffer, bytes
+ * \param [in] seed is the value of first byte of pattern
+ *
+ * \return true if \a buffer contains the pattern, false otherwise
+ */
+
+bool checkPattern(const uint8_t* const buffer, const size_t size, const uint8_t seed)
+{
+	for (size_t i {}; i < size; ++i)
+		if (buffer[i] != static_cast<uint8_t>(seed + i))
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests operations on RecordQueue in thread context.
+ *
+ * \param [in] recordQueue is a reference to tested RecordQueue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testThreadContext(RecordQueue& recordQueue)
+{
+	if (recordQueue.getCapacity() != storageSize || recordQueue.getMaxRecordSize() != maxRecordSize)
+		return false;
+
+	uint8_t buffer[maxRecordSize + 1];
+	size_t recordSize {};
+
+	{
+		// queue is empty, so tryPop() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = recordQueue.tryPop(buffer, sizeof(buffer), recordSize);
+		if (ret != EAGAIN || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// queue is empty, so tryPopFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = recordQueue.tryPopFor(singleDuration, buffer, sizeof(buffer), recordSize);
+		if (ret != ETIMEDOUT || TickClock::now() - start != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	if (recordQueue.tryPush(buffer, maxRecordSize + 1) != EMSGSIZE)
+		return false;
+
+	constexpr size_t recordSizes[] {1, 7, 0, 3 * sizeof(size_t) + 1};
+	for (size_t i {}; i < sizeof(recordSizes) / sizeof(*recordSizes); ++i)
+	{
+		fillPattern(buffer, recordSizes[i], static_cast<uint8_t>(i * 0x10));
+		if (recordQueue.push(buffer, recordSizes[i]) != 0)
+			return false;
+	}
+
+	for (size_t i {}; i < sizeof(recordSizes) / sizeof(*recordSizes); ++i)
+	{
+		if (recordSizes[i] != 0)
+		{
+			// too small buffer - record must be left in the queue and its size must be returned
+			recordSize = {};
+			const auto ret = recordQueue.tryPop(buffer, recordSizes[i] - 1, recordSize);
+			if (ret != EMSGSIZE || recordSize != recordSizes[i])
+				return false;
+		}
+
+		recordSize = {};
+		const auto ret = recordQueue.tryPop(buffer, sizeof(buffer), recordSize);
+		if (ret != 0 || recordSize != recordSizes[i] ||
+				checkPattern(buffer, recordSize, static_cast<uint8_t>(i * 0x10)) == false)
+			return false;
+	}
+
+	fillPattern(buffer, maxRecordSize, 0x5a);
+	if (recordQueue.tryPush(buffer, maxRecordSize) != 0)
+		return false;
+
+	{
+		// queue is full, so tryPush() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = recordQueue.tryPush(buffer, 0);
+		if (ret != EAGAIN || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// queue is full, so tryPushFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = recordQueue.tryPushFor(singleDuration, buffer, 1);
+		if (ret != ETIMEDOUT || TickClock::now() - start != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	recordSize = {};
+	const auto ret = recordQueue.pop(buffer, sizeof(buffer), recordSize);
+	return ret == 0 && recordSize == maxRecordSize && checkPattern(buffer, recordSize, 0x5a) == true;
+}
+
+/**
+ * \brief Tests operations on RecordQueue unblocked from interrupt context.
+ *
+ * \param [in] recordQueue is a reference to tested RecordQueue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testInterruptContext(RecordQueue& recordQueue)
+{
+	uint8_t interruptBuffer[sizeof(size_t)];
+	size_t interruptRecordSize {};
+	int interruptRet {-1};
+
+	{
+		// queue has some free space, but push() of the largest record should succeed only after other record is popped
+		fillPattern(interruptBuffer, 1, 0x33);
+		if (recordQueue.tryPush(interruptBuffer, 1) != 0)
+			return false;
+
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&recordQueue, &interruptBuffer, &interruptRecordSize, &interruptRet]()
+				{
+					interruptRet = recordQueue.tryPop(interruptBuffer, sizeof(interruptBuffer), interruptRecordSize);
+				});
+
+		waitForNextTick();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		uint8_t buffer[maxRecordSize];
+		fillPattern(buffer, sizeof(buffer), 0x77);
+		const auto ret = recordQueue.push(buffer, sizeof(buffer));
+		if (ret != 0 || wakeUpTimePoint != TickClock::now() || interruptRet != 0 || interruptRecordSize != 1 ||
+				checkPattern(interruptBuffer, interruptRecordSize, 0x33) == false)
+			return false;
+
+		size_t recordSize {};
+		if (recordQueue.tryPop(buffer, sizeof(buffer), recordSize) != 0 || recordSize != sizeof(buffer) ||
+				checkPattern(buffer, recordSize, 0x77) == false)
+			return false;
+	}
+
+	{
+		interruptRet = -1;
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&recordQueue, &interruptBuffer, &interruptRet]()
+				{
+					fillPattern(interruptBuffer, sizeof(interruptBuffer), 0x99);
+					interruptRet = recordQueue.tryPush(interruptBuffer, sizeof(interruptBuffer));
+				});
+
+		waitForNextTick();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// queue is currently empty, but pop() should succeed at expected time
+		uint8_t buffer[maxRecordSize];
+		size_t recordSize {};
+		const auto ret = recordQueue.pop(buffer, sizeof(buffer), recordSize);
+		if (ret != 0 || wakeUpTimePoint != TickClock::now() || interruptRet != 0 ||
+				recordSize != sizeof(interruptBuffer) || checkPattern(buffer, recordSize, 0x99) == false)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool RecordQueueOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		StaticRecordQueue<storageSize> staticRecordQueue;
+		if (testThreadContext(staticRecordQueue) != true || testInterruptContext(staticRecordQueue) != true)
+			return false;
+	}
+
+	{
+		DynamicRecordQueue dynamicRecordQueue {storageSize};
+		if (testThreadContext(dynamicRecordQueue) != true || testInterruptContext(dynamicRecordQueue) != true)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief RecordQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_RECORDQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_RECORDQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various RecordQueue operations.
+ *
+ * Tests pushing (push(), tryPush() and tryPushFor()) and popping (pop(), tryPop() and tryPopFor()) of records with
+ * various sizes to/from both "static" and "dynamic" RecordQueue, also from interrupt context - these operations must
+ * return expected result, transfer records of any size in FIFO order, unblock waiting threads when enough free space or
+ * a record becomes available and leak no memory (in case of "dynamic" queue).
+ */
+
+class RecordQueueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_RECORDQUEUEOPERATIONSTESTCASE_HPP_
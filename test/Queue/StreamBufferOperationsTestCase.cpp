@@ -0,0 +1,305 @@
+/**
+ * \file
+ * \brief StreamBufferOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "StreamBufferOperationsTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicStreamBuffer.hpp"
+#include "distortos/StaticStreamBuffer.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of storage for data used in test, bytes
+constexpr size_t storageSize {16};
+
+/// trigger level used in tests with interrupt context, bytes
+constexpr size_t triggerLevel {4};
+
+/// duration used in tests with timeout
+constexpr TickClock::duration singleDuration {1};
+
+/// duration after which software timer reads the data
+constexpr TickClock::duration longDuration {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Fills buffer with a pattern.
+ *
+ * \param [out] buffer is a pointer to buffer which will be filled
+ * \param [in] size is the size of \a buffer, bytes
+ * \param [in] seed is the value of first byte of pattern
+ */
+
+void fillPattern(uint8_t* const buffer, const size_t size, const uint8_t seed)
+{
+	for (size_t i {}; i < size; ++i)
+		buffer[i] = static_cast<uint8_t>(seed + i);
+}
+
+/**
+ * \brief Checks whether buffer contains a pattern.
+ *
+ * \param [in] buffer is a pointer to buffer which will be checked
+ * \param [in] size is the size of \a buffer, bytes
+ * \param [in] seed is the value of first byte of pattern
+ *
+ * \return true if \a buffer contains the pattern, false otherwise
+ */
+
+bool checkPattern(const uint8_t* const buffer, const size_t size, const uint8_t seed)
+{
+	for (size_t i {}; i < size; ++i)
+		if (buffer[i] != static_cast<uint8_t>(seed + i))
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests operations on StreamBuffer in thread context.
+ *
+ * \param [in] streamBuffer is a reference to tested StreamBuffer
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testThreadContext(StreamBuffer& streamBuffer)
+{
+	if (streamBuffer.getCapacity() != storageSize || streamBuffer.getTriggerLevel() != 1 ||
+			streamBuffer.setTriggerLevel(0) != EINVAL || streamBuffer.setTriggerLevel(storageSize + 1) != EINVAL)
+		return false;
+
+	uint8_t buffer[storageSize + storageSize / 2];
+
+	{
+		// buffer is empty, so tryRead() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = streamBuffer.tryRead(buffer, sizeof(buffer));
+		if (ret != std::make_pair(EAGAIN, size_t{}) || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// buffer is empty, so tryReadFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = streamBuffer.tryReadFor(singleDuration, buffer, sizeof(buffer));
+		if (ret != std::make_pair(ETIMEDOUT, size_t{}) ||
+				TickClock::now() - start != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	fillPattern(buffer, sizeof(buffer), 0x10);
+	if (streamBuffer.tryWrite(buffer, sizeof(buffer)) != std::make_pair(0, storageSize) ||
+			streamBuffer.getSize() != storageSize)
+		return false;
+
+	{
+		// buffer is full, so tryWrite() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = streamBuffer.tryWrite(buffer, 1);
+		if (ret != std::make_pair(EAGAIN, size_t{}) || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// buffer is full, so tryWriteFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = streamBuffer.tryWriteFor(singleDuration, buffer, 1);
+		if (ret != std::make_pair(ETIMEDOUT, size_t{}) ||
+				TickClock::now() - start != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// zero-copy access
+		const auto readBlock = streamBuffer.getReadBlock();
+		if (readBlock.second == 0 ||
+				checkPattern(static_cast<const uint8_t*>(readBlock.first), readBlock.second, 0x10) == false)
+			return false;
+
+		streamBuffer.increaseReadPosition(6);
+		if (streamBuffer.getSize() != storageSize - 6)
+			return false;
+	}
+
+	if (streamBuffer.tryRead(buffer, sizeof(buffer)) != std::make_pair(0, storageSize - 6) ||
+			checkPattern(buffer, storageSize - 6, 0x10 + 6) == false)
+		return false;
+
+	{
+		// less than trigger level bytes are available, so tryReadFor() should return them after timeout
+		if (streamBuffer.setTriggerLevel(triggerLevel * 2) != 0)
+			return false;
+
+		fillPattern(buffer, triggerLevel, 0x30);
+		if (streamBuffer.write(buffer, triggerLevel) != std::make_pair(0, triggerLevel))
+			return false;
+
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = streamBuffer.tryReadFor(singleDuration, buffer, sizeof(buffer));
+		if (ret != std::make_pair(0, triggerLevel) ||
+				TickClock::now() - start != singleDuration + decltype(singleDuration){1} ||
+				checkPattern(buffer, triggerLevel, 0x30) == false)
+			return false;
+
+		// read of less than trigger level bytes doesn't wait for more data
+		fillPattern(buffer, triggerLevel, 0x50);
+		if (streamBuffer.write(buffer, triggerLevel) != std::make_pair(0, triggerLevel) ||
+				streamBuffer.read(buffer, triggerLevel) != std::make_pair(0, triggerLevel) ||
+				checkPattern(buffer, triggerLevel, 0x50) == false)
+			return false;
+	}
+
+	// data wraps around the end of storage
+	fillPattern(buffer, storageSize, 0x70);
+	if (streamBuffer.write(buffer, storageSize) != std::make_pair(0, storageSize) ||
+			streamBuffer.read(buffer, sizeof(buffer)) != std::make_pair(0, storageSize) ||
+			checkPattern(buffer, storageSize, 0x70) == false)
+		return false;
+
+	return streamBuffer.setTriggerLevel(1) == 0;
+}
+
+/**
+ * \brief Tests operations on StreamBuffer with the other side in interrupt context.
+ *
+ * \param [in] streamBuffer is a reference to tested StreamBuffer
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testInterruptContext(StreamBuffer& streamBuffer)
+{
+	{
+		// data arrives byte by byte, but reader should be woken only when trigger level is reached
+		if (streamBuffer.setTriggerLevel(triggerLevel) != 0)
+			return false;
+
+		uint8_t interruptByte {0x40};
+		int interruptRet {};
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&streamBuffer, &interruptByte, &interruptRet]()
+				{
+					const auto ret = streamBuffer.tryWrite(&interruptByte, sizeof(interruptByte));
+					if (ret.first != 0)
+						interruptRet = ret.first;
+					++interruptByte;
+				});
+
+		waitForNextTick();
+		const auto start = TickClock::now();
+		softwareTimer.start(start + singleDuration, singleDuration);
+
+		uint8_t buffer[storageSize];
+		const auto ret = streamBuffer.read(buffer, sizeof(buffer));
+		const auto wokenUp = TickClock::now();
+		softwareTimer.stop();
+		if (ret != std::make_pair(0, triggerLevel) || wokenUp - start != triggerLevel * singleDuration ||
+				interruptRet != 0 || checkPattern(buffer, triggerLevel, 0x40) == false)
+			return false;
+
+		// drop the byte which could have been written before the timer was stopped
+		streamBuffer.tryRead(buffer, sizeof(buffer));
+
+		if (streamBuffer.setTriggerLevel(1) != 0)
+			return false;
+	}
+
+	{
+		// buffer is full, so write() should succeed only after interrupt reads some data
+		uint8_t buffer[storageSize];
+		fillPattern(buffer, sizeof(buffer), 0x80);
+		if (streamBuffer.tryWrite(buffer, sizeof(buffer)) != std::make_pair(0, storageSize))
+			return false;
+
+		uint8_t interruptBuffer[storageSize / 2];
+		std::pair<int, size_t> interruptRet {-1, {}};
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&streamBuffer, &interruptBuffer, &interruptRet]()
+				{
+					interruptRet = streamBuffer.tryRead(interruptBuffer, sizeof(interruptBuffer));
+				});
+
+		waitForNextTick();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		fillPattern(buffer, sizeof(interruptBuffer), 0x90);
+		const auto ret = streamBuffer.write(buffer, sizeof(interruptBuffer));
+		if (ret != std::make_pair(0, sizeof(interruptBuffer)) || wakeUpTimePoint != TickClock::now() ||
+				interruptRet != std::make_pair(0, sizeof(interruptBuffer)) ||
+				checkPattern(interruptBuffer, sizeof(interruptBuffer), 0x80) == false)
+			return false;
+
+		if (streamBuffer.tryRead(buffer, sizeof(buffer)) != std::make_pair(0, storageSize) ||
+				checkPattern(buffer, sizeof(interruptBuffer), 0x80 + sizeof(interruptBuffer)) == false ||
+				checkPattern(buffer + sizeof(interruptBuffer), sizeof(interruptBuffer), 0x90) == false)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool StreamBufferOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		StaticStreamBuffer<storageSize> staticStreamBuffer;
+		if (testThreadContext(staticStreamBuffer) != true || testInterruptContext(staticStreamBuffer) != true)
+			return false;
+	}
+
+	{
+		DynamicStreamBuffer dynamicStreamBuffer {storageSize};
+		if (testThreadContext(dynamicStreamBuffer) != true || testInterruptContext(dynamicStreamBuffer) != true)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief StreamBufferOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_STREAMBUFFEROPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_STREAMBUFFEROPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various StreamBuffer operations.
+ *
+ * Tests reading (read(), tryRead(), tryReadFor() and zero-copy access with getReadBlock()) and writing (write(),
+ * tryWrite() and tryWriteFor()) of data in both "static" and "dynamic" StreamBuffer, also with the other side of the
+ * transfer in interrupt context - these operations must return expected result, reader must be woken only when trigger
+ * level is reached or when the timeout expires and no memory may be leaked (in case of "dynamic" buffer).
+ */
+
+class StreamBufferOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_STREAMBUFFEROPERATIONSTESTCASE_HPP_
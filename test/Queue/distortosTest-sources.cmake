@@ -8,8 +8,13 @@
 #
 
 target_sources(distortosTest PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/BroadcastQueueOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/BufferLoanQueueOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/FifoQueueOverwriteTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/FifoQueuePriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MessageQueuePriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/QueueOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/queueTestCases.cpp
-		${CMAKE_CURRENT_LIST_DIR}/QueueWrappers.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/QueueWrappers.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RecordQueueOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/StreamBufferOperationsTestCase.cpp)
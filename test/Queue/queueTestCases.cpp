@@ -12,6 +12,11 @@
 #include "queueTestCases.hpp"
 
 #include "QueueOperationsTestCase.hpp"
+#include "BufferLoanQueueOperationsTestCase.hpp"
+#include "RecordQueueOperationsTestCase.hpp"
+#include "FifoQueueOverwriteTestCase.hpp"
+#include "BroadcastQueueOperationsTestCase.hpp"
+#include "StreamBufferOperationsTestCase.hpp"
 #include "FifoQueuePriorityTestCase.hpp"
 #include "MessageQueuePriorityTestCase.hpp"
 
@@ -39,12 +44,32 @@ const FifoQueuePriorityTestCase fifoQueuePriorityTestCase;
 /// MessageQueuePriorityTestCase instance
 const MessageQueuePriorityTestCase messageQueuePriorityTestCase;
 
+/// BufferLoanQueueOperationsTestCase instance
+const BufferLoanQueueOperationsTestCase bufferLoanQueueOperationsTestCase;
+
+/// RecordQueueOperationsTestCase instance
+const RecordQueueOperationsTestCase recordQueueOperationsTestCase;
+
+/// FifoQueueOverwriteTestCase instance
+const FifoQueueOverwriteTestCase fifoQueueOverwriteTestCase;
+
+/// BroadcastQueueOperationsTestCase instance
+const BroadcastQueueOperationsTestCase broadcastQueueOperationsTestCase;
+
+/// StreamBufferOperationsTestCase instance
+const StreamBufferOperationsTestCase streamBufferOperationsTestCase;
+
 /// array with references to TestCase objects related to queue
 const TestCaseGroup::Range::value_type queueTestCases_[]
 {
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{fifoQueuePriorityTestCase},
 		TestCaseGroup::Range::value_type{messageQueuePriorityTestCase},
+		TestCaseGroup::Range::value_type{bufferLoanQueueOperationsTestCase},
+		TestCaseGroup::Range::value_type{recordQueueOperationsTestCase},
+		TestCaseGroup::Range::value_type{fifoQueueOverwriteTestCase},
+		TestCaseGroup::Range::value_type{broadcastQueueOperationsTestCase},
+		TestCaseGroup::Range::value_type{streamBufferOperationsTestCase},
 };
 
 }	// namespace
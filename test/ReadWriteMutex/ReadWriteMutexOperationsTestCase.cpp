@@ -0,0 +1,356 @@
+/**
+ * \file
+ * \brief ReadWriteMutexOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ReadWriteMutexOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticReadWriteMutex.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// priority of current test thread and all test threads
+constexpr uint8_t testThreadPriority {ReadWriteMutexOperationsTestCase::getTestCasePriority()};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Thread that locks the read-write mutex, waits for the semaphore and unlocks the read-write mutex.
+ *
+ * \param [in] readWriteMutex is a reference to read-write mutex that will be locked and unlocked
+ * \param [in] shared selects whether the read-write mutex will be locked in shared mode (true) or exclusively (false)
+ * \param [in] semaphore is a reference to semaphore which will be waited for before unlocking
+ * \param [out] sharedRet is a reference to variable used to return result of operations
+ */
+
+void lockWaitUnlockThread(ReadWriteMutex& readWriteMutex, const bool shared, Semaphore& semaphore, int& sharedRet)
+{
+	sharedRet = shared == true ? readWriteMutex.lockShared() : readWriteMutex.lock();
+	if (sharedRet != 0)
+		return;
+
+	semaphore.wait();
+
+	sharedRet = shared == true ? readWriteMutex.unlockShared() : readWriteMutex.unlock();
+}
+
+/**
+ * \brief Thread that locks the read-write mutex exclusively and immediately unlocks it.
+ *
+ * \param [in] readWriteMutex is a reference to read-write mutex that will be locked and unlocked
+ * \param [out] sharedRet is a reference to variable used to return result of operations
+ */
+
+void lockUnlockThread(ReadWriteMutex& readWriteMutex, int& sharedRet)
+{
+	sharedRet = readWriteMutex.lock();
+	if (sharedRet != 0)
+		return;
+
+	sharedRet = readWriteMutex.unlock();
+}
+
+/**
+ * \brief Tests whether all tryLock*() and tryLockShared*() functions properly time-out.
+ *
+ * \param [in] readWriteMutex is a reference to read-write mutex which is locked by another thread
+ * \param [in] testShared selects whether tryLockShared*() functions should be tested
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testTimeouts(ReadWriteMutex& readWriteMutex, const bool testShared)
+{
+	{
+		// read-write mutex is locked, so tryLockFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = readWriteMutex.tryLockFor(singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// read-write mutex is locked, so tryLockUntil() should time-out at exact expected time
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = readWriteMutex.tryLockUntil(requestedTimePoint);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	if (testShared == false)
+		return true;
+
+	{
+		// read-write mutex is locked exclusively, so tryLockSharedFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = readWriteMutex.tryLockSharedFor(singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// read-write mutex is locked exclusively, so tryLockSharedUntil() should time-out at exact expected time
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = readWriteMutex.tryLockSharedUntil(requestedTimePoint);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests exclusive locking and unlocking in a single thread, including error cases.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticReadWriteMutex<2> readWriteMutex;
+
+	if (readWriteMutex.tryLock() != 0)
+		return false;
+	if (readWriteMutex.tryLock() != EBUSY)
+		return false;
+	if (readWriteMutex.lock() != EDEADLK)
+		return false;
+	if (readWriteMutex.tryLockShared() != EBUSY)
+		return false;
+	if (readWriteMutex.lockShared() != EDEADLK)
+		return false;
+	if (readWriteMutex.unlockShared() != EPERM)
+		return false;
+	if (readWriteMutex.unlock() != 0)
+		return false;
+	if (readWriteMutex.unlock() != EPERM)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests shared (also recursive) locking and unlocking in a single thread, including error cases.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	StaticReadWriteMutex<2> readWriteMutex;
+
+	if (readWriteMutex.tryLockShared() != 0)
+		return false;
+	if (readWriteMutex.lockShared() != 0)
+		return false;
+	if (readWriteMutex.tryLock() != EBUSY)
+		return false;
+	if (readWriteMutex.lock() != EDEADLK)
+		return false;
+	if (readWriteMutex.unlock() != EPERM)
+		return false;
+	if (readWriteMutex.unlockShared() != 0)
+		return false;
+	if (readWriteMutex.unlockShared() != 0)
+		return false;
+	if (readWriteMutex.unlockShared() != EPERM)
+		return false;
+	if (readWriteMutex.tryLock() != 0)
+		return false;
+	if (readWriteMutex.unlock() != 0)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests timeouts when the read-write mutex is locked by another thread - exclusively or in shared mode. Also tests
+ * limit of readers.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	for (const auto shared : {false, true})
+	{
+		StaticReadWriteMutex<1> readWriteMutex;
+		Semaphore semaphore {0};
+		int sharedRet {-1};
+
+		auto thread = makeDynamicThread({testThreadStackSize, testThreadPriority}, lockWaitUnlockThread,
+				std::ref(readWriteMutex), shared, std::ref(semaphore), std::ref(sharedRet));
+
+		thread.start();
+		ThisThread::yield();
+
+		bool result {sharedRet == 0};
+		if (readWriteMutex.tryLock() != EBUSY)
+			result = false;
+		// when the thread owns the read-write mutex in shared mode, there is no free storage for another reader
+		if (readWriteMutex.tryLockShared() != (shared == true ? EAGAIN : EBUSY))
+			result = false;
+		if (testTimeouts(readWriteMutex, shared == false) == false)
+			result = false;
+
+		semaphore.post();
+		thread.join();
+
+		if (result == false || sharedRet != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests preference of writers - when a writer waits for the read-write mutex locked in shared mode, new readers are
+ * blocked, but recursive shared lock is still possible.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	StaticReadWriteMutex<2> readWriteMutex;
+	Semaphore semaphore {0};
+	int readerRet {-1};
+	int writerRet {-1};
+
+	auto readerThread = makeDynamicThread({testThreadStackSize, testThreadPriority}, lockWaitUnlockThread,
+			std::ref(readWriteMutex), true, std::ref(semaphore), std::ref(readerRet));
+	auto writerThread = makeDynamicThread({testThreadStackSize, testThreadPriority}, lockUnlockThread,
+			std::ref(readWriteMutex), std::ref(writerRet));
+
+	readerThread.start();
+	ThisThread::yield();
+	writerThread.start();
+	ThisThread::yield();
+
+	bool result {readerRet == 0 && writerThread.getState() == ThreadState::blockedOnReadWriteMutex};
+	if (readWriteMutex.tryLockShared() != EBUSY)
+		result = false;
+
+	semaphore.post();
+	readerThread.join();
+	writerThread.join();
+
+	if (result == false || readerRet != 0 || writerRet != 0)
+		return false;
+
+	if (readWriteMutex.tryLockShared() != 0)
+		return false;
+
+	return readWriteMutex.unlockShared() == 0;
+}
+
+/**
+ * \brief Phase 5 of test case.
+ *
+ * Tests typical lock transfer scenario in lockShared(), tryLockSharedUntil(), lock() and tryLockUntil() functions.
+ * Read-write mutex is locked exclusively in another thread and main (current) thread waits for this read-write mutex to
+ * become available. Test thread unlocks the read-write mutex at specified time point, main thread is expected to
+ * acquire ownership of this read-write mutex in the same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+	StaticReadWriteMutex<2> readWriteMutex;
+
+	const auto sleepUntilFunctor = [&readWriteMutex](const TickClock::time_point timePoint)
+			{
+				readWriteMutex.lock();
+				ThisThread::sleepUntil(timePoint);
+				readWriteMutex.unlock();
+			};
+
+	for (size_t i {}; i < 4; ++i)
+	{
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		auto thread = makeDynamicThread({testThreadStackSize, testThreadPriority}, sleepUntilFunctor, wakeUpTimePoint);
+
+		waitForNextTick();
+		thread.start();
+		ThisThread::yield();
+
+		const auto shared = i < 2;
+		const auto ret = i == 0 ? readWriteMutex.lockShared() :
+				i == 1 ? readWriteMutex.tryLockSharedUntil(wakeUpTimePoint + longDuration) :
+				i == 2 ? readWriteMutex.lock() : readWriteMutex.tryLockUntil(wakeUpTimePoint + longDuration);
+		const auto wokenUpTimePoint = TickClock::now();
+		thread.join();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint)
+			return false;
+
+		if ((shared == true ? readWriteMutex.unlockShared() : readWriteMutex.unlock()) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ReadWriteMutexOperationsTestCase::run_() const
+{
+	return phase1() == true && phase2() == true && phase3() == true && phase4() == true && phase5() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,71 @@
+/**
+ * \file
+ * \brief ReadWriteMutexOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_READWRITEMUTEX_READWRITEMUTEXOPERATIONSTESTCASE_HPP_
+#define TEST_READWRITEMUTEX_READWRITEMUTEXOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various read-write mutex operations.
+ *
+ * Tests exclusive and shared locking (lock(), lockShared(), tryLock*() and tryLockShared*()) and unlocking of
+ * read-write mutex, including error cases, timeouts, limit of readers and preference of writers.
+ */
+
+class ReadWriteMutexOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief ReadWriteMutexOperationsTestCase's constructor
+	 */
+
+	constexpr ReadWriteMutexOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_READWRITEMUTEX_READWRITEMUTEXOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,155 @@
+/**
+ * \file
+ * \brief ReadWriteMutexPriorityInheritanceTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ReadWriteMutexPriorityInheritanceTestCase.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticReadWriteMutex.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// priority of current test thread
+constexpr uint8_t testThreadPriority {ReadWriteMutexPriorityInheritanceTestCase::getTestCasePriority()};
+
+/// priority of test thread which locks the read-write mutex exclusively
+constexpr uint8_t writerThreadPriority {testThreadPriority - 1};
+
+/// priorities of test threads which lock the read-write mutex in shared mode
+constexpr uint8_t readerThreadPriorities[] {testThreadPriority - 2, testThreadPriority - 3};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Thread that locks the read-write mutex in shared mode, waits for the semaphore and unlocks the read-write
+ * mutex.
+ *
+ * \param [in] readWriteMutex is a reference to read-write mutex that will be locked and unlocked
+ * \param [in] semaphore is a reference to semaphore which will be waited for before unlocking
+ * \param [out] sharedRet is a reference to variable used to return result of operations
+ */
+
+void readerThread(ReadWriteMutex& readWriteMutex, Semaphore& semaphore, int& sharedRet)
+{
+	sharedRet = readWriteMutex.lockShared();
+	if (sharedRet != 0)
+		return;
+
+	semaphore.wait();
+
+	sharedRet = readWriteMutex.unlockShared();
+}
+
+/**
+ * \brief Thread that locks the read-write mutex exclusively and immediately unlocks it.
+ *
+ * \param [in] readWriteMutex is a reference to read-write mutex that will be locked and unlocked
+ * \param [out] sharedRet is a reference to variable used to return result of operations
+ */
+
+void writerThread(ReadWriteMutex& readWriteMutex, int& sharedRet)
+{
+	sharedRet = readWriteMutex.lock();
+	if (sharedRet != 0)
+		return;
+
+	sharedRet = readWriteMutex.unlock();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ReadWriteMutexPriorityInheritanceTestCase::run_() const
+{
+	StaticReadWriteMutex<2> readWriteMutex;
+	Semaphore semaphore {0};
+	int readerRets[] {-1, -1};
+	int writerRet {-1};
+
+	auto reader0 = makeDynamicThread({testThreadStackSize, readerThreadPriorities[0]}, readerThread,
+			std::ref(readWriteMutex), std::ref(semaphore), std::ref(readerRets[0]));
+	auto reader1 = makeDynamicThread({testThreadStackSize, readerThreadPriorities[1]}, readerThread,
+			std::ref(readWriteMutex), std::ref(semaphore), std::ref(readerRets[1]));
+	auto writer = makeDynamicThread({testThreadStackSize, writerThreadPriority}, writerThread,
+			std::ref(readWriteMutex), std::ref(writerRet));
+
+	reader0.start();
+	reader1.start();
+	// let reader threads lock the read-write mutex and block on the semaphore
+	ThisThread::sleepFor(singleDuration);
+
+	bool result {readerRets[0] == 0 && readerRets[1] == 0};
+
+	writer.start();
+	// let writer thread block on the read-write mutex
+	ThisThread::sleepFor(singleDuration);
+
+	// both readers must inherit priority of blocked writer
+	if (writer.getState() != ThreadState::blockedOnReadWriteMutex ||
+			reader0.getEffectivePriority() != writerThreadPriority ||
+			reader1.getEffectivePriority() != writerThreadPriority)
+		result = false;
+
+	// new readers must not be allowed when a writer is waiting
+	if (readWriteMutex.tryLockShared() != EBUSY)
+		result = false;
+
+	// main thread has higher priority than writer thread, after the timeout boosted priority of readers must return to
+	// the priority of writer thread
+	if (readWriteMutex.tryLockFor(singleDuration) != ETIMEDOUT ||
+			reader0.getEffectivePriority() != writerThreadPriority ||
+			reader1.getEffectivePriority() != writerThreadPriority)
+		result = false;
+
+	semaphore.post();
+	semaphore.post();
+	reader0.join();
+	reader1.join();
+	writer.join();
+
+	if (result == false || readerRets[0] != 0 || readerRets[1] != 0 || writerRet != 0)
+		return false;
+
+	if (reader0.getEffectivePriority() != readerThreadPriorities[0] ||
+			reader1.getEffectivePriority() != readerThreadPriorities[1])
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,71 @@
+/**
+ * \file
+ * \brief ReadWriteMutexPriorityInheritanceTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_READWRITEMUTEX_READWRITEMUTEXPRIORITYINHERITANCETESTCASE_HPP_
+#define TEST_READWRITEMUTEX_READWRITEMUTEXPRIORITYINHERITANCETESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests priority inheritance of read-write mutex.
+ *
+ * Tests whether all readers inherit priority of blocked writer and whether this priority is restored when the writer
+ * gives up waiting. Also tests whether the readers are blocked while the writer waits.
+ */
+
+class ReadWriteMutexPriorityInheritanceTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief ReadWriteMutexPriorityInheritanceTestCase's constructor
+	 */
+
+	constexpr ReadWriteMutexPriorityInheritanceTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_READWRITEMUTEX_READWRITEMUTEXPRIORITYINHERITANCETESTCASE_HPP_
@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief readWriteMutexTestCases object definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "readWriteMutexTestCases.hpp"
+
+#include "ReadWriteMutexOperationsTestCase.hpp"
+#include "ReadWriteMutexPriorityInheritanceTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ReadWriteMutexOperationsTestCase instance
+const ReadWriteMutexOperationsTestCase operationsTestCase;
+
+/// ReadWriteMutexPriorityInheritanceTestCase instance
+const ReadWriteMutexPriorityInheritanceTestCase priorityInheritanceTestCase;
+
+/// array with references to TestCase objects related to read-write mutexes
+const TestCaseGroup::Range::value_type readWriteMutexTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+		TestCaseGroup::Range::value_type{priorityInheritanceTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup readWriteMutexTestCases {TestCaseGroup::Range{readWriteMutexTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
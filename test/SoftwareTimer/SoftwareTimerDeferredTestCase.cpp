@@ -0,0 +1,145 @@
+/**
+ * \file
+ * \brief SoftwareTimerDeferredTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerDeferredTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+#include "distortos/DynamicSoftwareTimer.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by software timer during the test case.
+ *
+ * Saves pointer to thread which executes the function, sleeps for one tick (which is possible only in thread context)
+ * and posts the semaphore.
+ *
+ * \param [out] thread is a reference to variable in which pointer to thread executing this function will be saved
+ * \param [in] semaphore is a reference to semaphore which will be posted
+ */
+
+void softwareTimerFunction(Thread*& thread, Semaphore& semaphore)
+{
+	thread = &ThisThread::get();
+	ThisThread::sleepFor(TickClock::duration{1});
+	semaphore.post();
+}
+
+/**
+ * \brief Function executed by software timer which is stopped during its execution.
+ *
+ * Posts the semaphore, sleeps for a few ticks and marks the function as finished.
+ *
+ * \param [in] semaphore is a reference to semaphore which will be posted
+ * \param [out] finished is a reference to variable which will be set to true when the function returns
+ */
+
+void stoppedSoftwareTimerFunction(Semaphore& semaphore, volatile bool& finished)
+{
+	semaphore.post();
+	ThisThread::sleepFor(TickClock::duration{3});
+	finished = true;
+}
+
+}	// namespace
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerDeferredTestCase::run_() const
+{
+#if DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		Thread* thread {};
+		Semaphore semaphore {0};
+		auto softwareTimer = makeDynamicSoftwareTimer(softwareTimerFunction, std::ref(thread), std::ref(semaphore));
+
+		if (softwareTimer.isDeferred() != false)
+			return false;
+
+		softwareTimer.setDeferred(true);
+		if (softwareTimer.isDeferred() != true)
+			return false;
+
+		const auto executionCount = statistics::getSoftwareTimerDaemonExecutionCount();
+		softwareTimer.start(TickClock::duration{1});
+
+		if (semaphore.tryWaitFor(TickClock::duration{10}) != 0)
+			return false;
+
+		if (thread == nullptr || thread == &ThisThread::get() ||
+				statistics::getSoftwareTimerDaemonExecutionCount() - executionCount != 1 ||
+				statistics::getSoftwareTimerDaemonMaxQueueingDelay() < HighResolutionClock::duration{} ||
+				statistics::getSoftwareTimerDaemonTotalQueueingDelay() < HighResolutionClock::duration{})
+			return false;
+	}
+
+	{
+		Semaphore semaphore {0};
+		volatile bool finished {};
+		auto softwareTimer = makeDynamicSoftwareTimer(stoppedSoftwareTimerFunction, std::ref(semaphore),
+				std::ref(finished));
+		softwareTimer.setDeferred(true);
+		softwareTimer.start(TickClock::duration{1});
+
+		if (semaphore.tryWaitFor(TickClock::duration{10}) != 0)
+			return false;
+
+		// timer is running while its function is executed, stop() must wait until the function returns
+		if (softwareTimer.isRunning() != true || finished != false)
+			return false;
+
+		softwareTimer.stop();
+
+		if (softwareTimer.isRunning() != false || finished != true)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after test
+		return false;
+
+#endif	// DISTORTOS_SOFTWARE_TIMER_DAEMON_ENABLE == 1
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief SoftwareTimerDeferredTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERDEFERREDTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERDEFERREDTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests deferred execution of software timers' functions.
+ *
+ * Starts software timer with deferred execution, whose function uses blocking functions, asserting that it is executed
+ * by daemon thread of software timers. Does nothing if daemon thread of software timers is disabled.
+ */
+
+class SoftwareTimerDeferredTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERDEFERREDTESTCASE_HPP_
@@ -11,14 +11,13 @@
 
 #include "SoftwareTimerOrderingTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicSoftwareTimer.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -33,7 +32,7 @@ bool SoftwareTimerOrderingTestCase::run_() const
 {
 	constexpr auto totalSoftwareTimers = totalThreads;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -69,7 +68,7 @@ bool SoftwareTimerOrderingTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
@@ -11,14 +11,13 @@
 
 #include "SoftwareTimerPeriodicTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicSoftwareTimer.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -90,7 +89,7 @@ void softwareTimerFunction(SequenceAsserter& sequenceAsserter, uint32_t& counter
 
 bool SoftwareTimerPeriodicTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	{
 		SequenceAsserter sequenceAsserter;
@@ -127,7 +126,7 @@ bool SoftwareTimerPeriodicTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after test
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after test
 		return false;
 
 	return true;
@@ -0,0 +1,162 @@
+/**
+ * \file
+ * \brief SoftwareTimerSlackTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerSlackTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// total number of software timers used in test case
+constexpr size_t totalSoftwareTimers {4};
+
+/// slack which makes windows of all software timers overlap
+constexpr TickClock::duration overlappingSlack {totalSoftwareTimers};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by software timers during the test case.
+ *
+ * \param [out] timePoint is a reference to variable in which time point of execution will be saved
+ */
+
+void softwareTimerFunction(TickClock::time_point& timePoint)
+{
+	timePoint = TickClock::now();
+}
+
+/**
+ * \brief Runs one phase of the test case.
+ *
+ * Starts all software timers with given slack, so that requested expiration time points are 1, 2, ... ticks in the
+ * future, waits until all of them are executed and checks the results.
+ *
+ * \param [in] slack is the slack of software timers
+ * \param [in] expectedExpiryTicks is the expected number of ticks in which software timers expired
+ *
+ * \return true if the phase succeeded, false otherwise
+ */
+
+bool runPhase(const TickClock::duration slack, const uint64_t expectedExpiryTicks)
+{
+	std::array<TickClock::time_point, totalSoftwareTimers> timePoints {};
+	std::array<DynamicSoftwareTimer, totalSoftwareTimers> softwareTimers
+	{{
+			{softwareTimerFunction, std::ref(timePoints[0])},
+			{softwareTimerFunction, std::ref(timePoints[1])},
+			{softwareTimerFunction, std::ref(timePoints[2])},
+			{softwareTimerFunction, std::ref(timePoints[3])},
+	}};
+
+	for (auto& softwareTimer : softwareTimers)
+		softwareTimer.setSlack(slack);
+
+	waitForNextTick();
+
+	const auto expiryTickCount = statistics::getSoftwareTimerExpiryTickCount();
+	const auto executionCount = statistics::getSoftwareTimerExecutionCount();
+	const auto start = TickClock::now();
+	{
+		auto timePoint = start;
+		for (auto& softwareTimer : softwareTimers)
+			softwareTimer.start(timePoint += TickClock::duration{1});
+	}
+
+	for (const auto& softwareTimer : softwareTimers)
+		while (softwareTimer.isRunning() == true)
+		{
+
+		}
+
+	if (statistics::getSoftwareTimerExpiryTickCount() - expiryTickCount != expectedExpiryTicks ||
+			statistics::getSoftwareTimerExecutionCount() - executionCount != totalSoftwareTimers)
+		return false;
+
+	// with slack - all timers must be executed at latest time point of the first one, otherwise - exactly on time
+	auto expectedTimePoint = start;
+	for (const auto timePoint : timePoints)
+	{
+		expectedTimePoint += TickClock::duration{1};
+		if (timePoint != (slack == TickClock::duration{} ? expectedTimePoint : start + TickClock::duration{1} + slack))
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerSlackTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	if (runPhase({}, totalSoftwareTimers) == false)
+		return false;
+
+	if (runPhase(overlappingSlack, 1) == false)
+		return false;
+
+	{
+		TickClock::time_point timePoint {};
+		auto softwareTimer = makeDynamicSoftwareTimer(softwareTimerFunction, std::ref(timePoint));
+		softwareTimer.setSlack(overlappingSlack);
+
+		ThisThread::setTimerSlack(overlappingSlack);
+		if (ThisThread::getTimerSlack() != overlappingSlack)
+			return false;
+
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		softwareTimer.start(start + TickClock::duration{1});
+		const auto ret = ThisThread::sleepUntil(start + TickClock::duration{2});
+		const auto wokenUp = TickClock::now();
+		ThisThread::setTimerSlack({});
+
+		// the sleep must be coalesced with the timer, which expires at its latest time point
+		if (ret != 0 || timePoint != start + TickClock::duration{1} + overlappingSlack || wokenUp != timePoint)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after test
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief SoftwareTimerSlackTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERSLACKTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERSLACKTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests slack of software timers.
+ *
+ * Starts 4 software timers with consecutive expiration time points - first without slack, then with slack which makes
+ * their windows overlap - asserting that they execute at expected time points and that the number of ticks in which
+ * software timers expired is as expected. Then checks that default timer slack of thread is used for sleeps.
+ */
+
+class SoftwareTimerSlackTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERSLACKTESTCASE_HPP_
@@ -8,8 +8,10 @@
 #
 
 target_sources(distortosTest PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerDeferredTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerFunctionTypesTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerOrderingTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerPeriodicTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerSlackTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/softwareTimerTestCases.cpp)
@@ -11,10 +11,12 @@
 
 #include "softwareTimerTestCases.hpp"
 
+#include "SoftwareTimerDeferredTestCase.hpp"
 #include "SoftwareTimerOrderingTestCase.hpp"
 #include "SoftwareTimerOperationsTestCase.hpp"
 #include "SoftwareTimerFunctionTypesTestCase.hpp"
 #include "SoftwareTimerPeriodicTestCase.hpp"
+#include "SoftwareTimerSlackTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -43,6 +45,12 @@ const SoftwareTimerFunctionTypesTestCase functionTypesTestCase;
 /// SoftwareTimerPeriodicTestCase instance
 const SoftwareTimerPeriodicTestCase periodicTestCase;
 
+/// SoftwareTimerSlackTestCase instance
+const SoftwareTimerSlackTestCase slackTestCase;
+
+/// SoftwareTimerDeferredTestCase instance
+const SoftwareTimerDeferredTestCase deferredTestCase;
+
 /// array with references to TestCase objects related to software timers
 const TestCaseGroup::Range::value_type softwareTimerTestCases_[]
 {
@@ -50,6 +58,8 @@ const TestCaseGroup::Range::value_type softwareTimerTestCases_[]
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{functionTypesTestCase},
 		TestCaseGroup::Range::value_type{periodicTestCase},
+		TestCaseGroup::Range::value_type{slackTestCase},
+		TestCaseGroup::Range::value_type{deferredTestCase},
 };
 
 }	// namespace
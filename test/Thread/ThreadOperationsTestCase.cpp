@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadOperationsTestCase class implementation
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,17 +11,19 @@
 
 #include "ThreadOperationsTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/memoryRegions.hpp"
+#include "distortos/Semaphore.hpp"
 #include "distortos/StaticThread.hpp"
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 #include "distortos/ThreadIdentifier.hpp"
-
-#include <malloc.h>
+#include "distortos/ThreadLocal.hpp"
 
 #include <cerrno>
 
@@ -54,6 +56,30 @@ void emptyFunction()
 
 }
 
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+/**
+ * \brief Sums usage of heaps of memory regions.
+ *
+ * \param [in] capabilities are the capabilities used to select regions
+ * \param [in] matching selects whether regions which have all \a capabilities (true) or all other regions (false) will
+ * be summed
+ *
+ * \return total size of used blocks in selected regions, bytes
+ */
+
+size_t getUsedSizeOfMemoryRegions(const MemoryCapabilities capabilities, const bool matching)
+{
+	size_t usedSize {};
+	for (size_t index {}; index < memoryRegions::getCount(); ++index)
+		if (((memoryRegions::getCapabilities(index) & capabilities) == capabilities) == matching)
+			usedSize += statistics::getMemoryRegionStatistics(index).usedSize;
+
+	return usedSize;
+}
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
 /**
  * \brief Phase 1 of test case
  *
@@ -152,7 +178,7 @@ bool phase3()
 {
 #ifdef DISTORTOS_THREAD_DETACH_ENABLE
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto lambda =
 			[](int& sharedRet)
 			{
@@ -192,7 +218,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// detaching dynamic thread that is started, but not yet terminated, must succeed
@@ -215,7 +241,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// self-detach of dynamic thread must succeed
@@ -238,7 +264,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// detaching dynamic thread that is already terminated must succeed, the thread is just deleted
@@ -256,7 +282,33 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	// dynamic thread with the same parameters must reuse block of memory of deleted dynamic thread if the cache is
+	// enabled
+	{
+		trimThreadRecyclingCache();
+		const auto hitCount = statistics::getThreadRecyclingCacheHitCount();
+		const auto missCount = statistics::getThreadRecyclingCacheMissCount();
+		for (size_t i {}; i < 2; ++i)
+		{
+			auto dynamicThread = makeAndStartDynamicThread({testThreadStackSize, 1}, emptyFunction);
+			if (dynamicThread.join() != 0)
+				return false;
+		}
+
+		constexpr size_t expectedHitCount {DISTORTOS_THREAD_RECYCLING_CACHE_SIZE != 0 ? 1 : 0};
+		if (statistics::getThreadRecyclingCacheHitCount() - hitCount != expectedHitCount ||
+				statistics::getThreadRecyclingCacheMissCount() - missCount != 2 - expectedHitCount ||
+				statistics::getThreadRecyclingCacheSize() != expectedHitCount)
+			return false;
+
+		if (trimThreadRecyclingCache() != expectedHitCount || statistics::getThreadRecyclingCacheSize() != 0)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
@@ -274,7 +326,7 @@ bool phase3()
 
 bool phase4()
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	{
 		SequenceAsserter sequenceAsserter;
@@ -292,7 +344,7 @@ bool phase4()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 #ifdef DISTORTOS_THREAD_DETACH_ENABLE
@@ -315,7 +367,7 @@ bool phase4()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
@@ -333,7 +385,7 @@ bool phase4()
 
 bool phase5()
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	const auto lambda =
 			[](ThreadIdentifier& innerIdentifier, bool& sharedResult)
@@ -381,7 +433,7 @@ bool phase5()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// test whether identifiers for different thread instances are not equal
@@ -414,12 +466,194 @@ bool phase5()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	return true;
 }
 
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+/**
+ * \brief Destructor of slot of thread-local storage used in phase 6
+ *
+ * \param [in] pointer is a pointer to counter which will be incremented
+ */
+
+void threadLocalDestructor(void* const pointer)
+{
+	++*static_cast<size_t*>(pointer);
+}
+
+/**
+ * \brief Phase 6 of test case
+ *
+ * Tests thread-local storage.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase6()
+{
+	using TestThreadLocal = ThreadLocal<size_t, 0>;
+
+	TestThreadLocal::setDestructor(threadLocalDestructor);
+
+	size_t counter {};
+	const auto outerPointer = TestThreadLocal::get();
+	bool sharedResult {};
+	auto testThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX},
+			[&counter, &sharedResult]()
+			{
+				// slot of new thread must be empty, after change it must hold the new value
+				sharedResult = TestThreadLocal::get() == nullptr;
+				TestThreadLocal::set(&counter);
+				sharedResult = sharedResult == true && TestThreadLocal::get() == &counter;
+			});
+	if (testThread.join() != 0)
+		return false;
+
+	TestThreadLocal::setDestructor(nullptr);
+
+	// destructor must be executed exactly once and slot of this thread must not be changed
+	return sharedResult == true && counter == 1 && TestThreadLocal::get() == outerPointer;
+}
+
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+
+/**
+ * \brief Phase 7 of test case
+ *
+ * Tests sharing of newlib's reentrancy structure (_reent) between threads and enabling private one with
+ * ThisThread::enablePrivateReent().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase7()
+{
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+	const auto allocatedMemory = getAllocatedMemory();
+	const auto outerErrno = errno;
+	const auto outerReent = _impure_ptr;
+
+	constexpr int sharedErrno {0x1c0a7e52};
+	constexpr int innerErrno {0x4f6b03d9};
+	constexpr int outerNewErrno {0x7a25e6c1};
+
+	{
+		Semaphore semaphore {0};
+		bool sharedResult {};
+		// errno set here must be visible in the new thread, as long as it uses shared _reent
+		errno = sharedErrno;
+		auto testThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX},
+				[&semaphore, &sharedResult, outerReent]()
+				{
+					// the thread must use shared _reent, so it must see errno of other threads
+					sharedResult = _impure_ptr == outerReent && _impure_ptr == _global_impure_ptr &&
+							errno == sharedErrno;
+
+					const auto innerAllocatedMemory = getAllocatedMemory();
+					if (ThisThread::enablePrivateReent() != 0)
+					{
+						sharedResult = false;
+						return;
+					}
+
+					// private _reent must be allocated dynamically and must be used from now on
+					sharedResult = sharedResult == true &&
+							getAllocatedMemory() - innerAllocatedMemory >= static_cast<int>(sizeof(_reent)) &&
+							_impure_ptr != _global_impure_ptr && errno == 0;
+					// second call must have no effect
+					const auto privateReent = _impure_ptr;
+					sharedResult = sharedResult == true && ThisThread::enablePrivateReent() == 0 &&
+							_impure_ptr == privateReent;
+
+					errno = innerErrno;
+					semaphore.wait();
+					// errno of this thread must not be changed by other threads
+					sharedResult = sharedResult == true && errno == innerErrno && _impure_ptr == privateReent;
+				});
+
+		// errno set in the thread with private _reent must not be visible here
+		bool result {errno == sharedErrno && _impure_ptr == outerReent};
+		errno = outerNewErrno;
+		if (semaphore.post() != 0)
+			result = false;
+		if (testThread.join() != 0)
+			result = false;
+		if (errno != outerNewErrno)
+			result = false;
+
+		errno = outerErrno;
+		if (result == false || sharedResult == false)
+			return false;
+	}
+
+	// private _reent must be deallocated together with the thread
+	if (getAllocatedMemory() != allocatedMemory)
+		return false;
+
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+
+	return true;
+}
+
+/**
+ * \brief Phase 8 of test case
+ *
+ * Tests allocation of dynamic thread from memory region with selected capabilities. Capabilities of the last region
+ * are used, as on most boards this is not the region with main heap.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase8()
+{
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+	const auto capabilities = memoryRegions::getCapabilities(memoryRegions::getCount() - 1);
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+	// blocks retained for reuse would hide allocations and deallocations in regions
+	trimThreadRecyclingCache();
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
+	const auto matchingUsedSize = getUsedSizeOfMemoryRegions(capabilities, true);
+	const auto otherUsedSize = getUsedSizeOfMemoryRegions(capabilities, false);
+
+	{
+		bool sharedResult {};
+		auto testThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX, SchedulingPolicy::roundRobin,
+				capabilities}, [&sharedResult]()
+				{
+					sharedResult = true;
+				});
+
+		// thread must be allocated only from regions with requested capabilities
+		bool result {getUsedSizeOfMemoryRegions(capabilities, true) > matchingUsedSize &&
+				getUsedSizeOfMemoryRegions(capabilities, false) == otherUsedSize};
+		if (testThread.join() != 0)
+			result = false;
+		if (result == false || sharedResult == false)
+			return false;
+	}
+
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+	trimThreadRecyclingCache();
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
+	// memory of thread must be returned to the region it was allocated from
+	if (getUsedSizeOfMemoryRegions(capabilities, true) != matchingUsedSize ||
+			getUsedSizeOfMemoryRegions(capabilities, false) != otherUsedSize)
+		return false;
+
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -438,19 +672,39 @@ bool ThreadOperationsTestCase::run_() const
 	constexpr auto phase4ExpectedContextSwitchCount = 2;
 #endif	// !def DISTORTOS_THREAD_DETACH_ENABLE
 	constexpr auto phase5ExpectedContextSwitchCount = 8;
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+	constexpr auto phase6ExpectedContextSwitchCount = 2;
+#else	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS == 0
+	constexpr auto phase6ExpectedContextSwitchCount = 0;
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS == 0
+#if DISTORTOS_NEWLIB_SHARED_REENT_ENABLE == 1
+	constexpr auto phase7ExpectedContextSwitchCount = 4;
+#else	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+	constexpr auto phase7ExpectedContextSwitchCount = 0;
+#endif	// DISTORTOS_NEWLIB_SHARED_REENT_ENABLE != 1
+#if DISTORTOS_MEMORY_REGIONS_ENABLE == 1
+	constexpr auto phase8ExpectedContextSwitchCount = 2;
+#else	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
+	constexpr auto phase8ExpectedContextSwitchCount = 0;
+#endif	// DISTORTOS_MEMORY_REGIONS_ENABLE != 1
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
-			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount +
+			phase6ExpectedContextSwitchCount + phase7ExpectedContextSwitchCount + phase8ExpectedContextSwitchCount;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
-	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+#if DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS != 0
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6, phase7, phase8})
+#else	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS == 0
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase7, phase8})
+#endif	// DISTORTOS_THREAD_LOCAL_STORAGE_SLOTS == 0
 	{
 		const auto ret = function();
 		if (ret != true)
 			return ret;
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
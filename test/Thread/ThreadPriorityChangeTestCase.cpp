@@ -11,13 +11,12 @@
 
 #include "ThreadPriorityChangeTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -80,7 +79,7 @@ DynamicThread makeAndStartTestThread(const uint8_t priority, SequenceAsserter& s
 
 bool ThreadPriorityChangeTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	{
 		// difference required for this whole test to work
@@ -129,7 +128,7 @@ bool ThreadPriorityChangeTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	return true;
@@ -11,6 +11,7 @@
 
 #include "ThreadSchedulingPolicyTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 #include "wasteTime.hpp"
 
@@ -18,8 +19,6 @@
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -98,7 +97,7 @@ DynamicThread makeTestThread(const SchedulingPolicy schedulingPolicy, SequenceAs
 
 bool ThreadSchedulingPolicyTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	// scheduling policy, sequence point multiplier, sequence point step
 	using Parameters = std::tuple<SchedulingPolicy, unsigned int, unsigned int>;
@@ -156,7 +155,7 @@ bool ThreadSchedulingPolicyTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \brief getAllocatedMemory() implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "getAllocatedMemory.hpp"
+
+#include "distortos/DynamicThread.hpp"
+
+#include <malloc.h>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int getAllocatedMemory()
+{
+#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+	trimThreadRecyclingCache();
+#endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+	return mallinfo().uordblks;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief getAllocatedMemory() header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_GETALLOCATEDMEMORY_HPP_
+#define TEST_GETALLOCATEDMEMORY_HPP_
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Returns size of allocated dynamic memory.
+ *
+ * Blocks of memory of deleted dynamic threads retained for reuse are deallocated first, so that the result does not
+ * depend on the state of the thread recycling cache.
+ *
+ * \return size of allocated dynamic memory, bytes
+ */
+
+int getAllocatedMemory();
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_GETALLOCATEDMEMORY_HPP_
@@ -15,6 +15,7 @@
 #include "SoftwareTimer/softwareTimerTestCases.hpp"
 #include "Semaphore/semaphoreTestCases.hpp"
 #include "Mutex/mutexTestCases.hpp"
+#include "ReadWriteMutex/readWriteMutexTestCases.hpp"
 #include "ConditionVariable/conditionVariableTestCases.hpp"
 #include "Queue/queueTestCases.hpp"
 #include "Signals/signalsTestCases.hpp"
@@ -43,6 +44,7 @@ const TestCaseGroup::Range::value_type testCases_[]
 		TestCaseGroup::Range::value_type{softwareTimerTestCases},
 		TestCaseGroup::Range::value_type{semaphoreTestCases},
 		TestCaseGroup::Range::value_type{mutexTestCases},
+		TestCaseGroup::Range::value_type{readWriteMutexTestCases},
 		TestCaseGroup::Range::value_type{conditionVariableTestCases},
 		TestCaseGroup::Range::value_type{queueTestCases},
 		TestCaseGroup::Range::value_type{signalsTestCases},
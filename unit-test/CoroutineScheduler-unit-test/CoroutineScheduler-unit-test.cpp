@@ -0,0 +1,400 @@
+/**
+ * \file
+ * \brief CoroutineScheduler test cases
+ *
+ * This test checks whether CoroutineScheduler resumes coroutine tasks when their awaiters complete, terminates waits
+ * with expired deadlines, blocks for the right time between polls and allocates coroutine frames from
+ * CoroutineFramePool. It also checks whether coroutine tasks contending on one mutex are serialized and whether
+ * mutexes of types other than normal are rejected.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/coroutineAwaitables.hpp"
+#include "distortos/CoroutineScheduler.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <vector>
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TestAwaiter class is an awaiter which completes when the flag is set or when its deadline passes
+class TestAwaiter : public distortos::internal::CoroutineAwaiter
+{
+public:
+
+	/**
+	 * \brief TestAwaiter's constructor
+	 *
+	 * \param [in] flag is a reference to flag which completes the wait when set
+	 * \param [out] result is a reference to variable in which the result of wait will be written - 0 if \a flag was
+	 * set, ETIMEDOUT if \a deadline passed
+	 * \param [in] deadline is the time point at which the wait will be terminated
+	 * \param [in] pollable selects whether \a flag is checked (true) or ignored (false)
+	 */
+
+	TestAwaiter(const bool& flag, int& result, const distortos::TickClock::time_point deadline, const bool pollable) :
+			CoroutineAwaiter{deadline, pollable},
+			flag_{flag},
+			result_{result}
+	{
+
+	}
+
+	/**
+	 * \brief Does nothing.
+	 */
+
+	void await_resume() const
+	{
+
+	}
+
+	/**
+	 * \brief Terminates the wait with ETIMEDOUT.
+	 */
+
+	void expire() override
+	{
+		result_ = ETIMEDOUT;
+	}
+
+	/**
+	 * \return true if the flag is set, false otherwise
+	 */
+
+	bool poll() override
+	{
+		if (isPollable() == false || flag_ == false)
+			return false;
+
+		result_ = 0;
+		return true;
+	}
+
+private:
+
+	/// reference to flag which completes the wait when set
+	const bool& flag_;
+
+	/// reference to variable in which the result of wait will be written
+	int& result_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Coroutine task which waits with TestAwaiter.
+ *
+ * \param [in] flag is a reference to flag which completes the wait when set
+ * \param [out] result is a reference to variable in which the result of wait will be written
+ * \param [in] deadline is the time point at which the wait will be terminated
+ * \param [in] pollable selects whether \a flag is checked (true) or ignored (false)
+ * \param [out] sequence is a reference to vector to which \a id is appended when the task finishes
+ * \param [in] id is the identifier of the task
+ */
+
+distortos::CoroutineTask waitTask(const bool& flag, int& result, const distortos::TickClock::time_point deadline,
+		const bool pollable, std::vector<int>& sequence, const int id)
+{
+	co_await TestAwaiter{flag, result, deadline, pollable};
+	sequence.push_back(id);
+}
+
+/**
+ * \brief Coroutine task which locks the mutex, yields once while holding it and then unlocks it.
+ *
+ * \param [in] mutex is a reference to mutex which will be locked
+ * \param [out] result is a reference to variable in which the result of asyncLock() will be written
+ * \param [in,out] owners is a reference to number of coroutine tasks which are in the critical section
+ * \param [out] maxOwners is a reference to max value of \a owners
+ * \param [out] sequence is a reference to vector to which \a id is appended when the task leaves critical section
+ * \param [in] id is the identifier of the task
+ */
+
+distortos::CoroutineTask lockTask(distortos::Mutex& mutex, int& result, int& owners, int& maxOwners,
+		std::vector<int>& sequence, const int id)
+{
+	result = co_await distortos::asyncLock(mutex);
+	if (result != 0)
+		co_return;
+
+	maxOwners = std::max(maxOwners, ++owners);
+	co_await distortos::asyncYield();
+	--owners;
+	sequence.push_back(id);
+	mutex.unlock();
+}
+
+/**
+ * \brief Coroutine task with frame allocated from CoroutineFramePool, which finishes immediately.
+ *
+ * \param [in] pool is a reference to CoroutineFramePool from which the frame is allocated
+ * \param [out] sequence is a reference to vector to which \a id is appended when the task finishes
+ * \param [in] id is the identifier of the task
+ */
+
+distortos::CoroutineTask pooledTask(distortos::CoroutineFramePool&, std::vector<int>& sequence, const int id)
+{
+	sequence.push_back(id);
+	co_return;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void fatalErrorHandler(const char*, int, const char*, const char* const message)
+{
+	FAIL(message);
+	abort();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing resumption of coroutine tasks with completed awaiters", "[resume]")
+{
+	using TickClock = distortos::TickClock;
+
+	TickClock tickClock;
+	distortos::mock::Semaphore semaphoreMock;
+	TickClock::time_point now {};
+	ALLOW_CALL(tickClock, nowMock()).LR_RETURN(now);
+
+	bool flags[2] {};
+	int results[2] {-1, -1};
+	std::vector<int> sequence;
+
+	distortos::CoroutineScheduler scheduler;
+	for (int i {}; i < 2; ++i)
+		REQUIRE(scheduler.add(waitTask(flags[i], results[i], TickClock::time_point::max(), true, sequence, i)) == 0);
+	REQUIRE(scheduler.getTasksCount() == 2);
+
+	// while kernel objects don't change, awaiters are polled every tick
+	int polls {};
+	ALLOW_CALL(semaphoreMock, tryWaitUntil(_)).LR_WITH(_1 == now + TickClock::duration{1})
+			.LR_SIDE_EFFECT(now = _1; ++polls; if (polls == 3) flags[1] = true; if (polls == 5) flags[0] = true;)
+			.RETURN(ETIMEDOUT);
+	FORBID_CALL(semaphoreMock, wait());
+
+	REQUIRE(scheduler.run() == 0);
+	REQUIRE(polls == 5);
+	REQUIRE(now == TickClock::time_point{TickClock::duration{5}});
+	REQUIRE(results[0] == 0);
+	REQUIRE(results[1] == 0);
+	REQUIRE(sequence == std::vector<int>{1, 0});
+	REQUIRE(scheduler.getTasksCount() == 0);
+}
+
+TEST_CASE("Testing timeouts of coroutine tasks", "[timeout]")
+{
+	using TickClock = distortos::TickClock;
+
+	TickClock tickClock;
+	distortos::mock::Semaphore semaphoreMock;
+	TickClock::time_point now {};
+	ALLOW_CALL(tickClock, nowMock()).LR_RETURN(now);
+
+	const bool flag {};
+	int results[2] {-1, -1};
+	std::vector<int> sequence;
+
+	distortos::CoroutineScheduler scheduler {TickClock::duration::max()};
+	// not pollable awaiter (like sleep) with later deadline
+	REQUIRE(scheduler.add(waitTask(flag, results[0], TickClock::time_point{TickClock::duration{7}}, false, sequence,
+			0)) == 0);
+	// pollable awaiter with periodic polling disabled, so the scheduler blocks until deadline
+	REQUIRE(scheduler.add(waitTask(flag, results[1], TickClock::time_point{TickClock::duration{3}}, true, sequence,
+			1)) == 0);
+
+	trompeloeil::sequence wakeUps;
+	REQUIRE_CALL(semaphoreMock, tryWaitUntil(TickClock::time_point{TickClock::duration{3}})).IN_SEQUENCE(wakeUps)
+			.LR_SIDE_EFFECT(now = _1).RETURN(ETIMEDOUT);
+	REQUIRE_CALL(semaphoreMock, tryWaitUntil(TickClock::time_point{TickClock::duration{7}})).IN_SEQUENCE(wakeUps)
+			.LR_SIDE_EFFECT(now = _1).RETURN(ETIMEDOUT);
+
+	REQUIRE(scheduler.run() == 0);
+	REQUIRE(results[0] == ETIMEDOUT);
+	REQUIRE(results[1] == ETIMEDOUT);
+	REQUIRE(sequence == std::vector<int>{1, 0});
+}
+
+TEST_CASE("Testing notification of coroutine scheduler", "[notify]")
+{
+	using TickClock = distortos::TickClock;
+
+	TickClock tickClock;
+	distortos::mock::Semaphore semaphoreMock;
+	TickClock::time_point now {};
+	ALLOW_CALL(tickClock, nowMock()).LR_RETURN(now);
+
+	bool flag {};
+	int result {-1};
+	std::vector<int> sequence;
+
+	distortos::CoroutineScheduler scheduler {TickClock::duration::max()};
+	REQUIRE(scheduler.add(waitTask(flag, result, TickClock::time_point::max(), true, sequence, 0)) == 0);
+
+	// without any deadline the scheduler waits for notification
+	REQUIRE_CALL(semaphoreMock, wait()).LR_SIDE_EFFECT(flag = true).RETURN(0);
+	FORBID_CALL(semaphoreMock, tryWaitUntil(_));
+
+	REQUIRE(scheduler.run() == 0);
+	REQUIRE(result == 0);
+	REQUIRE(sequence == std::vector<int>{0});
+}
+
+TEST_CASE("Testing interrupted wait of coroutine scheduler", "[interrupt]")
+{
+	using TickClock = distortos::TickClock;
+
+	TickClock tickClock;
+	distortos::mock::Semaphore semaphoreMock;
+	TickClock::time_point now {};
+	ALLOW_CALL(tickClock, nowMock()).LR_RETURN(now);
+
+	const bool flag {};
+	int result {-1};
+	std::vector<int> sequence;
+
+	{
+		distortos::CoroutineScheduler scheduler;
+		REQUIRE(scheduler.add(waitTask(flag, result, TickClock::time_point::max(), false, sequence, 0)) == 0);
+
+		REQUIRE_CALL(semaphoreMock, wait()).RETURN(EINTR);
+		REQUIRE(scheduler.run() == EINTR);
+		REQUIRE(scheduler.getTasksCount() == 1);
+	}
+
+	// suspended task was destroyed together with the scheduler
+	REQUIRE(result == -1);
+	REQUIRE(sequence.empty() == true);
+}
+
+TEST_CASE("Testing allocation of coroutine frames from CoroutineFramePool", "[pool]")
+{
+	using TickClock = distortos::TickClock;
+
+	TickClock tickClock;
+	ALLOW_CALL(tickClock, nowMock()).RETURN(TickClock::time_point{});
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	ALLOW_CALL(interruptMaskingLockProxy, construct());
+	ALLOW_CALL(interruptMaskingLockProxy, destruct());
+
+	alignas(std::max_align_t) uint8_t storage[1024];
+	distortos::CoroutineFramePool pool {storage, sizeof(storage), sizeof(storage) / 2};
+	REQUIRE(pool.getCapacity() == 2);
+	REQUIRE(pool.getFreeBlocks() == 2);
+
+	std::vector<int> sequence;
+	distortos::CoroutineScheduler scheduler;
+	for (int i {}; i < 2; ++i)
+		REQUIRE(scheduler.add(pooledTask(pool, sequence, i)) == 0);
+	REQUIRE(pool.getFreeBlocks() == 0);
+
+	// pool is exhausted
+	auto invalidTask = pooledTask(pool, sequence, 2);
+	REQUIRE(invalidTask.isValid() == false);
+	REQUIRE(scheduler.add(std::move(invalidTask)) == ENOMEM);
+
+	REQUIRE(scheduler.run() == 0);
+	REQUIRE(sequence == std::vector<int>{0, 1});
+	REQUIRE(pool.getFreeBlocks() == 2);
+}
+
+TEST_CASE("Testing contention of coroutine tasks on one mutex", "[mutex]")
+{
+	using TickClock = distortos::TickClock;
+
+	TickClock tickClock;
+	distortos::mock::Semaphore semaphoreMock;
+	TickClock::time_point now {};
+	ALLOW_CALL(tickClock, nowMock()).LR_RETURN(now);
+
+	distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	distortos::Mutex mutex;
+	bool locked {};
+	ALLOW_CALL(mutexMock, getType()).RETURN(distortos::Mutex::Type::normal);
+	// both tasks try to lock the mutex, the second one must wait until the first one unlocks it
+	trompeloeil::sequence operations;
+	REQUIRE_CALL(mutexMock, tryLock()).IN_SEQUENCE(operations).LR_SIDE_EFFECT(locked = true).RETURN(0);
+	REQUIRE_CALL(mutexMock, tryLock()).IN_SEQUENCE(operations).RETURN(EBUSY);
+	REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(operations).LR_SIDE_EFFECT(locked = false).RETURN(0);
+	REQUIRE_CALL(mutexMock, tryLock()).IN_SEQUENCE(operations).LR_WITH(locked == false)
+			.LR_SIDE_EFFECT(locked = true).RETURN(0);
+	REQUIRE_CALL(mutexMock, unlock()).IN_SEQUENCE(operations).LR_SIDE_EFFECT(locked = false).RETURN(0);
+	FORBID_CALL(semaphoreMock, tryWaitUntil(_));
+	FORBID_CALL(semaphoreMock, wait());
+
+	int results[2] {-1, -1};
+	int owners {};
+	int maxOwners {};
+	std::vector<int> sequence;
+
+	distortos::CoroutineScheduler scheduler;
+	for (int i {}; i < 2; ++i)
+		REQUIRE(scheduler.add(lockTask(mutex, results[i], owners, maxOwners, sequence, i)) == 0);
+
+	REQUIRE(scheduler.run() == 0);
+	REQUIRE(results[0] == 0);
+	REQUIRE(results[1] == 0);
+	REQUIRE(maxOwners == 1);
+	REQUIRE(owners == 0);
+	REQUIRE(sequence == std::vector<int>{0, 1});
+	REQUIRE(locked == false);
+}
+
+TEST_CASE("Testing rejection of mutexes which are not of normal type", "[mutex]")
+{
+	using TickClock = distortos::TickClock;
+
+	TickClock tickClock;
+	distortos::mock::Semaphore semaphoreMock;
+	ALLOW_CALL(tickClock, nowMock()).RETURN(TickClock::time_point{});
+
+	for (const auto type : {distortos::Mutex::Type::errorChecking, distortos::Mutex::Type::recursive})
+	{
+		DYNAMIC_SECTION("Testing type " << static_cast<int>(type))
+		{
+			distortos::mock::Mutex mutexMock {distortos::mock::Mutex::UnitTestTag{}};
+	distortos::Mutex mutex;
+			ALLOW_CALL(mutexMock, getType()).RETURN(type);
+			FORBID_CALL(mutexMock, tryLock());
+			FORBID_CALL(mutexMock, unlock());
+
+			int results[2] {-1, -1};
+			int owners {};
+			int maxOwners {};
+			std::vector<int> sequence;
+
+			distortos::CoroutineScheduler scheduler;
+			for (int i {}; i < 2; ++i)
+				REQUIRE(scheduler.add(lockTask(mutex, results[i], owners, maxOwners, sequence, i)) == 0);
+
+			REQUIRE(scheduler.run() == 0);
+			REQUIRE(results[0] == EINVAL);
+			REQUIRE(results[1] == EINVAL);
+			REQUIRE(maxOwners == 0);
+			REQUIRE(sequence.empty() == true);
+		}
+	}
+}
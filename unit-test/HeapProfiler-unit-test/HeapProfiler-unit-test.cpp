@@ -0,0 +1,296 @@
+/**
+ * \file
+ * \brief HeapProfiler test cases
+ *
+ * This test checks whether HeapProfiler keeps the most recent events in its ring buffer, attributes live blocks and
+ * bytes to call sites and handles full tables of call sites and tracked blocks. Pointers passed to the profiler are
+ * never dereferenced, so fake addresses are used.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/memory/HeapProfiler.hpp"
+
+#include <map>
+#include <random>
+
+using distortos::HeapProfilerCallSite;
+using distortos::HeapProfilerEvent;
+using distortos::internal::HeapProfiler;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts integer to fake pointer.
+ *
+ * \param [in] value is the value of fake pointer
+ *
+ * \return fake pointer with \a value
+ */
+
+const void* makePointer(const uintptr_t value)
+{
+	return reinterpret_cast<const void*>(value);
+}
+
+/**
+ * \brief Finds call site in array.
+ *
+ * \param [in] callSites is an array with call sites
+ * \param [in] count is the number of valid elements in \a callSites
+ * \param [in] caller is the return address of searched call site
+ *
+ * \return pointer to found call site, nullptr if not found
+ */
+
+const HeapProfilerCallSite* findCallSite(const HeapProfilerCallSite* const callSites, const size_t count,
+		const void* const caller)
+{
+	for (size_t i {}; i < count; ++i)
+		if (callSites[i].caller == caller)
+			return &callSites[i];
+
+	return {};
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing ring buffer of events of HeapProfiler", "[events]")
+{
+	HeapProfilerEvent events[4] {};
+	HeapProfilerCallSite callSites[4] {};
+	HeapProfiler::TrackedBlock trackedBlocks[8] {};
+	HeapProfiler profiler {HeapProfiler::EventsRange{events}, HeapProfiler::CallSitesRange{callSites},
+			HeapProfiler::TrackedBlocksRange{trackedBlocks}};
+
+	HeapProfilerEvent snapshotEvents[8] {};
+	HeapProfilerCallSite snapshotCallSites[4] {};
+
+	{
+		const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{snapshotEvents},
+				HeapProfiler::CallSitesRange{snapshotCallSites});
+		REQUIRE(snapshot.events == 0);
+		REQUIRE(snapshot.callSites == 0);
+		REQUIRE(snapshot.lostEvents == 0);
+	}
+
+	for (uintptr_t i {1}; i <= 3; ++i)
+		profiler.recordAllocation(makePointer(i * 0x100), i * 8, makePointer(0x8000), makePointer(0x2000), i);
+
+	{
+		const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{snapshotEvents},
+				HeapProfiler::CallSitesRange{snapshotCallSites});
+		REQUIRE(snapshot.events == 3);
+		REQUIRE(snapshot.lostEvents == 0);
+		for (size_t i {}; i < snapshot.events; ++i)
+		{
+			REQUIRE(snapshotEvents[i].timestamp == i + 1);
+			REQUIRE(snapshotEvents[i].memory == makePointer((i + 1) * 0x100));
+			REQUIRE(snapshotEvents[i].size == (i + 1) * 8);
+			REQUIRE(snapshotEvents[i].caller == makePointer(0x8000));
+			REQUIRE(snapshotEvents[i].thread == makePointer(0x2000));
+			REQUIRE(snapshotEvents[i].type == HeapProfilerEvent::Type::allocation);
+		}
+	}
+
+	for (uintptr_t i {1}; i <= 3; ++i)
+		profiler.recordDeallocation(makePointer(i * 0x100), i * 8, makePointer(0x9000), {}, 3 + i);
+
+	{
+		const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{snapshotEvents},
+				HeapProfiler::CallSitesRange{snapshotCallSites});
+		REQUIRE(snapshot.events == 4);
+		REQUIRE(snapshot.lostEvents == 2);
+		for (size_t i {}; i < snapshot.events; ++i)
+			REQUIRE(snapshotEvents[i].timestamp == i + 3);
+		REQUIRE(snapshotEvents[0].type == HeapProfilerEvent::Type::allocation);
+		REQUIRE(snapshotEvents[3].type == HeapProfilerEvent::Type::deallocation);
+		REQUIRE(snapshotEvents[3].caller == makePointer(0x9000));
+		REQUIRE(snapshotEvents[3].thread == nullptr);
+	}
+
+	{
+		// only the most recent events are copied if there is not enough space
+		HeapProfilerEvent smallSnapshotEvents[2] {};
+		const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{smallSnapshotEvents},
+				HeapProfiler::CallSitesRange{snapshotCallSites});
+		REQUIRE(snapshot.events == 2);
+		REQUIRE(smallSnapshotEvents[0].timestamp == 5);
+		REQUIRE(smallSnapshotEvents[1].timestamp == 6);
+	}
+
+	profiler.clearEvents();
+
+	{
+		const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{snapshotEvents},
+				HeapProfiler::CallSitesRange{snapshotCallSites});
+		REQUIRE(snapshot.events == 0);
+		REQUIRE(snapshot.lostEvents == 0);
+		REQUIRE(snapshot.callSites == 1);
+	}
+}
+
+TEST_CASE("Testing counters of call sites of HeapProfiler", "[callSites]")
+{
+	HeapProfilerEvent events[16] {};
+	HeapProfilerCallSite callSites[4] {};
+	HeapProfiler::TrackedBlock trackedBlocks[8] {};
+	HeapProfiler profiler {HeapProfiler::EventsRange{events}, HeapProfiler::CallSitesRange{callSites},
+			HeapProfiler::TrackedBlocksRange{trackedBlocks}};
+
+	const auto firstCaller = makePointer(0x8000);
+	const auto secondCaller = makePointer(0x8010);
+	profiler.recordAllocation(makePointer(0x100), 16, firstCaller, {}, {});
+	profiler.recordAllocation(makePointer(0x200), 32, firstCaller, {}, {});
+	profiler.recordAllocation(makePointer(0x300), 64, secondCaller, {}, {});
+	// deallocation caller doesn't matter - block is attributed to the call site of its allocation
+	profiler.recordDeallocation(makePointer(0x200), 32, secondCaller, {}, {});
+	profiler.recordAllocation(makePointer(0x400), 8, firstCaller, {}, {});
+
+	HeapProfilerEvent snapshotEvents[16] {};
+	HeapProfilerCallSite snapshotCallSites[4] {};
+	const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{snapshotEvents},
+			HeapProfiler::CallSitesRange{snapshotCallSites});
+	REQUIRE(snapshot.callSites == 2);
+	REQUIRE(snapshot.events == 5);
+	REQUIRE(snapshot.untrackedAllocations == 0);
+
+	const auto first = findCallSite(snapshotCallSites, snapshot.callSites, firstCaller);
+	REQUIRE(first != nullptr);
+	REQUIRE(first->allocations == 3);
+	REQUIRE(first->liveBlocks == 2);
+	REQUIRE(first->liveSize == 16 + 8);
+	REQUIRE(first->peakLiveSize == 16 + 32);
+
+	const auto second = findCallSite(snapshotCallSites, snapshot.callSites, secondCaller);
+	REQUIRE(second != nullptr);
+	REQUIRE(second->allocations == 1);
+	REQUIRE(second->liveBlocks == 1);
+	REQUIRE(second->liveSize == 64);
+	REQUIRE(second->peakLiveSize == 64);
+}
+
+TEST_CASE("Testing full tables of HeapProfiler", "[full]")
+{
+	HeapProfilerEvent events[16] {};
+	HeapProfilerCallSite callSites[1] {};
+	HeapProfiler::TrackedBlock trackedBlocks[2] {};
+	HeapProfiler profiler {HeapProfiler::EventsRange{events}, HeapProfiler::CallSitesRange{callSites},
+			HeapProfiler::TrackedBlocksRange{trackedBlocks}};
+
+	const auto firstCaller = makePointer(0x8000);
+	const auto secondCaller = makePointer(0x8010);
+	profiler.recordAllocation(makePointer(0x100), 16, firstCaller, {}, {});
+	// table of call sites is full
+	profiler.recordAllocation(makePointer(0x200), 16, secondCaller, {}, {});
+	profiler.recordAllocation(makePointer(0x300), 16, firstCaller, {}, {});
+	// table of tracked blocks is full
+	profiler.recordAllocation(makePointer(0x400), 16, firstCaller, {}, {});
+	// deallocation of untracked blocks doesn't modify counters
+	profiler.recordDeallocation(makePointer(0x200), 16, secondCaller, {}, {});
+	profiler.recordDeallocation(makePointer(0x400), 16, firstCaller, {}, {});
+
+	HeapProfilerEvent snapshotEvents[16] {};
+	HeapProfilerCallSite snapshotCallSites[2] {};
+
+	{
+		const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{snapshotEvents},
+				HeapProfiler::CallSitesRange{snapshotCallSites});
+		REQUIRE(snapshot.callSites == 1);
+		REQUIRE(snapshot.events == 6);
+		REQUIRE(snapshot.untrackedAllocations == 2);
+		REQUIRE(snapshotCallSites[0].caller == firstCaller);
+		REQUIRE(snapshotCallSites[0].allocations == 3);
+		REQUIRE(snapshotCallSites[0].liveBlocks == 2);
+		REQUIRE(snapshotCallSites[0].liveSize == 32);
+	}
+
+	// deallocation frees entry in the table of tracked blocks
+	profiler.recordDeallocation(makePointer(0x100), 16, firstCaller, {}, {});
+	profiler.recordAllocation(makePointer(0x500), 16, firstCaller, {}, {});
+
+	{
+		const auto snapshot = profiler.takeSnapshot(HeapProfiler::EventsRange{snapshotEvents},
+				HeapProfiler::CallSitesRange{snapshotCallSites});
+		REQUIRE(snapshot.untrackedAllocations == 2);
+		REQUIRE(snapshotCallSites[0].allocations == 4);
+		REQUIRE(snapshotCallSites[0].liveBlocks == 2);
+		REQUIRE(snapshotCallSites[0].liveSize == 32);
+	}
+}
+
+TEST_CASE("Testing random allocations and deallocations in HeapProfiler", "[random]")
+{
+	constexpr size_t maxLiveBlocks {48};
+	constexpr size_t callersCount {5};
+
+	HeapProfilerEvent events[8] {};
+	HeapProfilerCallSite callSites[8] {};
+	HeapProfiler::TrackedBlock trackedBlocks[64] {};
+	HeapProfiler profiler {HeapProfiler::EventsRange{events}, HeapProfiler::CallSitesRange{callSites},
+			HeapProfiler::TrackedBlocksRange{trackedBlocks}};
+
+	struct LiveBlock
+	{
+		const void* caller;
+		size_t size;
+	};
+
+	std::minstd_rand randomEngine {};
+	std::map<uintptr_t, LiveBlock> liveBlocks;
+	uintptr_t nextAddress {0x1000};
+	for (size_t iteration {}; iteration < 20000; ++iteration)
+	{
+		if (liveBlocks.size() == maxLiveBlocks || (liveBlocks.empty() == false && randomEngine() % 2 == 0))
+		{
+			auto iterator = liveBlocks.begin();
+			std::advance(iterator, randomEngine() % liveBlocks.size());
+			profiler.recordDeallocation(makePointer(iterator->first), iterator->second.size, {}, {}, {});
+			liveBlocks.erase(iterator);
+		}
+		else
+		{
+			const auto caller = makePointer(0x8000 + randomEngine() % callersCount * 4);
+			const size_t size {8 + randomEngine() % 256};
+			nextAddress += 8 * (1 + randomEngine() % 64);
+			profiler.recordAllocation(makePointer(nextAddress), size, caller, {}, {});
+			liveBlocks.emplace(nextAddress, LiveBlock{caller, size});
+		}
+	}
+
+	HeapProfilerCallSite snapshotCallSites[8] {};
+	const auto snapshot = profiler.takeSnapshot({}, HeapProfiler::CallSitesRange{snapshotCallSites});
+	REQUIRE(snapshot.events == 0);
+	REQUIRE(snapshot.untrackedAllocations == 0);
+	REQUIRE(snapshot.callSites == callersCount);
+
+	for (size_t i {}; i < snapshot.callSites; ++i)
+	{
+		size_t expectedLiveBlocks {};
+		size_t expectedLiveSize {};
+		for (const auto& liveBlock : liveBlocks)
+			if (liveBlock.second.caller == snapshotCallSites[i].caller)
+			{
+				++expectedLiveBlocks;
+				expectedLiveSize += liveBlock.second.size;
+			}
+
+		REQUIRE(snapshotCallSites[i].liveBlocks == expectedLiveBlocks);
+		REQUIRE(snapshotCallSites[i].liveSize == expectedLiveSize);
+	}
+}
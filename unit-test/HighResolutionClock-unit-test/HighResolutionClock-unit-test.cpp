@@ -0,0 +1,126 @@
+/**
+ * \file
+ * \brief HighResolutionClock test cases
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/HighResolutionClock.hpp"
+
+#include "distortos/architecture/getTickTimerCounter.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single read of tick count and counter of tick timer
+struct Sample
+{
+	/// tick count
+	uint64_t tickCount;
+
+	/// state of counter of tick timer
+	distortos::architecture::TickTimerCounter counter;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Calls HighResolutionClock::now() with tick count and counter of tick timer which don't change during the call.
+ *
+ * \param [in] sample is the sample returned by mocks
+ *
+ * \return value returned by HighResolutionClock::now(), nanoseconds
+ */
+
+int64_t getNow(const Sample& sample)
+{
+	distortos::internal::GetSchedulerMock getSchedulerMock;
+	distortos::internal::Scheduler schedulerMock;
+	distortos::architecture::GetTickTimerCounterMock getTickTimerCounterMock;
+	ALLOW_CALL(getSchedulerMock, getScheduler()).LR_RETURN(std::ref(schedulerMock));
+	ALLOW_CALL(schedulerMock, getTickCount()).RETURN(sample.tickCount);
+	REQUIRE_CALL(getTickTimerCounterMock, getTickTimerCounter()).RETURN(sample.counter);
+	return distortos::HighResolutionClock::now().time_since_epoch().count();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing interpolation between ticks", "[now]")
+{
+	REQUIRE(getNow({0, {0, 1000, false}}) == 0);
+	REQUIRE(getNow({5, {0, 1000, false}}) == 5000000);
+	REQUIRE(getNow({5, {500, 1000, false}}) == 5500000);
+	REQUIRE(getNow({5, {999, 1000, false}}) == 5999000);
+	// 1 cycle of 168 MHz counter is 5.95 ns, rounded down
+	REQUIRE(getNow({5, {1, 168000, false}}) == 5000005);
+	REQUIRE(getNow({1000000000000, {167999, 168000, false}}) == 1000000000000999994);
+}
+
+TEST_CASE("Testing pending tick interrupt", "[now]")
+{
+	REQUIRE(getNow({5, {0, 1000, true}}) == 6000000);
+	REQUIRE(getNow({5, {10, 1000, true}}) == 6010000);
+}
+
+TEST_CASE("Testing tick interrupt between reads", "[now]")
+{
+	distortos::internal::GetSchedulerMock getSchedulerMock;
+	distortos::internal::Scheduler schedulerMock;
+	distortos::architecture::GetTickTimerCounterMock getTickTimerCounterMock;
+	trompeloeil::sequence sequence;
+	ALLOW_CALL(getSchedulerMock, getScheduler()).LR_RETURN(std::ref(schedulerMock));
+	REQUIRE_CALL(schedulerMock, getTickCount()).IN_SEQUENCE(sequence).RETURN(5u);
+	REQUIRE_CALL(getTickTimerCounterMock, getTickTimerCounter()).IN_SEQUENCE(sequence)
+			.RETURN(distortos::architecture::TickTimerCounter{1, 1000, false});
+	REQUIRE_CALL(schedulerMock, getTickCount()).IN_SEQUENCE(sequence).RETURN(6u);
+	REQUIRE_CALL(schedulerMock, getTickCount()).IN_SEQUENCE(sequence).RETURN(6u);
+	REQUIRE_CALL(getTickTimerCounterMock, getTickTimerCounter()).IN_SEQUENCE(sequence)
+			.RETURN(distortos::architecture::TickTimerCounter{2, 1000, false});
+	REQUIRE_CALL(schedulerMock, getTickCount()).IN_SEQUENCE(sequence).RETURN(6u);
+	REQUIRE(distortos::HighResolutionClock::now().time_since_epoch().count() == 6002000);
+}
+
+TEST_CASE("Testing monotonicity across rollover of counter", "[now]")
+{
+	// period of 7 cycles doesn't divide the tick period of 1 ms, so each part of the result is rounded
+	const Sample samples[]
+	{
+			{5, {5, 7, false}},
+			{5, {6, 7, false}},
+			{5, {0, 7, true}},	// counter reached 0 before tick interrupt
+			{5, {1, 7, true}},	// tick interrupt is delayed
+			{6, {1, 7, false}},	// tick interrupt was handled
+			{6, {2, 7, false}},
+			{6, {6, 7, false}},
+			{7, {0, 7, false}},
+	};
+
+	int64_t previous {};
+	for (const auto& sample : samples)
+	{
+		const auto now = getNow(sample);
+		REQUIRE(now >= previous);
+		REQUIRE(now < static_cast<int64_t>(sample.tickCount + 2) * 1000000);
+		previous = now;
+	}
+	REQUIRE(previous == 7000000);
+}
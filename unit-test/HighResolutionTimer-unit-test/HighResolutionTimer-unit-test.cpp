@@ -0,0 +1,285 @@
+/**
+ * \file
+ * \brief HighResolutionTimer and HighResolutionTimerSupervisor test cases
+ *
+ * This test uses fake low-level driver of hardware timer, which simulates free-running counter with compare channel.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/HighResolutionTimerSupervisor.hpp"
+#include "distortos/StaticHighResolutionTimer.hpp"
+
+#include "distortos/devices/timers/CompareTimerLowLevel.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <vector>
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// fake low-level driver of hardware timer with compare channel
+class FakeCompareTimer : public distortos::devices::CompareTimerLowLevel
+{
+public:
+
+	/**
+	 * \brief FakeCompareTimer's constructor
+	 *
+	 * \param [in] frequency is the frequency of counter, Hz
+	 * \param [in] counter is the initial value of counter
+	 */
+
+	explicit FakeCompareTimer(const uint32_t frequency, const uint32_t counter = {}) :
+			compareTimerBase_{},
+			compare_{},
+			counter_{counter},
+			frequency_{frequency},
+			pending_{}
+	{
+
+	}
+
+	/**
+	 * \brief Advances the counter tick by tick, executing "compare match" events.
+	 *
+	 * \param [in] ticks is the number of ticks by which the counter will be advanced
+	 */
+
+	void advance(const uint32_t ticks)
+	{
+		handlePendingEvent();
+		for (uint32_t i {}; i < ticks; ++i)
+		{
+			++counter_;
+			if (compareTimerBase_ != nullptr && counter_ == compare_)
+				pending_ = true;
+			handlePendingEvent();
+		}
+	}
+
+	void generateEvent() override
+	{
+		pending_ = true;
+	}
+
+	uint32_t getCounter() const override
+	{
+		return counter_;
+	}
+
+	void setCompare(const uint32_t value) override
+	{
+		compare_ = value;
+	}
+
+	std::pair<int, uint32_t> start(distortos::devices::CompareTimerBase& compareTimerBase) override
+	{
+		if (compareTimerBase_ != nullptr)
+			return {EBADF, {}};
+
+		compareTimerBase_ = &compareTimerBase;
+		return {{}, frequency_};
+	}
+
+	int stop() override
+	{
+		if (compareTimerBase_ == nullptr)
+			return EBADF;
+
+		compareTimerBase_ = {};
+		return 0;
+	}
+
+	/**
+	 * \return value of compare channel
+	 */
+
+	uint32_t getCompare() const
+	{
+		return compare_;
+	}
+
+private:
+
+	/**
+	 * \brief Executes "compare match" events while any is pending.
+	 */
+
+	void handlePendingEvent()
+	{
+		while (pending_ == true && compareTimerBase_ != nullptr)
+		{
+			pending_ = false;
+			compareTimerBase_->compareMatchEvent();
+		}
+	}
+
+	/// pointer to associated CompareTimerBase object, nullptr if the driver is stopped
+	distortos::devices::CompareTimerBase* compareTimerBase_;
+
+	/// value of compare channel
+	uint32_t compare_;
+
+	/// value of counter
+	uint32_t counter_;
+
+	/// frequency of counter, Hz
+	uint32_t frequency_;
+
+	/// true if "compare match" event is pending
+	bool pending_;
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing start() and stop() of supervisor", "[supervisor]")
+{
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	ALLOW_CALL(interruptMaskingLockProxy, construct());
+	ALLOW_CALL(interruptMaskingLockProxy, destruct());
+
+	FakeCompareTimer fakeCompareTimer {1000000, 100};
+	distortos::HighResolutionTimerSupervisor supervisor {fakeCompareTimer};
+	REQUIRE(supervisor.getFrequency() == 0);
+	REQUIRE(supervisor.stop() == EBADF);
+
+	auto timer = distortos::makeStaticHighResolutionTimer(supervisor, []() {});
+	REQUIRE(timer.start(std::chrono::microseconds{1}) == EBADF);
+	REQUIRE(timer.isRunning() == false);
+
+	REQUIRE(supervisor.start() == 0);
+	REQUIRE(supervisor.start() == EBADF);
+	REQUIRE(supervisor.getFrequency() == 1000000);
+	REQUIRE(supervisor.now().time_since_epoch() == std::chrono::microseconds{100});
+	// no timer is running, but compare channel is programmed to detect wrap-around of the counter
+	REQUIRE(fakeCompareTimer.getCompare() == 100 + (1u << 31));
+
+	REQUIRE(timer.start(std::chrono::microseconds{10}) == 0);
+	REQUIRE(supervisor.stop() == EBUSY);
+	REQUIRE(timer.stop() == 0);
+	REQUIRE(supervisor.stop() == 0);
+	REQUIRE(supervisor.getFrequency() == 0);
+}
+
+TEST_CASE("Testing order and timing of expiration", "[timer]")
+{
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	ALLOW_CALL(interruptMaskingLockProxy, construct());
+	ALLOW_CALL(interruptMaskingLockProxy, destruct());
+
+	FakeCompareTimer fakeCompareTimer {1000000};
+	distortos::HighResolutionTimerSupervisor supervisor {fakeCompareTimer};
+	REQUIRE(supervisor.start() == 0);
+
+	std::vector<std::pair<int, int64_t>> log;
+	const auto callback = [&log, &supervisor](const int id)
+			{
+				log.emplace_back(id, std::chrono::duration_cast<std::chrono::microseconds>(
+						supervisor.now().time_since_epoch()).count());
+			};
+	auto timer1 = distortos::makeStaticHighResolutionTimer(supervisor, callback, 1);
+	auto timer2 = distortos::makeStaticHighResolutionTimer(supervisor, callback, 2);
+	auto timer3 = distortos::makeStaticHighResolutionTimer(supervisor, callback, 3);
+	auto timer4 = distortos::makeStaticHighResolutionTimer(supervisor, callback, 4);
+
+	REQUIRE(timer1.start(std::chrono::microseconds{30}) == 0);
+	REQUIRE(timer2.start(std::chrono::microseconds{10}) == 0);
+	REQUIRE(fakeCompareTimer.getCompare() == 10);
+	REQUIRE(timer3.start(std::chrono::nanoseconds{19001}) == 0);	// rounded up to 20 us
+	REQUIRE(timer4.start(std::chrono::microseconds{25}) == 0);
+	REQUIRE(timer4.stop() == 0);
+	REQUIRE(timer1.isRunning() == true);
+
+	fakeCompareTimer.advance(9);
+	REQUIRE(log.empty() == true);
+	fakeCompareTimer.advance(100);
+	const decltype(log) expectedLog {{2, 10}, {3, 20}, {1, 30}};
+	REQUIRE(log == expectedLog);
+	REQUIRE(timer1.isRunning() == false);
+	REQUIRE(timer4.isRunning() == false);
+	REQUIRE(timer3.getTimePoint().time_since_epoch() == std::chrono::microseconds{20});
+
+	REQUIRE(supervisor.stop() == 0);
+}
+
+TEST_CASE("Testing periodic restart from callback and passed deadlines", "[timer]")
+{
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	ALLOW_CALL(interruptMaskingLockProxy, construct());
+	ALLOW_CALL(interruptMaskingLockProxy, destruct());
+
+	// 3 MHz counter - time points are not integer number of ticks
+	FakeCompareTimer fakeCompareTimer {3000000};
+	distortos::HighResolutionTimerSupervisor supervisor {fakeCompareTimer};
+	REQUIRE(supervisor.start() == 0);
+
+	std::vector<uint32_t> expirations;
+	distortos::HighResolutionTimer* timerPointer {};
+	auto timer = distortos::makeStaticHighResolutionTimer(supervisor,
+			[&expirations, &fakeCompareTimer, &timerPointer]()
+			{
+				expirations.emplace_back(fakeCompareTimer.getCounter());
+				if (expirations.size() < 4)
+					timerPointer->start(timerPointer->getTimePoint() + std::chrono::microseconds{1});
+			});
+	timerPointer = &timer;
+
+	REQUIRE(timer.start(distortos::HighResolutionTimer::time_point{std::chrono::microseconds{5}}) == 0);
+	fakeCompareTimer.advance(100);
+	const decltype(expirations) expectedExpirations {15, 18, 21, 24};
+	REQUIRE(expirations == expectedExpirations);
+
+	// deadline which already passed is executed as soon as possible
+	expirations.clear();
+	REQUIRE(timer.start(distortos::HighResolutionTimer::time_point{std::chrono::microseconds{1}}) == 0);
+	fakeCompareTimer.advance(0);
+	REQUIRE(expirations.size() == 4);
+	REQUIRE(expirations.front() == 100);
+
+	REQUIRE(supervisor.stop() == 0);
+}
+
+TEST_CASE("Testing wrap-around of hardware counter", "[supervisor]")
+{
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	ALLOW_CALL(interruptMaskingLockProxy, construct());
+	ALLOW_CALL(interruptMaskingLockProxy, destruct());
+
+	FakeCompareTimer fakeCompareTimer {1000000, UINT32_MAX - 9};
+	distortos::HighResolutionTimerSupervisor supervisor {fakeCompareTimer};
+	REQUIRE(supervisor.start() == 0);
+
+	uint32_t expirations {};
+	auto timer = distortos::makeStaticHighResolutionTimer(supervisor, [&expirations]() { ++expirations; });
+	REQUIRE(timer.start(std::chrono::microseconds{20}) == 0);
+	REQUIRE(fakeCompareTimer.getCompare() == 10);
+
+	auto previous = supervisor.now();
+	for (int i {}; i < 30; ++i)
+	{
+		fakeCompareTimer.advance(1);
+		const auto now = supervisor.now();
+		REQUIRE(now > previous);
+		previous = now;
+		REQUIRE(expirations == (i >= 19 ? 1u : 0u));
+	}
+	REQUIRE(previous.time_since_epoch() == std::chrono::microseconds{UINT64_C(1) << 32} + std::chrono::microseconds{20});
+
+	REQUIRE(supervisor.stop() == 0);
+}
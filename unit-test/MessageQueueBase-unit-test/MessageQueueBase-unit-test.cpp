@@ -0,0 +1,216 @@
+/**
+ * \file
+ * \brief MessageQueueBase test cases
+ *
+ * This test checks ordering of elements in the queue. It is built twice - with the default sorted list of entries and
+ * with priority buckets enabled - so both implementations are checked with the same test cases.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/MessageQueueBase.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <array>
+#include <cstring>
+#include <map>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max number of elements in the queue
+constexpr size_t maxElements {64};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SemaphoreFunctor which never blocks and never fails
+class NonBlockingSemaphoreFunctor : public distortos::internal::SemaphoreFunctor
+{
+public:
+
+	int operator()(distortos::Semaphore&) const override
+	{
+		return 0;
+	}
+};
+
+/// QueueFunctor which copies value from storage
+class PopQueueFunctor : public distortos::internal::QueueFunctor
+{
+public:
+
+	explicit PopQueueFunctor(unsigned int& value) :
+			value_{value}
+	{
+
+	}
+
+	void operator()(void* const storage) const override
+	{
+		memcpy(&value_, storage, sizeof(value_));
+	}
+
+private:
+
+	unsigned int& value_;
+};
+
+/// QueueFunctor which copies value to storage
+class PushQueueFunctor : public distortos::internal::QueueFunctor
+{
+public:
+
+	explicit PushQueueFunctor(const unsigned int value) :
+			value_{value}
+	{
+
+	}
+
+	void operator()(void* const storage) const override
+	{
+		memcpy(storage, &value_, sizeof(value_));
+	}
+
+private:
+
+	unsigned int value_;
+};
+
+/// test fixture with MessageQueueBase and its storage
+class Fixture
+{
+public:
+
+	Fixture() :
+			entryStorage_{},
+			valueStorage_{},
+			semaphoreMock_{},
+			messageQueueBase_{{entryStorage_.data(), distortos::internal::dummyDeleter<EntryStorage>},
+					{valueStorage_.data(), distortos::internal::dummyDeleter<unsigned int>}, sizeof(unsigned int),
+					maxElements}
+	{
+
+	}
+
+	/**
+	 * \brief Pops element from the queue.
+	 *
+	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
+	 *
+	 * \return popped value
+	 */
+
+	unsigned int pop(uint8_t& priority)
+	{
+		REQUIRE_CALL(semaphoreMock_, post()).RETURN(0);
+		unsigned int value {};
+		REQUIRE(messageQueueBase_.pop(NonBlockingSemaphoreFunctor{}, priority, PopQueueFunctor{value}) == 0);
+		return value;
+	}
+
+	/**
+	 * \brief Pushes element to the queue.
+	 *
+	 * \param [in] priority is the priority of new element
+	 * \param [in] value is the value of new element
+	 */
+
+	void push(const uint8_t priority, const unsigned int value)
+	{
+		REQUIRE_CALL(semaphoreMock_, post()).RETURN(0);
+		REQUIRE(messageQueueBase_.push(NonBlockingSemaphoreFunctor{}, priority, PushQueueFunctor{value}) == 0);
+	}
+
+private:
+
+	/// type of uninitialized storage for Entry
+	using EntryStorage = distortos::internal::MessageQueueBase::EntryStorage;
+
+	/// storage for queue entries
+	std::array<EntryStorage, maxElements> entryStorage_;
+
+	/// storage for queue elements
+	std::array<unsigned int, maxElements> valueStorage_;
+
+	/// mock of semaphores used by MessageQueueBase
+	distortos::mock::Semaphore semaphoreMock_;
+
+	/// tested object
+	distortos::internal::MessageQueueBase messageQueueBase_;
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing order of elements with equal priority", "[order]")
+{
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	ALLOW_CALL(interruptMaskingLockProxy, construct());
+	ALLOW_CALL(interruptMaskingLockProxy, destruct());
+
+	Fixture fixture;
+
+	for (unsigned int value {}; value < maxElements; ++value)
+		fixture.push(42, value);
+
+	for (unsigned int value {}; value < maxElements; ++value)
+	{
+		uint8_t priority {};
+		REQUIRE(fixture.pop(priority) == value);
+		REQUIRE(priority == 42);
+	}
+}
+
+TEST_CASE("Testing order of elements with mixed priorities", "[order]")
+{
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	ALLOW_CALL(interruptMaskingLockProxy, construct());
+	ALLOW_CALL(interruptMaskingLockProxy, destruct());
+
+	Fixture fixture;
+
+	// reference model - elements sorted in descending order of priority, FIFO order within equal priority
+	std::multimap<uint8_t, unsigned int, std::greater<uint8_t>> expected;
+	uint32_t random {12345};
+	unsigned int nextValue {};
+
+	for (size_t iteration {}; iteration < 10000; ++iteration)
+	{
+		random = random * 1103515245 + 12345;
+		const auto pushElement = expected.empty() == true ||
+				(expected.size() < maxElements && (random >> 16) % 3 != 0);
+		if (pushElement == true)
+		{
+			// narrow range of priorities, so that elements with equal priorities are common, and also extreme values
+			const auto selector = (random >> 8) % 8;
+			const uint8_t priority = selector == 0 ? 0 : selector == 1 ? UINT8_MAX : 120 + (random >> 20) % 16;
+			fixture.push(priority, nextValue);
+			expected.emplace(priority, nextValue);
+			++nextValue;
+		}
+		else
+		{
+			uint8_t priority {};
+			const auto value = fixture.pop(priority);
+			REQUIRE(priority == expected.begin()->first);
+			REQUIRE(value == expected.begin()->second);
+			expected.erase(expected.begin());
+		}
+	}
+}
@@ -0,0 +1,282 @@
+/**
+ * \file
+ * \brief Mutex test cases
+ *
+ * This test checks fast path of Mutex - lock and unlock with compare-and-swap of owner and without masking interrupts
+ * when nobody waits for the mutex, slow unlock with transfer of lock when some thread blocked on the mutex and lazy
+ * insertion of mutex with priorityInheritance protocol into the list of mutexes owned by its owner.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/Mutex.hpp"
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// priority of thread which owns the mutex
+constexpr uint8_t ownerPriority {10};
+
+/// priority of thread which blocks on the mutex
+constexpr uint8_t waiterPriority {20};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing fast lock and unlock of mutex without waiters", "[fast]")
+{
+	distortos::internal::GetSchedulerMock getSchedulerMock;
+	distortos::internal::Scheduler schedulerMock;
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	distortos::internal::ThreadControlBlock owner;
+	distortos::internal::ThreadControlBlock other;
+	distortos::internal::ThreadControlBlock* currentThreadControlBlock {&owner};
+
+	ALLOW_CALL(getSchedulerMock, getScheduler()).LR_RETURN(std::ref(schedulerMock));
+	ALLOW_CALL(schedulerMock, getCurrentThreadControlBlock()).LR_RETURN(std::ref(*currentThreadControlBlock));
+	// fast path doesn't touch the list of owned mutexes or priorities of threads
+	FORBID_CALL(owner, getOwnedProtocolMutexList());
+	FORBID_CALL(owner, updateBoostedPriority());
+	FORBID_CALL(owner, updateBoostedPriority(_));
+	FORBID_CALL(other, getOwnedProtocolMutexList());
+	FORBID_CALL(schedulerMock, unblock(_));
+
+	for (const auto protocol : {distortos::Mutex::Protocol::none, distortos::Mutex::Protocol::priorityInheritance})
+		for (const auto type : {distortos::Mutex::Type::normal, distortos::Mutex::Type::errorChecking,
+				distortos::Mutex::Type::recursive})
+		{
+			DYNAMIC_SECTION("Testing protocol " << static_cast<int>(protocol) << ", type " << static_cast<int>(type))
+			{
+				distortos::Mutex mutex {type, protocol};
+
+				{
+					FORBID_CALL(interruptMaskingLockProxy, construct());
+					REQUIRE(mutex.lock() == 0);
+				}
+
+				// the mutex is locked, so other thread must use slow path, which fails
+				currentThreadControlBlock = &other;
+				{
+					REQUIRE_CALL(interruptMaskingLockProxy, construct());
+					REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+					REQUIRE(mutex.tryLock() == EBUSY);
+				}
+
+				currentThreadControlBlock = &owner;
+				{
+					FORBID_CALL(interruptMaskingLockProxy, construct());
+					REQUIRE(mutex.unlock() == 0);
+				}
+
+				// the mutex is unlocked, so other thread can use fast path
+				currentThreadControlBlock = &other;
+				{
+					FORBID_CALL(interruptMaskingLockProxy, construct());
+					REQUIRE(mutex.tryLock() == 0);
+					REQUIRE(mutex.unlock() == 0);
+				}
+				currentThreadControlBlock = &owner;
+			}
+		}
+}
+
+TEST_CASE("Testing fast path of mutex with priorityProtect protocol", "[fast]")
+{
+	distortos::internal::GetSchedulerMock getSchedulerMock;
+	distortos::internal::Scheduler schedulerMock;
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	distortos::internal::ThreadControlBlock owner;
+	distortos::internal::MutexList ownedList;
+
+	ALLOW_CALL(getSchedulerMock, getScheduler()).LR_RETURN(std::ref(schedulerMock));
+	ALLOW_CALL(schedulerMock, getCurrentThreadControlBlock()).LR_RETURN(std::ref(owner));
+	ALLOW_CALL(owner, getPriority()).RETURN(ownerPriority);
+	ALLOW_CALL(owner, getOwnedProtocolMutexList()).LR_RETURN(std::ref(ownedList));
+	ALLOW_CALL(owner, updateBoostedPriority());
+
+	distortos::Mutex mutex {distortos::Mutex::Protocol::priorityProtect, waiterPriority};
+
+	// priority ceiling must be applied immediately, so fast path is never used
+	{
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		REQUIRE(mutex.lock() == 0);
+	}
+	REQUIRE(ownedList.empty() == false);
+	{
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		REQUIRE(mutex.unlock() == 0);
+	}
+	REQUIRE(ownedList.empty() == true);
+}
+
+TEST_CASE("Testing slow unlock with transfer of lock to blocked thread", "[transfer]")
+{
+	distortos::internal::GetSchedulerMock getSchedulerMock;
+	distortos::internal::Scheduler schedulerMock;
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	distortos::internal::ThreadControlBlock owner;
+	distortos::internal::ThreadControlBlock waiter;
+	distortos::internal::ThreadControlBlock* currentThreadControlBlock {&owner};
+
+	ALLOW_CALL(getSchedulerMock, getScheduler()).LR_RETURN(std::ref(schedulerMock));
+	ALLOW_CALL(schedulerMock, getCurrentThreadControlBlock()).LR_RETURN(std::ref(*currentThreadControlBlock));
+	ALLOW_CALL(owner, getEffectivePriority()).RETURN(ownerPriority);
+	ALLOW_CALL(waiter, getEffectivePriority()).RETURN(waiterPriority);
+	FORBID_CALL(owner, getOwnedProtocolMutexList());
+	FORBID_CALL(waiter, getOwnedProtocolMutexList());
+
+	distortos::Mutex mutex;
+
+	{
+		FORBID_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE(mutex.lock() == 0);
+	}
+
+	// waiter blocks on the mutex, owner unlocks it while waiter is blocked
+	currentThreadControlBlock = &waiter;
+	{
+		// slow paths of lock and nested unlock
+		REQUIRE_CALL(interruptMaskingLockProxy, construct()).TIMES(2);
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct()).TIMES(2);
+		trompeloeil::sequence sequence;
+		REQUIRE_CALL(schedulerMock, block(_, distortos::ThreadState::blockedOnMutex, nullptr)).IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(
+						_1.insert(waiter);
+						currentThreadControlBlock = &owner;
+						// fast path is not possible, as the mutex has a waiter
+						REQUIRE(mutex.unlock() == 0);
+						REQUIRE(_1.empty() == true);
+						currentThreadControlBlock = &waiter;
+				)
+				.RETURN(0);
+		// nested slow unlock done by owner
+		REQUIRE_CALL(schedulerMock, unblock(_)).IN_SEQUENCE(sequence)
+				.SIDE_EFFECT(distortos::internal::ThreadList::erase(_1));
+		REQUIRE(mutex.lock() == 0);
+	}
+
+	// the lock was transferred to waiter, now it is locked, so owner cannot lock it
+	currentThreadControlBlock = &owner;
+	{
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		REQUIRE(mutex.tryLock() == EBUSY);
+	}
+
+	// transferred lock must be released via slow path
+	currentThreadControlBlock = &waiter;
+	{
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		FORBID_CALL(schedulerMock, unblock(_));
+		REQUIRE(mutex.unlock() == 0);
+	}
+
+	// the mutex has no waiters, so fast path is possible again
+	{
+		FORBID_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE(mutex.lock() == 0);
+		REQUIRE(mutex.unlock() == 0);
+	}
+}
+
+TEST_CASE("Testing lazy insertion of mutex with priorityInheritance protocol into list of owned mutexes",
+		"[priorityInheritance]")
+{
+	distortos::internal::GetSchedulerMock getSchedulerMock;
+	distortos::internal::Scheduler schedulerMock;
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	distortos::internal::ThreadControlBlock owner;
+	distortos::internal::ThreadControlBlock waiter;
+	distortos::internal::ThreadControlBlock* currentThreadControlBlock {&owner};
+	distortos::internal::MutexList ownerOwnedList;
+	distortos::internal::MutexList waiterOwnedList;
+
+	ALLOW_CALL(getSchedulerMock, getScheduler()).LR_RETURN(std::ref(schedulerMock));
+	ALLOW_CALL(schedulerMock, getCurrentThreadControlBlock()).LR_RETURN(std::ref(*currentThreadControlBlock));
+	ALLOW_CALL(owner, getEffectivePriority()).RETURN(ownerPriority);
+	ALLOW_CALL(waiter, getEffectivePriority()).RETURN(waiterPriority);
+	ALLOW_CALL(owner, getOwnedProtocolMutexList()).LR_RETURN(std::ref(ownerOwnedList));
+	ALLOW_CALL(waiter, getOwnedProtocolMutexList()).LR_RETURN(std::ref(waiterOwnedList));
+
+	distortos::Mutex mutex {distortos::Mutex::Protocol::priorityInheritance};
+
+	{
+		FORBID_CALL(interruptMaskingLockProxy, construct());
+		FORBID_CALL(owner, updateBoostedPriority());
+		FORBID_CALL(owner, updateBoostedPriority(_));
+		REQUIRE(mutex.lock() == 0);
+	}
+	// nobody waits for the mutex, so it cannot boost priority of the owner and is not on the list
+	REQUIRE(ownerOwnedList.empty() == true);
+
+	currentThreadControlBlock = &waiter;
+	{
+		ALLOW_CALL(interruptMaskingLockProxy, construct());
+		ALLOW_CALL(interruptMaskingLockProxy, destruct());
+		trompeloeil::sequence sequence;
+		REQUIRE_CALL(waiter, setPriorityInheritanceMutexControlBlock(_)).WITH(_1 != nullptr).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(owner, updateBoostedPriority(waiterPriority)).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(schedulerMock, block(_, distortos::ThreadState::blockedOnMutex, _)).WITH(_3 != nullptr)
+				.IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(
+						// the mutex was added to the list of owner when the first thread blocked on it
+						REQUIRE(ownerOwnedList.empty() == false);
+						REQUIRE(waiterOwnedList.empty() == true);
+						_1.insert(waiter);
+						currentThreadControlBlock = &owner;
+						REQUIRE(mutex.unlock() == 0);
+						currentThreadControlBlock = &waiter;
+				)
+				.RETURN(0);
+		// nested slow unlock done by owner
+		REQUIRE_CALL(schedulerMock, unblock(_)).IN_SEQUENCE(sequence)
+				.SIDE_EFFECT(distortos::internal::ThreadList::erase(_1));
+		REQUIRE_CALL(waiter, setPriorityInheritanceMutexControlBlock(nullptr)).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(owner, updateBoostedPriority()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(waiter, updateBoostedPriority()).IN_SEQUENCE(sequence);
+		REQUIRE(mutex.lock() == 0);
+	}
+
+	// the mutex was moved to the list of new owner together with the lock
+	REQUIRE(ownerOwnedList.empty() == true);
+	REQUIRE(waiterOwnedList.empty() == false);
+
+	{
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		REQUIRE_CALL(waiter, updateBoostedPriority());
+		REQUIRE(mutex.unlock() == 0);
+	}
+	REQUIRE(waiterOwnedList.empty() == true);
+
+	// the mutex is neither locked nor on any list, so fast path is possible again
+	{
+		FORBID_CALL(interruptMaskingLockProxy, construct());
+		FORBID_CALL(waiter, updateBoostedPriority());
+		REQUIRE(mutex.lock() == 0);
+		REQUIRE(mutex.unlock() == 0);
+	}
+	REQUIRE(waiterOwnedList.empty() == true);
+}
@@ -0,0 +1,81 @@
+/**
+ * \file
+ * \brief MutexProfile test cases
+ *
+ * This test checks whether MutexProfile correctly counts acquisitions and boosts, and accumulates total and max
+ * durations of holds and waits.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/synchronization/MutexProfile.hpp"
+
+using distortos::HighResolutionClock;
+using distortos::internal::MutexProfile;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing initial state of MutexProfile", "[initial]")
+{
+	const MutexProfile mutexProfile;
+	const auto statistics = mutexProfile.getStatistics();
+	REQUIRE(statistics.acquisitions == 0);
+	REQUIRE(statistics.contendedAcquisitions == 0);
+	REQUIRE(statistics.maxHoldTime == HighResolutionClock::duration{});
+	REQUIRE(statistics.maxWaitTime == HighResolutionClock::duration{});
+	REQUIRE(statistics.mutex == nullptr);
+	REQUIRE(statistics.priorityInheritanceBoosts == 0);
+	REQUIRE(statistics.totalHoldTime == HighResolutionClock::duration{});
+	REQUIRE(statistics.totalWaitTime == HighResolutionClock::duration{});
+}
+
+TEST_CASE("Testing acquisitions and hold times of MutexProfile", "[hold]")
+{
+	using TimePoint = HighResolutionClock::time_point;
+	using Duration = HighResolutionClock::duration;
+
+	MutexProfile mutexProfile;
+
+	mutexProfile.recordLock(TimePoint{Duration{100}}, false);
+	mutexProfile.recordUnlock(TimePoint{Duration{130}});
+	mutexProfile.recordLock(TimePoint{Duration{200}}, true);
+	mutexProfile.recordUnlock(TimePoint{Duration{250}});
+	mutexProfile.recordLock(TimePoint{Duration{300}}, false);
+	mutexProfile.recordUnlock(TimePoint{Duration{310}});
+
+	const auto statistics = mutexProfile.getStatistics();
+	REQUIRE(statistics.acquisitions == 3);
+	REQUIRE(statistics.contendedAcquisitions == 1);
+	REQUIRE(statistics.maxHoldTime == Duration{50});
+	REQUIRE(statistics.totalHoldTime == Duration{90});
+	REQUIRE(statistics.maxWaitTime == Duration{});
+	REQUIRE(statistics.totalWaitTime == Duration{});
+}
+
+TEST_CASE("Testing waits and boosts of MutexProfile", "[wait]")
+{
+	using Duration = HighResolutionClock::duration;
+
+	MutexProfile mutexProfile;
+
+	mutexProfile.recordWait(Duration{20});
+	mutexProfile.recordWait(Duration{70});
+	mutexProfile.recordWait(Duration{5});
+	mutexProfile.recordBoost();
+	mutexProfile.recordBoost();
+
+	const auto statistics = mutexProfile.getStatistics();
+	REQUIRE(statistics.maxWaitTime == Duration{70});
+	REQUIRE(statistics.totalWaitTime == Duration{95});
+	REQUIRE(statistics.priorityInheritanceBoosts == 2);
+	REQUIRE(statistics.acquisitions == 0);
+	REQUIRE(statistics.maxHoldTime == Duration{});
+}
@@ -0,0 +1,177 @@
+/**
+ * \file
+ * \brief RecordBuffer test cases
+ *
+ * This test checks whether RecordBuffer stores records of various sizes in correct order, wraps them around the end of
+ * storage with padding and properly reports lack of free space.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/synchronization/RecordBuffer.hpp"
+
+#include <deque>
+#include <vector>
+
+using distortos::internal::RecordBuffer;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Generates record with given size and contents.
+ *
+ * \param [in] size is the size of generated record, bytes
+ * \param [in] seed is the value of first byte of generated record
+ *
+ * \return generated record
+ */
+
+std::vector<uint8_t> makeRecord(const size_t size, const uint8_t seed)
+{
+	std::vector<uint8_t> record (size);
+	for (size_t i {}; i < size; ++i)
+		record[i] = static_cast<uint8_t>(seed + i);
+	return record;
+}
+
+/**
+ * \brief Pops the first record from RecordBuffer.
+ *
+ * \param [in] recordBuffer is a reference to RecordBuffer from which the record will be popped
+ *
+ * \return popped record
+ */
+
+std::vector<uint8_t> popRecord(RecordBuffer& recordBuffer)
+{
+	std::vector<uint8_t> record (recordBuffer.getFirstRecordSize());
+	REQUIRE(recordBuffer.pop(record.data()) == record.size());
+	return record;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing capacity of RecordBuffer", "[capacity]")
+{
+	constexpr auto headerSize = RecordBuffer::headerSize;
+	alignas(headerSize) uint8_t storage[10 * headerSize + headerSize / 2];
+	RecordBuffer recordBuffer {storage, sizeof(storage)};
+
+	REQUIRE(recordBuffer.getCapacity() == 10 * headerSize);
+	REQUIRE(recordBuffer.getMaxRecordSize() == 9 * headerSize);
+	REQUIRE(recordBuffer.getMaxRecords() == 10);
+	REQUIRE(recordBuffer.isEmpty() == true);
+	REQUIRE(recordBuffer.isFull() == false);
+
+	for (size_t i {}; i < recordBuffer.getMaxRecords(); ++i)
+		REQUIRE(recordBuffer.tryPush(nullptr, 0) == true);
+	REQUIRE(recordBuffer.isFull() == true);
+	REQUIRE(recordBuffer.tryPush(nullptr, 0) == false);
+
+	for (size_t i {}; i < recordBuffer.getMaxRecords(); ++i)
+		REQUIRE(popRecord(recordBuffer).empty() == true);
+	REQUIRE(recordBuffer.isEmpty() == true);
+
+	const auto record = makeRecord(recordBuffer.getMaxRecordSize(), 0x11);
+	REQUIRE(recordBuffer.tryPush(record.data(), record.size()) == true);
+	REQUIRE(recordBuffer.isFull() == true);
+	REQUIRE(popRecord(recordBuffer) == record);
+	REQUIRE(recordBuffer.isEmpty() == true);
+}
+
+TEST_CASE("Testing wrap-around of RecordBuffer", "[wrap-around]")
+{
+	constexpr auto headerSize = RecordBuffer::headerSize;
+	alignas(headerSize) uint8_t storage[8 * headerSize];
+	RecordBuffer recordBuffer {storage, sizeof(storage)};
+
+	// [AAAABB--] - A occupies header + 3 words, B occupies header + 1 word
+	const auto recordA = makeRecord(2 * headerSize + 1, 0x20);
+	const auto recordB = makeRecord(headerSize, 0x40);
+	REQUIRE(recordBuffer.tryPush(recordA.data(), recordA.size()) == true);
+	REQUIRE(recordBuffer.tryPush(recordB.data(), recordB.size()) == true);
+
+	// [----BB--]
+	REQUIRE(popRecord(recordBuffer) == recordA);
+
+	// C doesn't fit neither at the end nor at the beginning of storage
+	const auto recordC = makeRecord(4 * headerSize, 0x60);
+	REQUIRE(recordBuffer.tryPush(recordC.data(), recordC.size()) == false);
+
+	// [DDDDBBPP] - D is written at the beginning, P is padding
+	const auto recordD = makeRecord(3 * headerSize, 0x80);
+	REQUIRE(recordBuffer.tryPush(recordD.data(), recordD.size()) == true);
+	REQUIRE(recordBuffer.isFull() == true);
+	REQUIRE(recordBuffer.tryPush(nullptr, 0) == false);
+
+	REQUIRE(recordBuffer.getFirstRecordSize() == recordB.size());
+	REQUIRE(popRecord(recordBuffer) == recordB);
+
+	// padding is skipped
+	REQUIRE(recordBuffer.getFirstRecordSize() == recordD.size());
+	REQUIRE(popRecord(recordBuffer) == recordD);
+	REQUIRE(recordBuffer.isEmpty() == true);
+
+	// empty buffer starts from the beginning of storage, so even the largest record fits
+	const auto recordE = makeRecord(recordBuffer.getMaxRecordSize(), 0xa0);
+	REQUIRE(recordBuffer.tryPush(recordE.data(), recordE.size()) == true);
+	REQUIRE(popRecord(recordBuffer) == recordE);
+}
+
+TEST_CASE("Testing random sequence of operations on RecordBuffer", "[random]")
+{
+	constexpr auto headerSize = RecordBuffer::headerSize;
+	alignas(headerSize) uint8_t storage[37 * headerSize];
+	RecordBuffer recordBuffer {storage, sizeof(storage)};
+	std::deque<std::vector<uint8_t>> reference;
+
+	uint32_t state {0x12345678};
+	const auto random = [&state]()
+			{
+				state = state * 1664525 + 1013904223;
+				return state >> 8;
+			};
+
+	for (size_t iteration {}; iteration < 10000; ++iteration)
+	{
+		if (random() % 3 != 0)
+		{
+			const auto record = makeRecord(random() % (recordBuffer.getMaxRecordSize() / 3 + 1),
+					static_cast<uint8_t>(iteration));
+			if (recordBuffer.tryPush(record.data(), record.size()) == true)
+				reference.push_back(record);
+			else
+				REQUIRE(reference.empty() == false);
+		}
+		else if (reference.empty() == false)
+		{
+			REQUIRE(recordBuffer.isEmpty() == false);
+			REQUIRE(popRecord(recordBuffer) == reference.front());
+			reference.pop_front();
+		}
+
+		REQUIRE(recordBuffer.isEmpty() == reference.empty());
+	}
+
+	while (reference.empty() == false)
+	{
+		REQUIRE(popRecord(recordBuffer) == reference.front());
+		reference.pop_front();
+	}
+	REQUIRE(recordBuffer.isEmpty() == true);
+}
@@ -0,0 +1,350 @@
+/**
+ * \file
+ * \brief Stack::updateHighWaterMark() and StackMonitor test cases
+ *
+ * This test checks lazy painting of the stack, incremental scan of its "high water mark" and calls of
+ * stackUsageWarningHook() done by StackMonitor. Stack has 64 elements (without "stack guard") and each step of painting
+ * or scanning processes 16 elements.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/Stack.hpp"
+#include "distortos/internal/scheduler/StackMonitor.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include "distortos/architecture/initializeStack.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/stackUsageWarningHook.hpp"
+
+#include <algorithm>
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements in "stack guard"
+constexpr size_t guardElements {DISTORTOS_STACK_GUARD_SIZE / sizeof(uint32_t)};
+
+/// number of elements of stack, excluding "stack guard"
+constexpr size_t stackElements {64};
+
+/// total number of elements in stack's storage
+constexpr size_t totalElements {guardElements + stackElements};
+
+/// number of elements of initial stack frame created by initializeStack()
+constexpr size_t frameElements {4};
+
+/// initial value of all elements of stack's storage, different from stack sentinel
+constexpr uint32_t initialValue {0x12345678};
+
+/// value written to stack by "thread" in the test cases, different from stack sentinel
+constexpr uint32_t usedValue {0x87654321};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TestStack class is a Stack with its own storage
+class TestStack
+{
+public:
+
+	/**
+	 * \brief TestStack's constructor
+	 *
+	 * Fills the storage with initialValue and initializes the stack.
+	 */
+
+	TestStack() :
+			storage{},
+			stack{{storage, distortos::internal::dummyDeleter<uint32_t>}, sizeof(storage)}
+	{
+		std::fill(std::begin(storage), std::end(storage), initialValue);
+		REQUIRE(stack.initialize(reinterpret_cast<distortos::internal::RunnableThread&>(storage)) == 0);
+	}
+
+	/**
+	 * \return value of stack sentinel, read from "stack guard"
+	 */
+
+	uint32_t getSentinel() const
+	{
+		return storage[0];
+	}
+
+	/**
+	 * \brief Checks whether all elements in given range of storage are equal to given value.
+	 *
+	 * \param [in] begin is the index of first element
+	 * \param [in] end is the index one past the last element
+	 * \param [in] value is the expected value
+	 *
+	 * \return true if all elements in range are equal to \a value, false otherwise
+	 */
+
+	bool isFilled(const size_t begin, const size_t end, const uint32_t value) const
+	{
+		return std::all_of(storage + begin, storage + end,
+				[value](const uint32_t element) -> bool
+				{
+					return element == value;
+				});
+	}
+
+	/// storage for stack
+	alignas(DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT) uint32_t storage[totalElements];
+
+	/// tested stack
+	distortos::internal::Stack stack;
+};
+
+/// StackUsageWarningHookMock class is a mock of stackUsageWarningHook()
+class StackUsageWarningHookMock
+{
+public:
+
+	/**
+	 * \brief StackUsageWarningHookMock's constructor
+	 */
+
+	StackUsageWarningHookMock()
+	{
+		REQUIRE(getInstance() == nullptr);
+		getInstance() = this;
+	}
+
+	/**
+	 * \brief StackUsageWarningHookMock's destructor
+	 */
+
+	~StackUsageWarningHookMock()
+	{
+		REQUIRE(getInstance() != nullptr);
+		getInstance() = {};
+	}
+
+	MAKE_MOCK2(hook, void(distortos::ThreadIdentifier, size_t));
+
+	/**
+	 * \return reference to pointer to current instance of mock
+	 */
+
+	static StackUsageWarningHookMock*& getInstance()
+	{
+		static StackUsageWarningHookMock* instance;
+		return instance;
+	}
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Calls Stack::updateHighWaterMark() given number of times.
+ *
+ * \param [in] stack is a reference to stack
+ * \param [in] steps is the number of steps
+ */
+
+void updateHighWaterMark(distortos::internal::Stack& stack, const size_t steps)
+{
+	for (size_t i {}; i < steps; ++i)
+		stack.updateHighWaterMark();
+}
+
+}	// namespace
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+namespace architecture
+{
+
+std::pair<int, void*> initializeStack(void* const buffer, const size_t size, internal::RunnableThread&)
+{
+	const auto stackPointer = static_cast<uint32_t*>(buffer) + size / sizeof(uint32_t) - frameElements;
+	std::fill_n(stackPointer, frameElements, usedValue);
+	return {{}, stackPointer};
+}
+
+}	// namespace architecture
+
+void stackUsageWarningHook(const ThreadIdentifier threadIdentifier, const size_t highWaterMark)
+{
+	const auto instance = StackUsageWarningHookMock::getInstance();
+	REQUIRE(instance != nullptr);
+	instance->hook(threadIdentifier, highWaterMark);
+}
+
+}	// namespace distortos
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing lazy painting and incremental scan of stack", "[updateHighWaterMark]")
+{
+	TestStack testStack;
+	auto& stack = testStack.stack;
+	const auto sentinel = testStack.getSentinel();
+
+	REQUIRE(stack.checkStackGuard() == true);
+	REQUIRE(stack.getSize() == stackElements * sizeof(uint32_t));
+	REQUIRE(stack.getHighWaterMark() == frameElements * sizeof(uint32_t));
+	// only "stack guard" is painted by Stack::initialize()
+	REQUIRE(testStack.isFilled(guardElements, totalElements - frameElements, initialValue) == true);
+
+	const auto frontier = totalElements - frameElements;
+
+	SECTION("Painting moves the frontier down by one chunk in each step, until \"stack guard\" is reached")
+	{
+		stack.updateHighWaterMark();
+		REQUIRE(testStack.isFilled(frontier - 16, frontier, sentinel) == true);
+		REQUIRE(testStack.isFilled(guardElements, frontier - 16, initialValue) == true);
+
+		updateHighWaterMark(stack, 3);
+		REQUIRE(testStack.isFilled(guardElements, frontier, sentinel) == true);
+		REQUIRE(testStack.isFilled(frontier, totalElements, usedValue) == true);
+		REQUIRE(stack.checkStackGuard() == true);
+		REQUIRE(stack.getHighWaterMark() == frameElements * sizeof(uint32_t));
+
+		// scan of fully painted stack doesn't change anything
+		updateHighWaterMark(stack, 16);
+		REQUIRE(testStack.isFilled(guardElements, frontier, sentinel) == true);
+		REQUIRE(stack.getHighWaterMark() == frameElements * sizeof(uint32_t));
+	}
+	SECTION("Scan finds used part of painted stack and restarts from \"stack guard\"")
+	{
+		updateHighWaterMark(stack, 4);
+
+		testStack.storage[40] = usedValue;
+		updateHighWaterMark(stack, 4);
+		REQUIRE(stack.getHighWaterMark() == (totalElements - 40) * sizeof(uint32_t));
+		REQUIRE(testStack.storage[40] == usedValue);
+
+		// deeper usage is found by the next pass of the scan
+		testStack.storage[20] = usedValue;
+		updateHighWaterMark(stack, 4);
+		REQUIRE(stack.getHighWaterMark() == (totalElements - 20) * sizeof(uint32_t));
+
+		// "high water mark" never goes down
+		testStack.storage[20] = sentinel;
+		testStack.storage[40] = sentinel;
+		updateHighWaterMark(stack, 16);
+		REQUIRE(stack.getHighWaterMark() == (totalElements - 20) * sizeof(uint32_t));
+	}
+	SECTION("Stack pointer saved during context switch lowers \"high water mark\" and limits painting")
+	{
+		testStack.storage[30] = usedValue;
+		stack.setStackPointer(testStack.storage + 30);
+		REQUIRE(stack.getHighWaterMark() == (totalElements - 30) * sizeof(uint32_t));
+
+		updateHighWaterMark(stack, 8);
+		REQUIRE(testStack.isFilled(31, frontier, initialValue) == true);
+		REQUIRE(testStack.isFilled(guardElements, 30, sentinel) == true);
+		REQUIRE(stack.getHighWaterMark() == (totalElements - 30) * sizeof(uint32_t));
+	}
+	SECTION("Usage of stack which was not painted yet and was not seen in context switch is underestimated")
+	{
+		// "thread" used element 40 and returned before context switch, painting did not reach that element yet
+		testStack.storage[40] = usedValue;
+		updateHighWaterMark(stack, 4);
+		REQUIRE(testStack.storage[40] == sentinel);
+
+		updateHighWaterMark(stack, 16);
+		REQUIRE(stack.getHighWaterMark() == frameElements * sizeof(uint32_t));
+	}
+}
+
+TEST_CASE("Testing calls of stackUsageWarningHook()", "[StackMonitor]")
+{
+	distortos::internal::GetSchedulerMock getSchedulerMock;
+	distortos::internal::Scheduler schedulerMock;
+	distortos::InterruptMaskingLock::Proxy interruptMaskingLockProxy;
+	distortos::internal::ThreadControlBlock currentThreadControlBlock;
+	distortos::internal::ThreadControlBlock threadControlBlock;
+	StackUsageWarningHookMock stackUsageWarningHookMock;
+	TestStack testStack;
+
+	ALLOW_CALL(getSchedulerMock, getScheduler()).LR_RETURN(std::ref(schedulerMock));
+	ALLOW_CALL(schedulerMock, getCurrentThreadControlBlock()).LR_RETURN(std::ref(currentThreadControlBlock));
+	ALLOW_CALL(threadControlBlock, getSequenceNumber()).RETURN(1);
+	ALLOW_CALL(threadControlBlock, getStack()).LR_RETURN(std::ref(testStack.stack));
+	ALLOW_CALL(threadControlBlock, getState()).RETURN(distortos::ThreadState::runnable);
+
+	distortos::internal::StackMonitor stackMonitor;
+
+	{
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		stackMonitor.add(threadControlBlock);
+	}
+	{
+		// usage of stack is below the threshold
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		FORBID_CALL(stackUsageWarningHookMock, hook(_, _));
+		stackMonitor.step();
+	}
+
+	constexpr size_t depth {stackElements / 2 + 8};
+	testStack.stack.setStackPointer(testStack.storage + totalElements - depth);
+
+	{
+		// hook is called after interrupts are unmasked
+		trompeloeil::sequence sequence;
+		REQUIRE_CALL(interruptMaskingLockProxy, construct()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct()).IN_SEQUENCE(sequence);
+		REQUIRE_CALL(stackUsageWarningHookMock, hook(_, depth * sizeof(uint32_t))).IN_SEQUENCE(sequence);
+		stackMonitor.step();
+	}
+	{
+		// warning is reported only once
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		FORBID_CALL(stackUsageWarningHookMock, hook(_, _));
+		stackMonitor.step();
+	}
+	{
+		// current thread is not processed
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		REQUIRE_CALL(schedulerMock, getCurrentThreadControlBlock()).LR_RETURN(std::ref(threadControlBlock));
+		FORBID_CALL(threadControlBlock, getStack());
+		stackMonitor.step();
+	}
+	{
+		// terminated thread is removed from the monitor
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		REQUIRE_CALL(threadControlBlock, getState()).RETURN(distortos::ThreadState::terminated);
+		stackMonitor.step();
+	}
+	{
+		REQUIRE_CALL(interruptMaskingLockProxy, construct());
+		REQUIRE_CALL(interruptMaskingLockProxy, destruct());
+		FORBID_CALL(threadControlBlock, getState());
+		stackMonitor.step();
+	}
+}
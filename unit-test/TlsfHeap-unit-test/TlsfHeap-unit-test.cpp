@@ -0,0 +1,255 @@
+/**
+ * \file
+ * \brief TlsfHeap test cases
+ *
+ * This test checks whether TlsfHeap allocates properly aligned and non-overlapping blocks, coalesces free blocks,
+ * resizes blocks in place when possible and reports correct statistics. The heap uses a RAM arena on the host.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#include <random>
+#include <vector>
+
+#include <cstring>
+
+using distortos::internal::TlsfHeap;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of arena used in tests, bytes
+constexpr size_t arenaSize {64 * 1024};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// Allocation struct describes one allocated block of memory
+struct Allocation
+{
+	/// pointer to allocated block of memory
+	uint8_t* pointer;
+
+	/// size of allocated block of memory, bytes
+	size_t size;
+
+	/// value of first byte of pattern written to allocated block of memory
+	uint8_t seed;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Fills allocated block of memory with a pattern.
+ *
+ * \param [in] allocation is a reference to Allocation which will be filled
+ */
+
+void fillPattern(const Allocation& allocation)
+{
+	for (size_t i {}; i < allocation.size; ++i)
+		allocation.pointer[i] = static_cast<uint8_t>(allocation.seed + i);
+}
+
+/**
+ * \brief Checks whether allocated block of memory contains a pattern.
+ *
+ * \param [in] allocation is a reference to Allocation which will be checked
+ *
+ * \return true if allocated block of memory contains the pattern, false otherwise
+ */
+
+bool checkPattern(const Allocation& allocation)
+{
+	for (size_t i {}; i < allocation.size; ++i)
+		if (allocation.pointer[i] != static_cast<uint8_t>(allocation.seed + i))
+			return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing initialization of TlsfHeap", "[initialize]")
+{
+	alignas(TlsfHeap::alignment) static uint8_t arena[arenaSize];
+
+	{
+		TlsfHeap heap;
+		REQUIRE(heap.initialize(arena, 4) == EINVAL);
+	}
+
+	TlsfHeap heap;
+	REQUIRE(heap.initialize(arena + 1, sizeof(arena) - 1) == 0);
+
+	const auto statistics = heap.getStatistics();
+	REQUIRE(statistics.freeBlocks == 1);
+	REQUIRE(statistics.usedBlocks == 0);
+	REQUIRE(statistics.usedSize == 0);
+	REQUIRE(statistics.freeSize == statistics.largestFreeBlockSize);
+	REQUIRE(statistics.freeSize < statistics.totalSize);
+	REQUIRE(statistics.totalSize <= sizeof(arena) - 1);
+
+	// allocation which needs more than the largest free block must fail
+	REQUIRE(heap.allocate(statistics.largestFreeBlockSize + 1) == nullptr);
+
+	const auto pointer = heap.allocate(statistics.largestFreeBlockSize / 2);
+	REQUIRE(pointer != nullptr);
+	REQUIRE(reinterpret_cast<uintptr_t>(pointer) % TlsfHeap::alignment == 0);
+	REQUIRE(heap.getStatistics().usedBlocks == 1);
+	REQUIRE(heap.getStatistics().usedSize >= statistics.largestFreeBlockSize / 2);
+	heap.deallocate(pointer);
+	REQUIRE(heap.getStatistics().freeSize == statistics.freeSize);
+}
+
+TEST_CASE("Testing allocation and deallocation in TlsfHeap", "[allocate]")
+{
+	alignas(TlsfHeap::alignment) static uint8_t arena[arenaSize];
+	TlsfHeap heap;
+	REQUIRE(heap.initialize(arena, sizeof(arena)) == 0);
+	const auto initialStatistics = heap.getStatistics();
+
+	std::minstd_rand randomEngine {};
+	std::vector<Allocation> allocations;
+	for (size_t iteration {}; iteration < 10000; ++iteration)
+	{
+		if (allocations.empty() == false && randomEngine() % 3 == 0)
+		{
+			const auto index = randomEngine() % allocations.size();
+			REQUIRE(checkPattern(allocations[index]) == true);
+			heap.deallocate(allocations[index].pointer);
+			allocations.erase(allocations.begin() + index);
+			continue;
+		}
+
+		const auto size = randomEngine() % 3 == 0 ? randomEngine() % 2048 : randomEngine() % 64;
+		const auto pointer = static_cast<uint8_t*>(heap.allocate(size));
+		if (pointer == nullptr)
+		{
+			// request is rounded up to the next list, so allocation may fail even if slightly smaller block is free
+			REQUIRE(heap.getStatistics().largestFreeBlockSize < size + size / 16 + TlsfHeap::alignment);
+			continue;
+		}
+
+		REQUIRE(reinterpret_cast<uintptr_t>(pointer) % TlsfHeap::alignment == 0);
+		REQUIRE(pointer >= arena);
+		REQUIRE(pointer + size <= arena + sizeof(arena));
+		REQUIRE(TlsfHeap::getUsableSize(pointer) >= size);
+		allocations.push_back({pointer, size, static_cast<uint8_t>(iteration)});
+		fillPattern(allocations.back());
+
+		const auto statistics = heap.getStatistics();
+		REQUIRE(statistics.usedBlocks == allocations.size());
+		REQUIRE(statistics.largestFreeBlockSize <= statistics.freeSize);
+	}
+
+	for (const auto& allocation : allocations)
+	{
+		REQUIRE(checkPattern(allocation) == true);
+		heap.deallocate(allocation.pointer);
+	}
+
+	// all free blocks must be coalesced back into one
+	const auto statistics = heap.getStatistics();
+	REQUIRE(statistics.freeBlocks == initialStatistics.freeBlocks);
+	REQUIRE(statistics.freeSize == initialStatistics.freeSize);
+	REQUIRE(statistics.usedBlocks == 0);
+	REQUIRE(statistics.usedSize == 0);
+}
+
+TEST_CASE("Testing aligned allocation in TlsfHeap", "[allocateAligned]")
+{
+	alignas(TlsfHeap::alignment) static uint8_t arena[arenaSize];
+	TlsfHeap heap;
+	REQUIRE(heap.initialize(arena, sizeof(arena)) == 0);
+	const auto initialStatistics = heap.getStatistics();
+
+	REQUIRE(heap.allocateAligned(0, 16) == nullptr);
+	REQUIRE(heap.allocateAligned(48, 16) == nullptr);
+
+	std::vector<Allocation> allocations;
+	for (const size_t alignment : {1, 8, 32, 64, 256, 1024, 4096})
+	{
+		const auto pointer = static_cast<uint8_t*>(heap.allocateAligned(alignment, alignment + 7));
+		REQUIRE(pointer != nullptr);
+		REQUIRE(reinterpret_cast<uintptr_t>(pointer) % alignment == 0);
+		allocations.push_back({pointer, alignment + 7, static_cast<uint8_t>(alignment)});
+		fillPattern(allocations.back());
+	}
+
+	for (const auto& allocation : allocations)
+	{
+		REQUIRE(checkPattern(allocation) == true);
+		heap.deallocate(allocation.pointer);
+	}
+
+	const auto statistics = heap.getStatistics();
+	REQUIRE(statistics.freeBlocks == initialStatistics.freeBlocks);
+	REQUIRE(statistics.freeSize == initialStatistics.freeSize);
+}
+
+TEST_CASE("Testing reallocation in TlsfHeap", "[reallocate]")
+{
+	alignas(TlsfHeap::alignment) static uint8_t arena[arenaSize];
+	TlsfHeap heap;
+	REQUIRE(heap.initialize(arena, sizeof(arena)) == 0);
+	const auto initialStatistics = heap.getStatistics();
+
+	Allocation first {static_cast<uint8_t*>(heap.reallocate(nullptr, 100)), 100, 0x10};
+	REQUIRE(first.pointer != nullptr);
+	fillPattern(first);
+
+	// next block is free, so the block is grown in place
+	auto pointer = heap.reallocate(first.pointer, 1000);
+	REQUIRE(pointer == first.pointer);
+	REQUIRE(checkPattern(first) == true);
+
+	// shrinking is always done in place
+	pointer = heap.reallocate(first.pointer, 50);
+	REQUIRE(pointer == first.pointer);
+	first.size = 50;
+	REQUIRE(checkPattern(first) == true);
+
+	Allocation second {static_cast<uint8_t*>(heap.allocate(100)), 100, 0x20};
+	REQUIRE(second.pointer != nullptr);
+	fillPattern(second);
+
+	// next block is used, so the block is moved
+	pointer = heap.reallocate(first.pointer, 1000);
+	REQUIRE(pointer != nullptr);
+	REQUIRE(pointer != first.pointer);
+	first.pointer = static_cast<uint8_t*>(pointer);
+	REQUIRE(checkPattern(first) == true);
+	REQUIRE(checkPattern(second) == true);
+
+	// failed reallocation leaves the block intact
+	REQUIRE(heap.reallocate(first.pointer, arenaSize) == nullptr);
+	REQUIRE(checkPattern(first) == true);
+
+	REQUIRE(heap.reallocate(first.pointer, 0) == nullptr);
+	heap.deallocate(second.pointer);
+
+	const auto statistics = heap.getStatistics();
+	REQUIRE(statistics.freeBlocks == initialStatistics.freeBlocks);
+	REQUIRE(statistics.freeSize == initialStatistics.freeSize);
+	REQUIRE(statistics.usedSize == 0);
+}
@@ -0,0 +1,134 @@
+/**
+ * \file
+ * \brief TraceRecorder test cases
+ *
+ * This test checks whether TraceRecorder returns records in the order in which they were recorded, overwrites the
+ * oldest records when the ring buffer is full and reports the number of overwritten records.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/TraceRecorder.hpp"
+
+using distortos::TraceRecord;
+using distortos::internal::TraceRecorder;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Creates test record.
+ *
+ * \param [in] timestamp is the timestamp of record, also used as its argument
+ *
+ * \return test record with \a timestamp
+ */
+
+TraceRecord makeRecord(const uint64_t timestamp)
+{
+	return {timestamp, reinterpret_cast<const void*>(0x2000), reinterpret_cast<const void*>(0x3000),
+			static_cast<uint32_t>(timestamp), TraceRecord::Type::queuePush, false};
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing reads of TraceRecorder without overwriting", "[read]")
+{
+	TraceRecord records[4] {};
+	TraceRecorder traceRecorder {TraceRecorder::RecordsRange{records}};
+
+	TraceRecord readRecords[8] {};
+	REQUIRE(traceRecorder.read(TraceRecorder::RecordsRange{readRecords}) == 0);
+
+	for (uint64_t timestamp {1}; timestamp <= 3; ++timestamp)
+		traceRecorder.record(makeRecord(timestamp));
+	REQUIRE(traceRecorder.getSize() == 3);
+
+	// partial read leaves remaining records in the ring buffer
+	REQUIRE(traceRecorder.read({readRecords, 2}) == 2);
+	REQUIRE(readRecords[0].timestamp == 1);
+	REQUIRE(readRecords[1].timestamp == 2);
+	REQUIRE(traceRecorder.getSize() == 1);
+
+	for (uint64_t timestamp {4}; timestamp <= 6; ++timestamp)
+		traceRecorder.record(makeRecord(timestamp));
+	REQUIRE(traceRecorder.getSize() == 4);
+
+	REQUIRE(traceRecorder.read(TraceRecorder::RecordsRange{readRecords}) == 4);
+	for (size_t i {}; i < 4; ++i)
+	{
+		REQUIRE(readRecords[i].timestamp == i + 3);
+		REQUIRE(readRecords[i].argument == i + 3);
+		REQUIRE(readRecords[i].thread == reinterpret_cast<const void*>(0x2000));
+		REQUIRE(readRecords[i].object == reinterpret_cast<const void*>(0x3000));
+		REQUIRE(readRecords[i].type == TraceRecord::Type::queuePush);
+	}
+	REQUIRE(traceRecorder.getSize() == 0);
+	REQUIRE(traceRecorder.read(TraceRecorder::RecordsRange{readRecords}) == 0);
+}
+
+TEST_CASE("Testing overwriting of records in TraceRecorder", "[overwrite]")
+{
+	TraceRecord records[4] {};
+	TraceRecorder traceRecorder {TraceRecorder::RecordsRange{records}};
+
+	for (uint64_t timestamp {1}; timestamp <= 7; ++timestamp)
+		traceRecorder.record(makeRecord(timestamp));
+	REQUIRE(traceRecorder.getSize() == 4);
+
+	TraceRecord readRecords[8] {};
+
+	// first read reports only the number of lost records if there is space for a single record
+	REQUIRE(traceRecorder.read({readRecords, 1}) == 1);
+	REQUIRE(readRecords[0].type == TraceRecord::Type::lostRecords);
+	REQUIRE(readRecords[0].argument == 3);
+	REQUIRE(readRecords[0].timestamp == 4);
+	REQUIRE(readRecords[0].thread == nullptr);
+	REQUIRE(readRecords[0].object == nullptr);
+
+	REQUIRE(traceRecorder.read(TraceRecorder::RecordsRange{readRecords}) == 4);
+	for (size_t i {}; i < 4; ++i)
+		REQUIRE(readRecords[i].timestamp == i + 4);
+
+	for (uint64_t timestamp {8}; timestamp <= 13; ++timestamp)
+		traceRecorder.record(makeRecord(timestamp));
+
+	REQUIRE(traceRecorder.read(TraceRecorder::RecordsRange{readRecords}) == 5);
+	REQUIRE(readRecords[0].type == TraceRecord::Type::lostRecords);
+	REQUIRE(readRecords[0].argument == 2);
+	for (size_t i {1}; i < 5; ++i)
+		REQUIRE(readRecords[i].timestamp == i + 9);
+}
+
+TEST_CASE("Testing clearing of TraceRecorder", "[clear]")
+{
+	TraceRecord records[2] {};
+	TraceRecorder traceRecorder {TraceRecorder::RecordsRange{records}};
+
+	for (uint64_t timestamp {1}; timestamp <= 5; ++timestamp)
+		traceRecorder.record(makeRecord(timestamp));
+
+	traceRecorder.clear();
+	REQUIRE(traceRecorder.getSize() == 0);
+
+	TraceRecord readRecords[4] {};
+	REQUIRE(traceRecorder.read(TraceRecorder::RecordsRange{readRecords}) == 0);
+
+	traceRecorder.record(makeRecord(6));
+	REQUIRE(traceRecorder.read(TraceRecorder::RecordsRange{readRecords}) == 1);
+	REQUIRE(readRecords[0].timestamp == 6);
+}
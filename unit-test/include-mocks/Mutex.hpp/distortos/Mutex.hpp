@@ -2,7 +2,7 @@
  * \file
  * \brief Mock of Mutex class
  *
- * \author Copyright (C) 2017-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -80,6 +80,7 @@ public:
 	}
 
 	MAKE_MOCK3(construct, void(Type, Protocol, uint8_t));
+	MAKE_CONST_MOCK0(getType, Type());
 	MAKE_MOCK0(lock, int());
 	MAKE_MOCK0(tryLock, int());
 	MAKE_MOCK1(tryLockFor, int(TickClock::duration));
@@ -123,11 +124,21 @@ public:
 
 	}
 
+	Type getType() const
+	{
+		return mock::Mutex::getInstance().getType();
+	}
+
 	int lock()
 	{
 		return mock::Mutex::getInstance().lock();
 	}
 
+	int tryLock()
+	{
+		return mock::Mutex::getInstance().tryLock();
+	}
+
 	int unlock()
 	{
 		return mock::Mutex::getInstance().unlock();
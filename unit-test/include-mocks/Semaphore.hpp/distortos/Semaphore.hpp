@@ -2,7 +2,7 @@
  * \file
  * \brief Mock of Semaphore class
  *
- * \author Copyright (C) 2017-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -86,16 +86,31 @@ public:
 
 	using Value = mock::Semaphore::Value;
 
-	constexpr explicit Semaphore(Value, Value = std::numeric_limits<Value>::max())
+	constexpr explicit Semaphore(size_t, size_t = std::numeric_limits<Value>::max())
 	{
 
 	}
 
+	Value getMaxValue() const
+	{
+		return mock::Semaphore::getInstance().getMaxValue();
+	}
+
 	int post()
 	{
 		return mock::Semaphore::getInstance().post();
 	}
 
+	int tryWait()
+	{
+		return mock::Semaphore::getInstance().tryWait();
+	}
+
+	int tryWaitUntil(const TickClock::time_point timePoint)
+	{
+		return mock::Semaphore::getInstance().tryWaitUntil(timePoint);
+	}
+
 	int wait()
 	{
 		return mock::Semaphore::getInstance().wait();
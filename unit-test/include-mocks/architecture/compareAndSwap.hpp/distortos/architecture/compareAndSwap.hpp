@@ -0,0 +1,32 @@
+/**
+ * \file
+ * \brief Host implementation of compareAndSwap()
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_COMPAREANDSWAP_HPP_DISTORTOS_ARCHITECTURE_COMPAREANDSWAP_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_COMPAREANDSWAP_HPP_DISTORTOS_ARCHITECTURE_COMPAREANDSWAP_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+inline bool compareAndSwap(uintptr_t& object, uintptr_t expected, const uintptr_t desired)
+{
+	return __atomic_compare_exchange_n(&object, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_COMPAREANDSWAP_HPP_DISTORTOS_ARCHITECTURE_COMPAREANDSWAP_HPP_
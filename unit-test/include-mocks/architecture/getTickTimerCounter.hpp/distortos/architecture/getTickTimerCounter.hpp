@@ -0,0 +1,74 @@
+/**
+ * \file
+ * \brief Mock of getTickTimerCounter()
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_DISTORTOS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_DISTORTOS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_
+
+#include "unit-test-common.hpp"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+struct TickTimerCounter
+{
+	uint32_t elapsed;
+	uint32_t period;
+	bool pendingTick;
+};
+
+class GetTickTimerCounterMock
+{
+public:
+
+	GetTickTimerCounterMock()
+	{
+		REQUIRE(getInstanceInternal() == nullptr);
+		getInstanceInternal() = this;
+	}
+
+	~GetTickTimerCounterMock()
+	{
+		REQUIRE(getInstanceInternal() != nullptr);
+		getInstanceInternal() = {};
+	}
+
+	MAKE_CONST_MOCK0(getTickTimerCounter, TickTimerCounter());
+
+	static const GetTickTimerCounterMock& getInstance()
+	{
+		REQUIRE(getInstanceInternal() != nullptr);
+		return *getInstanceInternal();
+	}
+
+private:
+
+	static const GetTickTimerCounterMock*& getInstanceInternal()
+	{
+		static const GetTickTimerCounterMock* instance;
+		return instance;
+	}
+};
+
+inline static TickTimerCounter getTickTimerCounter()
+{
+	return GetTickTimerCounterMock::getInstance().getTickTimerCounter();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_DISTORTOS_ARCHITECTURE_GETTICKTIMERCOUNTER_HPP_
@@ -17,6 +17,8 @@
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
 #include "distortos/internal/scheduler/ThreadList.hpp"
 
+#include "distortos/TickClock.hpp"
+
 namespace distortos
 {
 
@@ -34,6 +36,7 @@ public:
 	MAKE_MOCK3(blockUntil, int(ThreadList&, ThreadState, TickClock::time_point));
 	MAKE_MOCK4(blockUntil, int(ThreadList&, ThreadState, TickClock::time_point, const UnblockFunctor*));
 	MAKE_CONST_MOCK0(getCurrentThreadControlBlock, ThreadControlBlock&());
+	MAKE_CONST_MOCK0(getTickCount, uint64_t());
 	MAKE_MOCK1(unblock, void(ThreadList::iterator));
 	MAKE_MOCK2(unblock, void(ThreadList::iterator, UnblockReason));
 };
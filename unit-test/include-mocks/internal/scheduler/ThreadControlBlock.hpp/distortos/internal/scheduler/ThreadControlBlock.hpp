@@ -2,7 +2,7 @@
  * \file
  * \brief Mock of ThreadControlBlock class
  *
- * \author Copyright (C) 2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -27,11 +27,16 @@ namespace distortos
 namespace internal
 {
 
+class Stack;
+
 class ThreadControlBlock : public ThreadListNode
 {
 public:
 
 	MAKE_MOCK0(getOwnedProtocolMutexList, MutexList&());
+	MAKE_CONST_MOCK0(getSequenceNumber, uintptr_t());
+	MAKE_MOCK0(getStack, Stack&());
+	MAKE_CONST_MOCK0(getState, ThreadState());
 	MAKE_MOCK1(setPriorityInheritanceMutexControlBlock, void(const MutexControlBlock*));
 	MAKE_MOCK0(updateBoostedPriority, void());
 	MAKE_MOCK1(updateBoostedPriority, void(uint8_t));
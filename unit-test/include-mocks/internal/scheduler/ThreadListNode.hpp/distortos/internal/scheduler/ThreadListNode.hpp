@@ -2,7 +2,7 @@
  * \file
  * \brief Mock of ThreadListNode class
  *
- * \author Copyright (C) 2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -31,6 +31,8 @@ public:
 
 	estd::IntrusiveListNode threadListNode;
 	estd::IntrusiveListNode threadGroupNode;
+	estd::IntrusiveListNode stackMonitorNode;
+	bool stackUsageWarningReported {};
 };
 
 }	// namespace internal
@@ -0,0 +1,389 @@
+/**
+ * \file
+ * \brief memoryRegions and ThreadRecyclingCache test cases
+ *
+ * This test checks whether memoryRegions::allocate() selects regions by capabilities - trying the region with main heap
+ * first and then all other regions in the order of the table - whether memoryRegions::deallocate() returns memory to
+ * the region which owns it and whether ThreadRecyclingCache reuses a cached block only when both its size and
+ * capabilities match. The table of regions returned by internal::getMemoryRegions() is defined by the test, with real
+ * TlsfHeap objects managing static arenas.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+#include "distortos/internal/memory/MemoryRegion.hpp"
+#include "distortos/internal/memory/ThreadRecyclingCache.hpp"
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/memoryRegions.hpp"
+
+#include <iterator>
+
+using distortos::MemoryCapabilities;
+using distortos::internal::MemoryRegion;
+using distortos::internal::ThreadRecyclingCache;
+using distortos::internal::TlsfHeap;
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of TlsfHeap, used by region "SRAM"
+TlsfHeap tlsfHeapInstance;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of arena of region "CCM", bytes
+constexpr size_t ccmArenaSize {2048};
+
+/// size of arena of region "SRAM" (with main heap), bytes
+constexpr size_t sramArenaSize {4096};
+
+/// size of arena of region "SRAM2", bytes
+constexpr size_t sram2ArenaSize {8192};
+
+/// index of region "CCM" in the table
+constexpr size_t ccmIndex {0};
+
+/// index of region "SRAM" (with main heap) in the table
+constexpr size_t sramIndex {1};
+
+/// index of region "SRAM2" in the table
+constexpr size_t sram2Index {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// arena of region "CCM"
+alignas(max_align_t) char ccmArena[ccmArenaSize];
+
+/// arena of region "SRAM" (with main heap)
+alignas(max_align_t) char sramArena[sramArenaSize];
+
+/// arena of region "SRAM2"
+alignas(max_align_t) char sram2Arena[sram2ArenaSize];
+
+/// heap of region "CCM"
+TlsfHeap ccmHeap;
+
+/// heap of region "SRAM2"
+TlsfHeap sram2Heap;
+
+/// table of regions, region with main heap is deliberately not the first one
+MemoryRegion memoryRegionsArray[]
+{
+		{
+				"CCM",
+				MemoryCapabilities::fast,
+				ccmHeap,
+				ccmArena,
+				ccmArena + ccmArenaSize,
+		},
+		{
+				"SRAM",
+				MemoryCapabilities::dma | MemoryCapabilities::cacheable,
+				distortos::internal::getTlsfHeap(),
+				sramArena,
+				sramArena + sramArenaSize,
+		},
+		{
+				"SRAM2",
+				MemoryCapabilities::dma,
+				sram2Heap,
+				sram2Arena,
+				sram2Arena + sram2ArenaSize,
+		},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Initializes heaps of all regions, only on first call.
+ *
+ * TlsfHeap cannot be initialized again, so all test cases must deallocate everything they allocated.
+ */
+
+void initializeHeaps()
+{
+	static bool initialized;
+	if (initialized == true)
+		return;
+
+	for (auto& region : memoryRegionsArray)
+		REQUIRE(region.getHeap().initialize(region.getBegin(), region.getEnd() - region.getBegin()) == 0);
+
+	initialized = true;
+}
+
+/**
+ * \param [in] memory is a pointer to memory which will be checked
+ *
+ * \return index of region which contains \a memory, size of the table if no region contains it
+ */
+
+size_t findRegion(const void* const memory)
+{
+	for (size_t i {}; i < std::size(memoryRegionsArray); ++i)
+		if (memoryRegionsArray[i].contains(memory) == true)
+			return i;
+
+	return std::size(memoryRegionsArray);
+}
+
+/**
+ * \brief Checks whether all heaps are empty.
+ */
+
+void requireEmptyHeaps()
+{
+	for (auto& region : memoryRegionsArray)
+		REQUIRE(region.getHeap().getStatistics().usedBlocks == 0);
+}
+
+}	// namespace
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MemoryRegionsRange getMemoryRegions()
+{
+	return MemoryRegionsRange{memoryRegionsArray};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void fatalErrorHandler(const char*, int, const char*, const char* const message)
+{
+	FAIL(message);
+	abort();
+}
+
+}	// extern "C"
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing filtering of memory regions by capabilities", "[capabilities]")
+{
+	distortos::InterruptMaskingLock::Proxy proxy;
+	initializeHeaps();
+
+	REQUIRE(distortos::memoryRegions::getCount() == std::size(memoryRegionsArray));
+	for (size_t i {}; i < std::size(memoryRegionsArray); ++i)
+	{
+		REQUIRE(distortos::memoryRegions::getCapabilities(i) == memoryRegionsArray[i].getCapabilities());
+		REQUIRE(distortos::memoryRegions::getName(i) == memoryRegionsArray[i].getName());
+	}
+
+	const struct
+	{
+		MemoryCapabilities capabilities;
+		size_t region;
+	} associations[]
+	{
+			{MemoryCapabilities::fast, ccmIndex},
+			{MemoryCapabilities::dma, sramIndex},
+			{MemoryCapabilities::cacheable, sramIndex},
+			{MemoryCapabilities::dma | MemoryCapabilities::cacheable, sramIndex},
+			{MemoryCapabilities::dma | MemoryCapabilities::fast, std::size(memoryRegionsArray)},
+	};
+	for (auto& association : associations)
+		DYNAMIC_SECTION("capabilities: " << static_cast<int>(association.capabilities))
+		{
+			void* memory;
+
+			{
+				trompeloeil::sequence sequence;
+				REQUIRE_CALL(proxy, construct()).IN_SEQUENCE(sequence);
+				REQUIRE_CALL(proxy, destruct()).IN_SEQUENCE(sequence);
+				memory = distortos::memoryRegions::allocate(association.capabilities, 64);
+			}
+
+			REQUIRE(findRegion(memory) == association.region);
+			REQUIRE((memory == nullptr) == (association.region == std::size(memoryRegionsArray)));
+
+			ALLOW_CALL(proxy, construct());
+			ALLOW_CALL(proxy, destruct());
+			distortos::memoryRegions::deallocate(memory);
+			requireEmptyHeaps();
+		}
+}
+
+TEST_CASE("Testing order of memory regions", "[order]")
+{
+	distortos::InterruptMaskingLock::Proxy proxy;
+	ALLOW_CALL(proxy, construct());
+	ALLOW_CALL(proxy, destruct());
+	initializeHeaps();
+
+	SECTION("Region with main heap is tried first, even if it is not the first one")
+	{
+		const auto memory = distortos::memoryRegions::allocate(MemoryCapabilities::none, 64);
+		REQUIRE(findRegion(memory) == sramIndex);
+		distortos::memoryRegions::deallocate(memory);
+	}
+	SECTION("Other regions are tried if region with main heap is too small")
+	{
+		const auto memory = distortos::memoryRegions::allocate(MemoryCapabilities::dma, sramArenaSize);
+		REQUIRE(findRegion(memory) == sram2Index);
+		distortos::memoryRegions::deallocate(memory);
+	}
+	SECTION("Other regions are tried in the order of the table")
+	{
+		const auto memory = distortos::memoryRegions::allocate(MemoryCapabilities::none, sramArenaSize / 4);
+		const auto block = distortos::memoryRegions::allocate(MemoryCapabilities::none, sramArenaSize / 2);
+		const auto otherBlock = distortos::memoryRegions::allocate(MemoryCapabilities::none, ccmArenaSize / 2);
+		REQUIRE(findRegion(memory) == sramIndex);
+		REQUIRE(findRegion(block) == sramIndex);
+		// main heap has no room for another block of this size, so the first region of the table is used
+		REQUIRE(findRegion(otherBlock) == ccmIndex);
+
+		const auto largeBlock = distortos::memoryRegions::allocate(MemoryCapabilities::none, ccmArenaSize);
+		// neither main heap nor first region has room for block of this size, so the last region is used
+		REQUIRE(findRegion(largeBlock) == sram2Index);
+
+		REQUIRE(distortos::memoryRegions::allocate(MemoryCapabilities::none, sram2ArenaSize) == nullptr);
+
+		for (const auto pointer : {memory, block, otherBlock, largeBlock})
+			distortos::memoryRegions::deallocate(pointer);
+	}
+	SECTION("Alignment is honoured in all regions")
+	{
+		constexpr size_t alignment {256};
+		const auto memory = distortos::memoryRegions::allocate(MemoryCapabilities::fast, 64, alignment);
+		const auto otherMemory = distortos::memoryRegions::allocate(MemoryCapabilities::dma, 64, alignment);
+		REQUIRE(findRegion(memory) == ccmIndex);
+		REQUIRE(findRegion(otherMemory) == sramIndex);
+		REQUIRE(reinterpret_cast<uintptr_t>(memory) % alignment == 0);
+		REQUIRE(reinterpret_cast<uintptr_t>(otherMemory) % alignment == 0);
+		distortos::memoryRegions::deallocate(memory);
+		distortos::memoryRegions::deallocate(otherMemory);
+	}
+
+	requireEmptyHeaps();
+}
+
+TEST_CASE("Testing deallocation to the region which owns memory", "[deallocate]")
+{
+	distortos::InterruptMaskingLock::Proxy proxy;
+	ALLOW_CALL(proxy, construct());
+	ALLOW_CALL(proxy, destruct());
+	initializeHeaps();
+
+	{
+		FORBID_CALL(proxy, construct());
+		distortos::memoryRegions::deallocate(nullptr);
+	}
+
+	void* memories[std::size(memoryRegionsArray)];
+	memories[ccmIndex] = distortos::memoryRegions::allocate(MemoryCapabilities::fast, 128);
+	memories[sramIndex] = distortos::memoryRegions::allocate(MemoryCapabilities::cacheable, 128);
+	memories[sram2Index] = distortos::memoryRegions::allocate(MemoryCapabilities::dma, sramArenaSize);
+
+	for (size_t i {}; i < std::size(memoryRegionsArray); ++i)
+	{
+		REQUIRE(findRegion(memories[i]) == i);
+		REQUIRE(memoryRegionsArray[i].getHeap().getStatistics().usedBlocks == 1);
+	}
+
+	for (size_t i {}; i < std::size(memoryRegionsArray); ++i)
+	{
+		distortos::memoryRegions::deallocate(memories[i]);
+		for (size_t j {}; j < std::size(memoryRegionsArray); ++j)
+			REQUIRE(memoryRegionsArray[j].getHeap().getStatistics().usedBlocks == (j > i ? 1 : 0));
+	}
+}
+
+TEST_CASE("Testing ThreadRecyclingCache with memory regions", "[cache]")
+{
+	distortos::InterruptMaskingLock::Proxy proxy;
+	ALLOW_CALL(proxy, construct());
+	ALLOW_CALL(proxy, destruct());
+	initializeHeaps();
+
+	ThreadRecyclingCache cache {4};
+
+	const auto block = cache.allocate(128, MemoryCapabilities::dma);
+	REQUIRE(findRegion(block) == sramIndex);
+	cache.deallocate(block);
+	REQUIRE(cache.getSize() == 1);
+	REQUIRE(cache.getMissCount() == 1);
+
+	SECTION("Block is not reused by allocation with different capabilities")
+	{
+		const auto otherBlock = cache.allocate(128, MemoryCapabilities::fast);
+		REQUIRE(otherBlock != block);
+		REQUIRE(findRegion(otherBlock) == ccmIndex);
+		REQUIRE(cache.getSize() == 1);
+		REQUIRE(cache.getHitCount() == 0);
+		REQUIRE(cache.getMissCount() == 2);
+		cache.deallocate(otherBlock);
+	}
+	SECTION("Block is not reused by allocation with different size")
+	{
+		const auto otherBlock = cache.allocate(256, MemoryCapabilities::dma);
+		REQUIRE(otherBlock != block);
+		REQUIRE(findRegion(otherBlock) == sramIndex);
+		REQUIRE(cache.getSize() == 1);
+		REQUIRE(cache.getHitCount() == 0);
+		REQUIRE(cache.getMissCount() == 2);
+		cache.deallocate(otherBlock);
+	}
+	SECTION("Block is reused by allocation with the same size and capabilities")
+	{
+		const auto otherBlock = cache.allocate(128, MemoryCapabilities::dma);
+		REQUIRE(otherBlock == block);
+		REQUIRE(cache.getSize() == 0);
+		REQUIRE(cache.getHitCount() == 1);
+		REQUIRE(cache.getMissCount() == 1);
+		cache.deallocate(otherBlock);
+	}
+
+	// trimmed blocks are returned to the regions which own them
+	const auto size = cache.getSize();
+	REQUIRE(cache.trim() == size);
+	requireEmptyHeaps();
+}